@@ -1,11 +1,14 @@
 #!/bin/bash
 
 # Script version
-VERSION="0.0.3"
+VERSION="0.0.4"
 
 # Define the name of the virtual environment directory
 VENV_DIR=".ChipInspVEnv"
 
+# Stamp written after a successful setup, delete it to force every check to run again
+STAMP_FILE="$VENV_DIR/.ChipInspStamp"
+
 # Function to activate the virtual environment
 activate_venv() {
     source "$1/bin/activate"
@@ -176,6 +179,39 @@ python_executable() {
     fi
 }
 
+compute_stamp() {
+    # Interpreter path, requirements hash and site-packages modification time of the virtual environment
+    if [ ! -x "$VENV_DIR/bin/python" ] || [ ! -f "requirements.txt" ]; then
+        return 1
+    fi
+
+    # Follow the symlink chain to the real interpreter so upgrading it invalidates the stamp
+    local interpreter link requirements_hash site_packages venv_mtime
+    interpreter="$VENV_DIR/bin/python"
+    while [ -L "$interpreter" ]; do
+        link=$(readlink "$interpreter")
+        case "$link" in
+            /*) interpreter="$link" ;;
+            *) interpreter="$(dirname "$interpreter")/$link" ;;
+        esac
+    done
+    requirements_hash=$(cksum < requirements.txt)
+    for site_packages in "$VENV_DIR"/lib/python*/site-packages; do
+        break
+    done
+    venv_mtime=$(stat -c %Y "$site_packages" 2>/dev/null || stat -f %m "$site_packages" 2>/dev/null) || return 1
+    echo "$interpreter $requirements_hash $venv_mtime"
+}
+
+# Fast path: when the environment is unchanged since the last successful setup, skip every check
+if [ -f "$STAMP_FILE" ] && [ ! src/features.def -nt src/featuredb.bin ]; then
+    read -r recorded_stamp < "$STAMP_FILE"
+    current_stamp=$(compute_stamp)
+    if [ -n "$current_stamp" ] && [ "$current_stamp" == "$recorded_stamp" ]; then
+        exec "$VENV_DIR/bin/python" src/main.py "$@"
+    fi
+fi
+
 clear
 
 # Print script version
@@ -312,6 +348,15 @@ fi
 # Common tasks that apply to all operating systems after successful checks
 echo "Checks passed..."
 
+# Recompile the feature database when features.def has changed
+if [ src/features.def -nt src/featuredb.bin ]; then
+    echo "Compiling feature database..."
+    $(python_executable) src/gen_featuredb.py || exit 1
+fi
+
+# Record the verified environment so the next launch can take the fast path
+compute_stamp > "$STAMP_FILE" || rm -f "$STAMP_FILE"
+
 # Run command using the determined Python executable
 echo "Running ChipInspect using $(python_executable)"
-$(python_executable) src/main.py
+$(python_executable) src/main.py "$@"
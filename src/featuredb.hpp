@@ -0,0 +1,1608 @@
+// -----------------------------------------------------------------------------
+//
+// ChipInspect - CPUID feature database accessors.
+//
+// Generated by gen_featuredb.py from features.def, do not edit.
+//
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chipinspect::featuredb {
+
+enum class Vendor : std::uint8_t { Intel = 0, Amd = 1 };
+enum class Register : std::uint8_t { Eax = 0, Ebx = 1, Ecx = 2, Edx = 3 };
+
+inline constexpr std::uint32_t kFormatVersion = 1;
+inline constexpr std::uint32_t kSourceCrc = 0x95E2B30Bu;
+inline constexpr std::uint32_t kAnySubleaf = 0xFFFFFFFFu;
+
+struct Field {
+    std::uint32_t leaf;
+    std::uint32_t subleaf;
+    Vendor vendor;
+    Register reg;
+    std::uint8_t lsb;
+    std::uint8_t width;
+    const char *mnemonic;
+    const char *name;
+
+    constexpr std::uint32_t extract(std::uint32_t value) const {
+        return width >= 32 ? value : (value >> lsb) & ((1u << width) - 1u);
+    }
+
+    constexpr bool covers(std::uint32_t queried_leaf, std::uint32_t queried_subleaf) const {
+        return leaf == queried_leaf && (subleaf == kAnySubleaf || subleaf == queried_subleaf);
+    }
+};
+
+inline constexpr Field kFields[] = {
+    {0x00000000u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 32, "MAX_BASIC_LEAF", "Maximum basic leaf"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 4, "STEPPING_ID", "Stepping ID"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 4, 4, "MODEL_ID", "Model ID"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 8, 4, "FAMILY_ID", "Family ID"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 12, 2, "PROCESSOR_TYPE", "Processor type (0 for Original OEM Processor)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 16, 4, "EXTENDED_MODEL_ID", "Extended model ID"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 20, 8, "EXTENDED_FAMILY_ID", "Extended family ID"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 0, 8, "BRAND_INDEX", "Brand index"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 8, 8, "CLFLUSH_LINE_SIZE", "CLFLUSH line size"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 16, 8, "LOGICAL_PROCESSORS", "Logical processors"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 24, 8, "INITIAL_APIC_ID", "Initial APIC value"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 0, 1, "SSE3", "SSE3 (Prescott New Instructions - PNI)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 1, 1, "PCLMULQDQ", "PCLMULQDQ (carry-less multiply) instruction"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 2, 1, "DTES64", "64-bit debug store (DTES64) (EDX Bit 21)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 3, 1, "MONITOR", "MONITOR and MWAIT instructions (PNI)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 4, 1, "DS_CPL", "CPL qualified debug store (DS-CPL)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 5, 1, "VMX", "Virtual Machine eXtensions (VMX)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 6, 1, "SMX", "Safer Mode Extensions (SMX) (GETSEC instruction)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 7, 1, "EST", "Enhanced SpeedStep (EST)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 8, 1, "TM2", "Thermal Monitor 2 (TM2)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 9, 1, "SSSE3", "Supplemental SSE3 instructions"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 10, 1, "CNXT_ID", "L1 Context ID (CNXT-ID)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 11, 1, "SDBG", "Silicon Debug interface (SDBG)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 12, 1, "FMA", "Fused multiply-add (FMA3)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 13, 1, "CMPXCHG16B", "CMPXCHG16B instruction"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 14, 1, "XTPR", "Can disable sending task priority messages (XTPR)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 15, 1, "PDCM", "Perfmon & debug capability (PDCM)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 17, 1, "PCID", "Process context identifiers (CR4 Bit 17) (PCID)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 18, 1, "DCA", "Direct cache access for DMA writes (DCA)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 19, 1, "SSE4_1", "SSE4.1 instructions"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 20, 1, "SSE4_2", "SSE4.2 instructions"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 21, 1, "X2APIC", "x2APIC (enhanced APIC)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 22, 1, "MOVBE", "MOVBE instruction (big-endian MOV)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 23, 1, "POPCNT", "POPCNT instruction"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 24, 1, "TSC_DEADLINE", "APIC implements one-shot operation using a TSC deadline value (TSC-DEADLINE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 25, 1, "AES", "AES instruction set (AES-NI)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 26, 1, "XSAVE", "Extensible processor state save/restore (XSAVE, XRSTOR, XSETBV, XGETBV)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 27, 1, "OSXSAVE", "XSAVE enabled by OS (OSXSAVE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 28, 1, "AVX", "Advanced Vector Extensions (AVX)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 29, 1, "F16C", "Floating-point conversion instructions to/from FP16 format (F16C)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 30, 1, "RDRAND", "RDRAND (on-chip random number generator) feature"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 31, 1, "HYPERVISOR", "Hypervisor present (always zero on physical CPUs)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 0, 1, "FPU", "x87 FPU on chip (FPU)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 1, 1, "VME", "Virtual 8086 mode enhancements (VME)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 2, 1, "DE", "Debugging extensions (DE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 3, 1, "PSE", "Page size extension (PSE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 4, 1, "TSC", "Time stamp counter (TSC)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 5, 1, "MSR", "Model specific registers (MSR)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 6, 1, "PAE", "Physical address extension (PAE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 7, 1, "MCE", "Machine check exception (MCE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 8, 1, "CX8", "CMPXCHG8B (CX8)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 9, 1, "APIC", "APIC on chip (APIC)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 11, 1, "SEP", "SYSENTER/SYSEXIT instructions (SEP)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 12, 1, "MTRR", "Memory type range registers (MTRR)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 13, 1, "PGE", "Page global bit (PGE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 14, 1, "MCA", "Machine check architecture (MCA)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 15, 1, "CMOV", "Conditional move instructions (CMOV)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 16, 1, "PAT", "Page attribute table (PAT)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 17, 1, "PSE36", "32-bit page size extension (PSE36)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 18, 1, "PSN", "Processor serial number (PSN)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 19, 1, "CLFSH", "CLFLUSH support (CLFSH)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 21, 1, "DS", "Debug store (DS)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 22, 1, "ACPI", "ACPI"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 23, 1, "MMX", "MMX"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 24, 1, "FXSR", "FXSAVE/FXSTOR instructions (FXSR)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 25, 1, "SSE", "SSE"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 26, 1, "SSE2", "SSE2"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 27, 1, "SS", "Self Snoop (SS)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 28, 1, "HTT", "HyperThreading / max APIC IDs field is valid (HTT)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 29, 1, "TM", "Thermal monitor (TM)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 31, 1, "PBE", "Pending break enable (PBE)"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 5, "CACHE_TYPE", "Cache type (1 data, 2 instruction, 3 unified)"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 5, 3, "CACHE_LEVEL", "Cache level"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 8, 1, "SELF_INITIALIZING", "Self initializing cache level"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 9, 1, "FULLY_ASSOCIATIVE", "Fully associative cache"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 14, 12, "SHARING_THREADS", "Maximum logical processors sharing this cache (minus 1)"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 26, 6, "PACKAGE_CORES", "Maximum processor cores in the physical package (minus 1)"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 0, 12, "LINE_SIZE", "System coherency line size (minus 1)"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 12, 10, "PARTITIONS", "Physical line partitions (minus 1)"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 22, 10, "WAYS", "Ways of associativity (minus 1)"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 0, 32, "SETS", "Number of sets (minus 1)"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 0, 1, "WBINVD", "WBINVD/INVD does not flush lower level caches of other threads"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 1, 1, "INCLUSIVE", "Cache is inclusive of lower cache levels"},
+    {0x00000004u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 2, 1, "COMPLEX_INDEXING", "Complex cache indexing"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 16, "MIN_MONITOR_LINE", "Smallest monitor-line size in bytes"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 0, 16, "MAX_MONITOR_LINE", "Largest monitor-line size in bytes"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 0, 1, "EMX", "Enumeration of MONITOR/MWAIT extensions supported"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 1, 1, "IBE", "Interrupts as break-event for MWAIT, even when interrupts are disabled"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 0, 4, "C0_SUBSTATES", "Number of C0 sub C-states supported using MWAIT"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 4, 4, "C1_SUBSTATES", "Number of C1 sub C-states supported using MWAIT"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 8, 4, "C2_SUBSTATES", "Number of C2 sub C-states supported using MWAIT"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 12, 4, "C3_SUBSTATES", "Number of C3 sub C-states supported using MWAIT"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 16, 4, "C4_SUBSTATES", "Number of C4 sub C-states supported using MWAIT"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 20, 4, "C5_SUBSTATES", "Number of C5 sub C-states supported using MWAIT"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 24, 4, "C6_SUBSTATES", "Number of C6 sub C-states supported using MWAIT"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 28, 4, "C7_SUBSTATES", "Number of C7 sub C-states supported using MWAIT"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 1, "DTS", "Digital temperature sensor (DTS)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 1, 1, "TURBO_BOOST", "Intel Turbo Boost Technology"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 2, 1, "ARAT", "Always running APIC timer (ARAT)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 4, 1, "PLN", "Power limit notification (PLN)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 5, 1, "ECMD", "Clock modulation duty cycle extension (ECMD)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 6, 1, "PTM", "Package thermal management (PTM)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 7, 1, "HWP", "Hardware P-states (HWP)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 8, 1, "HWP_NOTIFICATION", "HWP notification"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 9, 1, "HWP_ACTIVITY_WINDOW", "HWP activity window"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 10, 1, "HWP_EPP", "HWP energy performance preference"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 11, 1, "HWP_PACKAGE_REQUEST", "HWP package level request"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 13, 1, "HDC", "Hardware duty cycling (HDC)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 14, 1, "TURBO_BOOST_MAX_3", "Intel Turbo Boost Max Technology 3.0"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 15, 1, "HWP_HIGHEST_CHANGE", "HWP highest performance change"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 16, 1, "HWP_PECI_OVERRIDE", "HWP PECI override"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 17, 1, "FLEXIBLE_HWP", "Flexible HWP"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 18, 1, "HWP_FAST_ACCESS", "Fast access mode for IA32_HWP_REQUEST"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 19, 1, "HW_FEEDBACK", "Hardware feedback interface (HW_FEEDBACK)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 20, 1, "HWP_IGNORE_IDLE", "Ignoring idle logical processor HWP request"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 22, 1, "HWP_CTL", "HWP control MSR (IA32_HWP_CTL)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 23, 1, "THREAD_DIRECTOR", "Intel Thread Director"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 0, 4, "INTERRUPT_THRESHOLDS", "Number of interrupt thresholds in the digital thermal sensor"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 0, 1, "HW_COORD_FEEDBACK", "Hardware coordination feedback capability (IA32_MPERF and IA32_APERF)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 3, 1, "ENERGY_PERF_BIAS", "Performance-energy bias preference (IA32_ENERGY_PERF_BIAS)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 8, 8, "TD_CLASSES", "Number of Intel Thread Director classes"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Eax, 0, 32, "MAX_SUBLEAF", "Maximum leaf 7 subleaf"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 0, 1, "FSGSBASE", "FSGSBASE instructions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 1, 1, "TSC_ADJUST", "IA32_TSC_ADJUST MSR"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 2, 1, "SGX", "Intel Software Guard Extensions (SGX)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 3, 1, "BMI1", "Bit Manipulation Instruction Set 1 (BMI1)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 4, 1, "HLE", "Hardware Lock Elision (HLE)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 5, 1, "AVX2", "Advanced Vector Extensions 2 (AVX2)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 6, 1, "FDP_EXCPTN_ONLY", "FDP exception only (FDP_EXCPTN_ONLY) feature"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 7, 1, "SMEP", "Supervisor Mode Execution Protection (SMEP)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 8, 1, "BMI2", "Bit Manipulation Instruction Set 2 (BMI2)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 9, 1, "ERMS", "Enhanced REP MOVSB/STOSB (ERMS)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 10, 1, "INVPCID", "INVPCID instruction"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 11, 1, "RTM", "Restricted Transactional Memory"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 12, 1, "RDT_M", "Intel Resource Director (RDT) Monitoring"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 13, 1, "FPU_CS_DS", "x87 FPU CS and DS Instructions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 14, 1, "MPX", "Intel Memory Protection Extensions (MPX)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 15, 1, "RDT_A", "Intel Resource Director (RDT) Allocation"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 16, 1, "AVX512F", "AVX-512 Foundation Instructions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 17, 1, "AVX512DQ", "AVX-512 Doubleword and Quadword (DQ) Instructions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 18, 1, "RDSEED", "RDSEED - Supports RDSEED instruction"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 19, 1, "ADX", "Intel ADX (Multi-Precision Add-Carry Instruction Extensions)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 20, 1, "SMAP", "Supervisor Mode Access Prevention (SMAP)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 21, 1, "AVX512_IFMA", "AVX-512 Integer Fused Multiply-Add (IFMA) Instructions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 22, 1, "PCOMMIT", "PCOMMIT instruction"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 23, 1, "CLFLUSHOPT", "CLFLUSHOPT instruction"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 24, 1, "CLWB", "Cache line writeback (CLWB)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 25, 1, "INTEL_PT", "Intel Processor Trace (IPT)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 26, 1, "AVX512PF", "AVX-512 Prefetch (PF) Instructions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 27, 1, "AVX512ER", "AVX-512 Exponential and Reciprocal (ER) Instructions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 28, 1, "AVX512CD", "AVX-512 Conflict Detection (CD) Instructions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 29, 1, "SHA", "SHA-1 and SHA-256 Extensions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 30, 1, "AVX512BW", "AVX512 Byte and Word (BW) Instructions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ebx, 31, 1, "AVX512VL", "AVX512 Vector Length (VL) Extensions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 0, 1, "PREFETCHWT1", "PREFETCHWT1"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 1, 1, "AVX512_VBMI", "AVX512 vector byte manipulation instructions (AVX512VBMI)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 2, 1, "UMIP", "User-mode instruction prevention (UMIP)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 3, 1, "PKU", "Supports protection keys for user-mode pages (PKU)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 4, 1, "OSPKE", "OS support enabled for protection keys (OSPKE)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 5, 1, "WAITPKG", "Wait and pause enhancements (WAITPKG)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 6, 1, "AVX512_VBMI2", "AVX512 VBMI2"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 7, 1, "CET_SS", "CET shadow stack (CET SS)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 8, 1, "GFNI", "Galois field NI / Galois field affine transformation (GFNI)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 9, 1, "VAES", "VEX-encoded AES-NI (VAES)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 10, 1, "VPCLMULQDQ", "VEX-encoded PCLMUL (VPCL)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 11, 1, "AVX512_VNNI", "AVX512 vector neural network instructions (AVX512VNNI)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 12, 1, "AVX512_BITALG", "AVX512 bitwise algorithms (AVX512BITALG)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 13, 1, "TME", "Total memory encryption (TME) enable"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 14, 1, "AVX512_VPOPCNTDQ", "AVX512 VPOPCNTDQ"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 16, 1, "LA57", "5-level paging (LA57)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 17, 5, "MAWAU", "Value of MAWAU used by BNDLDX and BNDSTX instructions in 64-bit mode"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 22, 1, "RDPID", "Read processor ID (RDPID)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 23, 1, "KL", "Key locker (KL)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 24, 1, "BUS_LOCK_DETECT", "OS bus-lock detection (BUS_LOCK_DETECT)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 25, 1, "CLDEMOTE", "Cache line demote (CLDEMOTE)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 27, 1, "MOVDIRI", "32-bit direct stores (MOVDIRI)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 28, 1, "MOVDIR64B", "64-bit direct stores (MOVDIRI64B)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 29, 1, "ENQCMD", "Enqueue stores (ENQCMD)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 30, 1, "SGX_LC", "SGX launch configuration"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Ecx, 31, 1, "PKS", "Protection keys for supervisor-mode pages (PKS)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 1, 1, "SGX_KEYS", "Attestation services for SGX (SGX-KEYS)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 2, 1, "AVX512_4VNNIW", "AVX512 4VNNIW 4-iteration dot product with accumulation"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 3, 1, "AVX512_4FMAPS", "AVX512 4FMAPS 4-iteration fused multiply-add"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 4, 1, "FSRM", "Fast short REP MOV"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 5, 1, "UINTR", "User interrupts (UINTR)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 8, 1, "AVX512_VP2INTERSECT", "AVX512 VP2INTERSECT dword/qword intersection instructions"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 9, 1, "SRBDS_CTRL", "Special register buffer data sampling mitigation MSR (SRBDS_CTRL)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 10, 1, "MD_CLEAR", "Microarchitectural data sampling mitigation (MD_CLEAR)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 11, 1, "RTM_ALWAYS_ABORT", "RTM transactions always abort (RTM_ALWAYS_ABORT)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 13, 1, "TSX_FORCE_ABORT", "TSX force abort MSR available"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 14, 1, "SERIALIZE", "SERIALIZE instruction"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 15, 1, "HYBRID", "Hybrid architecture"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 16, 1, "TSXLDTRK", "TSX suspend load address tracking"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 18, 1, "PCONFIG", "Platform configuration instruction (PCONFIG)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 19, 1, "ARCH_LBR", "Architectural last branch records (ARCH_LBR)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 20, 1, "CET_IBT", "CET indirect branch tracking (CET IBT)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 22, 1, "AMX_BF16", "Tile computation on bfloat16 (AMX-BF16)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 23, 1, "AVX512_FP16", "AVX512 FP16"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 24, 1, "AMX_TILE", "Tile architecture (AMX-TILE)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 25, 1, "AMX_INT8", "Tile computation on 8-bit integers (AMX-INT8)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 26, 1, "IBRS_IBPB", "Speculation control (IBRS and IPBP)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 27, 1, "STIBP", "Single thread indirect branch predictors (STIBP)"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 28, 1, "L1D_FLUSH", "L1 data cache (L1D) flush"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 29, 1, "ARCH_CAPABILITIES", "IA32_ARCH_CAPABILITIES MSR available"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 30, 1, "CORE_CAPABILITIES", "IA32_CORE_CAPABILITIES MSR available"},
+    {0x00000007u, 0x00000000u, Vendor::Intel, Register::Edx, 31, 1, "SSBD", "Speculative store bypass disable (SSBD)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 0, 1, "SHA512", "SHA512 instructions (SHA512)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 1, 1, "SM3", "SM3 instructions (SM3)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 2, 1, "SM4", "SM4 instructions (SM4)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 3, 1, "RAO_INT", "Remote atomic operations on integers (RAO-INT)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 4, 1, "AVX_VNNI", "AVX vector neural network instructions (AVX-VNNI)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 5, 1, "AVX512_BF16", "AVX512 bfloat16 instructions (AVX512_BF16)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 6, 1, "LASS", "Linear address space separation (LASS)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 7, 1, "CMPCCXADD", "CMPccXADD instructions (CMPCCXADD)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 8, 1, "ARCH_PERFMON_EXT", "Architectural performance monitoring extended leaf 0x23 (ArchPerfmonExt)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 10, 1, "FZLRM", "Fast zero-length REP MOVSB"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 11, 1, "FSRS", "Fast short REP STOSB"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 12, 1, "FSRC", "Fast short REP CMPSB and REP SCASB"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 17, 1, "FRED", "Flexible return and event delivery (FRED)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 18, 1, "LKGS", "LKGS instruction (LKGS)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 19, 1, "WRMSRNS", "Non-serializing WRMSR (WRMSRNS)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 21, 1, "AMX_FP16", "Tile computation on FP16 (AMX-FP16)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 22, 1, "HRESET", "History reset (HRESET)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 23, 1, "AVX_IFMA", "AVX integer fused multiply-add (AVX-IFMA)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 26, 1, "LAM", "Linear address masking (LAM)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Eax, 27, 1, "MSRLIST", "RDMSRLIST and WRMSRLIST instructions (MSRLIST)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Edx, 4, 1, "AVX_VNNI_INT8", "AVX VNNI INT8 instructions (AVX-VNNI-INT8)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Edx, 5, 1, "AVX_NE_CONVERT", "AVX no-exception FP conversion instructions (AVX-NE-CONVERT)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Edx, 8, 1, "AMX_COMPLEX", "Tile computation on complex FP16 (AMX-COMPLEX)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Edx, 10, 1, "AVX_VNNI_INT16", "AVX VNNI INT16 instructions (AVX-VNNI-INT16)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Edx, 14, 1, "PREFETCHI", "Instruction prefetch (PREFETCHIT0/1)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Edx, 17, 1, "UIRET_UIF", "UIRET sets UIF from the popped RFLAGS"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Edx, 18, 1, "CET_SSS", "CET supervisor shadow stack (CET_SSS)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Edx, 19, 1, "AVX10", "Intel AVX10 converged vector ISA (AVX10)"},
+    {0x00000007u, 0x00000001u, Vendor::Intel, Register::Edx, 21, 1, "APX_F", "Advanced performance extensions foundation (APX_F)"},
+    {0x00000007u, 0x00000002u, Vendor::Intel, Register::Edx, 0, 1, "PSFD", "Fast store forwarding predictor disable (PSFD)"},
+    {0x00000007u, 0x00000002u, Vendor::Intel, Register::Edx, 1, 1, "IPRED_CTRL", "Indirect predictor control (IPRED_CTRL)"},
+    {0x00000007u, 0x00000002u, Vendor::Intel, Register::Edx, 2, 1, "RRSBA_CTRL", "Restricted RSB alternate control (RRSBA_CTRL)"},
+    {0x00000007u, 0x00000002u, Vendor::Intel, Register::Edx, 3, 1, "DDPD_U", "Data dependent prefetcher disable (DDPD_U)"},
+    {0x00000007u, 0x00000002u, Vendor::Intel, Register::Edx, 4, 1, "BHI_CTRL", "Branch history injection control (BHI_CTRL)"},
+    {0x00000007u, 0x00000002u, Vendor::Intel, Register::Edx, 5, 1, "MCDT_NO", "No MXCSR configuration dependent timing (MCDT_NO)"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 8, "PERFMON_VERSION", "Architectural performance monitoring version"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 8, 8, "GP_COUNTERS", "General-purpose counters per logical processor"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 16, 8, "GP_COUNTER_WIDTH", "General-purpose counter bit width"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 24, 8, "EBX_VECTOR_LENGTH", "Length of the EBX event availability vector"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 0, 1, "NO_CORE_CYCLES", "Core cycle event not available"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 1, 1, "NO_INSTRUCTIONS", "Instruction retired event not available"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 2, 1, "NO_REF_CYCLES", "Reference cycles event not available"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 3, 1, "NO_LLC_REFERENCES", "Last-level cache reference event not available"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 4, 1, "NO_LLC_MISSES", "Last-level cache misses event not available"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 5, 1, "NO_BRANCHES", "Branch instruction retired event not available"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 6, 1, "NO_BRANCH_MISSES", "Branch mispredict retired event not available"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 7, 1, "NO_TOPDOWN_SLOTS", "Top-down slots event not available"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 0, 5, "FIXED_COUNTERS", "Contiguous fixed-function performance counters"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 5, 8, "FIXED_COUNTER_WIDTH", "Fixed-function performance counter bit width"},
+    {0x0000000Au, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 15, 1, "ANYTHREAD_DEPRECATED", "AnyThread deprecation"},
+    {0x0000000Bu, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 5, "APIC_ID_SHIFT", "Bits to shift right on x2APIC ID to get the next level ID"},
+    {0x0000000Bu, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 0, 16, "LEVEL_PROCESSORS", "Logical processors at this level"},
+    {0x0000000Bu, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 0, 8, "LEVEL_NUMBER", "Level number"},
+    {0x0000000Bu, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 8, 8, "LEVEL_TYPE", "Level type (1 SMT, 2 core)"},
+    {0x0000000Bu, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 0, 32, "X2APIC_ID", "x2APIC ID of the current logical processor"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Eax, 0, 1, "X87", "x87 state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Eax, 1, 1, "SSE", "SSE state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Eax, 2, 1, "AVX", "AVX state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Eax, 3, 1, "BNDREGS", "MPX BNDREGS state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Eax, 4, 1, "BNDCSR", "MPX BNDCSR state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Eax, 5, 1, "OPMASK", "AVX-512 opmask state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Eax, 6, 1, "ZMM_HI256", "AVX-512 ZMM_Hi256 state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Eax, 7, 1, "HI16_ZMM", "AVX-512 Hi16_ZMM state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Eax, 9, 1, "PKRU", "PKRU state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Eax, 17, 1, "XTILECFG", "AMX XTILECFG state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Eax, 18, 1, "XTILEDATA", "AMX XTILEDATA state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Ebx, 0, 32, "ENABLED_SIZE", "XSAVE area size for the features enabled in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Intel, Register::Ecx, 0, 32, "MAX_SIZE", "XSAVE area size for all supported XCR0 features"},
+    {0x0000000Du, 0x00000001u, Vendor::Intel, Register::Eax, 0, 1, "XSAVEOPT", "XSAVEOPT instruction (XSAVEOPT)"},
+    {0x0000000Du, 0x00000001u, Vendor::Intel, Register::Eax, 1, 1, "XSAVEC", "XSAVEC and compacted XRSTOR (XSAVEC)"},
+    {0x0000000Du, 0x00000001u, Vendor::Intel, Register::Eax, 2, 1, "XGETBV_ECX1", "XGETBV with ECX=1 (XGETBV_ECX1)"},
+    {0x0000000Du, 0x00000001u, Vendor::Intel, Register::Eax, 3, 1, "XSAVES", "XSAVES/XRSTORS and IA32_XSS (XSAVES)"},
+    {0x0000000Du, 0x00000001u, Vendor::Intel, Register::Eax, 4, 1, "XFD", "Extended feature disable (XFD)"},
+    {0x0000000Fu, 0x00000000u, Vendor::Intel, Register::Edx, 1, 1, "L3_MONITORING", "L3 cache resource monitoring"},
+    {0x00000010u, 0x00000000u, Vendor::Intel, Register::Ebx, 1, 1, "L3_CAT", "L3 cache allocation technology"},
+    {0x00000010u, 0x00000000u, Vendor::Intel, Register::Ebx, 2, 1, "L2_CAT", "L2 cache allocation technology"},
+    {0x00000010u, 0x00000000u, Vendor::Intel, Register::Ebx, 3, 1, "MBA", "Memory bandwidth allocation"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Eax, 0, 32, "MAX_SUBLEAF", "Maximum Processor Trace subleaf"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ebx, 0, 1, "CR3_FILTER", "CR3 filtering (IA32_RTIT_CR3_MATCH)"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ebx, 1, 1, "PSB_CYC", "Configurable PSB frequency and cycle-accurate mode (CYC packets)"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ebx, 2, 1, "IP_FILTER", "IP filtering, TraceStop and preserved PT MSRs across warm reset"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ebx, 3, 1, "MTC", "MTC timing packets and suppression of COFI-based packets"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ebx, 4, 1, "PTWRITE", "PTWRITE instruction and PTW packets"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ebx, 5, 1, "POWER_EVENT_TRACE", "Power event trace (PWRE)"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ebx, 6, 1, "PSB_PMI_PRESERVE", "PSB and PMI preservation"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ebx, 7, 1, "EVENT_TRACE", "Event trace packet generation (EventEn)"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ebx, 8, 1, "TNT_DISABLE", "TNT packet generation disable (DisTNT)"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ecx, 0, 1, "TOPA", "ToPA output scheme"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ecx, 1, 1, "TOPA_MULTI_ENTRY", "ToPA tables can hold multiple output entries"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ecx, 2, 1, "SINGLE_RANGE", "Single-range output scheme"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ecx, 3, 1, "TRANSPORT_OUTPUT", "Output to trace transport subsystem"},
+    {0x00000014u, 0x00000000u, Vendor::Intel, Register::Ecx, 31, 1, "LIP", "IP payloads contain linear addresses (LIP) instead of effective addresses"},
+    {0x00000014u, 0x00000001u, Vendor::Intel, Register::Eax, 0, 3, "ADDR_RANGES", "Number of configurable address ranges for filtering"},
+    {0x00000014u, 0x00000001u, Vendor::Intel, Register::Eax, 16, 16, "MTC_PERIODS", "Bitmap of supported MTC period encodings"},
+    {0x00000014u, 0x00000001u, Vendor::Intel, Register::Ebx, 0, 16, "CYC_THRESHOLDS", "Bitmap of supported cycle threshold encodings"},
+    {0x00000014u, 0x00000001u, Vendor::Intel, Register::Ebx, 16, 16, "PSB_FREQUENCIES", "Bitmap of supported PSB frequency encodings"},
+    {0x00000015u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 32, "TSC_DENOMINATOR", "Denominator of the TSC/core crystal clock ratio"},
+    {0x00000015u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 0, 32, "TSC_NUMERATOR", "Numerator of the TSC/core crystal clock ratio"},
+    {0x00000015u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 0, 32, "CRYSTAL_HZ", "Nominal core crystal clock frequency in Hz"},
+    {0x00000016u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 16, "BASE_MHZ", "Processor base frequency in MHz"},
+    {0x00000016u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 0, 16, "MAX_MHZ", "Maximum frequency in MHz"},
+    {0x00000016u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 0, 16, "BUS_MHZ", "Bus (reference) frequency in MHz"},
+    {0x0000001Au, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 24, "NATIVE_MODEL_ID", "Native model ID of the core"},
+    {0x0000001Au, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 24, 8, "CORE_TYPE", "Core type (0x20 Atom, 0x40 Core)"},
+    {0x0000001Cu, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 8, "DEPTHS", "Bitmap of supported LBR depths (bit n means depth 8*(n+1))"},
+    {0x0000001Cu, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 30, 1, "DEEP_CSTATE_RESET", "LBRs may be cleared on deep C-state entry"},
+    {0x0000001Cu, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 31, 1, "LIP", "LBR IP values contain linear addresses (LIP)"},
+    {0x0000001Cu, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 0, 1, "CPL_FILTER", "CPL filtering"},
+    {0x0000001Cu, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 1, 1, "BRANCH_FILTER", "Branch type filtering"},
+    {0x0000001Cu, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 2, 1, "CALL_STACK", "Call-stack mode"},
+    {0x0000001Cu, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 0, 1, "MISPREDICT", "Mispredict bit in LBR records"},
+    {0x0000001Cu, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 1, 1, "TIMED_LBR", "Timed LBRs (cycle counts)"},
+    {0x0000001Cu, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 2, 1, "BRANCH_TYPE", "Branch type field in LBR records"},
+    {0x0000001Cu, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 16, 4, "EVENT_LOGGING", "Bitmap of PMCs supporting event logging"},
+    {0x0000001Du, 0x00000001u, Vendor::Intel, Register::Eax, 0, 16, "TOTAL_TILE_BYTES", "Total tile bytes"},
+    {0x0000001Du, 0x00000001u, Vendor::Intel, Register::Eax, 16, 16, "BYTES_PER_TILE", "Bytes per tile"},
+    {0x0000001Du, 0x00000001u, Vendor::Intel, Register::Ebx, 0, 16, "BYTES_PER_ROW", "Bytes per tile row"},
+    {0x0000001Du, 0x00000001u, Vendor::Intel, Register::Ebx, 16, 16, "MAX_NAMES", "Number of tile registers"},
+    {0x0000001Du, 0x00000001u, Vendor::Intel, Register::Ecx, 0, 16, "MAX_ROWS", "Maximum rows per tile"},
+    {0x0000001Eu, 0x00000000u, Vendor::Intel, Register::Ebx, 0, 8, "TMUL_MAXK", "TMUL maximum K (rows or columns)"},
+    {0x0000001Eu, 0x00000000u, Vendor::Intel, Register::Ebx, 8, 16, "TMUL_MAXN", "TMUL maximum N (column bytes)"},
+    {0x0000001Fu, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 5, "APIC_ID_SHIFT", "Bits to shift right on x2APIC ID to get the next level ID"},
+    {0x0000001Fu, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 0, 16, "LEVEL_PROCESSORS", "Logical processors at this level"},
+    {0x0000001Fu, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 0, 8, "LEVEL_NUMBER", "Level number"},
+    {0x0000001Fu, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 8, 8, "LEVEL_TYPE", "Level type (1 SMT, 2 core, 3 module, 4 tile, 5 die)"},
+    {0x0000001Fu, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 0, 32, "X2APIC_ID", "x2APIC ID of the current logical processor"},
+    {0x40000000u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 32, "MAX_HYPERVISOR_LEAF", "Maximum hypervisor leaf"},
+    {0x80000000u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 32, "MAX_EXTENDED_LEAF", "Maximum extended leaf"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 0, 1, "LAHF_SAHF", "LAHF/SAHF available in 64-bit mode"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 5, 1, "LZCNT", "LZCNT"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 8, 1, "PREFETCHW", "PREFETCHW"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 11, 1, "SYSCALL", "SYSCALL/SYSRET available in 64-bit mode"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 20, 1, "NX", "Execute disable bit (NX) available"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 26, 1, "PAGE_1GB", "1GB pages available"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 27, 1, "RDTSCP", "RDTSCP and IA32_TSC_AUX available"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 29, 1, "LM", "Intel 64 architecture available (EM64T)"},
+    {0x80000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 0, 8, "L2_LINE_SIZE", "L2 cache line size in bytes"},
+    {0x80000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 12, 4, "L2_ASSOC", "L2 associativity field"},
+    {0x80000006u, 0xFFFFFFFFu, Vendor::Intel, Register::Ecx, 16, 16, "L2_SIZE_KB", "L2 cache size in KB"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Intel, Register::Edx, 8, 1, "INVARIANT_TSC", "Invariant TSC"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 0, 8, "PHYS_ADDR_BITS", "Physical address bits"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 8, 8, "LINEAR_ADDR_BITS", "Linear address bits"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Intel, Register::Eax, 16, 8, "GUEST_PHYS_ADDR_BITS", "Guest physical address bits (0 means same as physical)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Intel, Register::Ebx, 9, 1, "WBNOINVD", "WBNOINVD instruction"},
+    {0x00000000u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 32, "MAX_BASIC_LEAF", "Maximum basic leaf"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 4, "STEPPING_ID", "Stepping ID"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 4, 4, "MODEL_ID", "Model ID"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 8, 4, "FAMILY_ID", "Family ID"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 12, 2, "PROCESSOR_TYPE", "Processor type (0 for Original OEM Processor)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 16, 4, "EXTENDED_MODEL_ID", "Extended model ID"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 20, 8, "EXTENDED_FAMILY_ID", "Extended family ID"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 8, "BRAND_ID", "8-bit brand ID (BrandId)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 8, 8, "CLFLUSH_LINE_SIZE", "CLFLUSH line size (CLFlush)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 16, 8, "LOGICAL_PROCESSORS", "Logical processor count (LogicalProcessorCount)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 24, 8, "INITIAL_APIC_ID", "Initial local APIC physical ID (LocalApicId)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 0, 1, "SSE3", "SSE3 instructions (SSE3)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 1, 1, "PCLMULQDQ", "PCLMULQDQ instruction (PCLMULQDQ)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 3, 1, "MONITOR", "MONITOR and MWAIT instructions (MONITOR)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 9, 1, "SSSE3", "Supplemental SSE3 instructions (SSSE3)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 12, 1, "FMA", "Fused multiply-add (FMA)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 13, 1, "CMPXCHG16B", "CMPXCHG16B instruction (CMPXCHG16B)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 19, 1, "SSE4_1", "SSE4.1 instructions (SSE41)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 20, 1, "SSE4_2", "SSE4.2 instructions (SSE42)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 21, 1, "X2APIC", "x2APIC (X2APIC)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 22, 1, "MOVBE", "MOVBE instruction (MOVBE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 23, 1, "POPCNT", "POPCNT instruction (POPCNT)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 25, 1, "AES", "AES instructions (AES)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 26, 1, "XSAVE", "XSAVE, XRSTOR, XSETBV and XGETBV instructions (XSAVE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 27, 1, "OSXSAVE", "XSAVE enabled by OS (OSXSAVE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 28, 1, "AVX", "Advanced Vector Extensions (AVX)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 29, 1, "F16C", "Half-precision convert instructions (F16C)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 30, 1, "RDRAND", "RDRAND instruction (RDRAND)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 31, 1, "HYPERVISOR", "Reserved for use by hypervisor to indicate guest status"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 0, 1, "FPU", "x87 floating-point unit on-chip (FPU)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 1, 1, "VME", "Virtual-mode enhancements (VME)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 2, 1, "DE", "Debugging extensions (DE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 3, 1, "PSE", "Page-size extensions (PSE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 4, 1, "TSC", "Time stamp counter (TSC)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 5, 1, "MSR", "AMD model-specific registers (MSR)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 6, 1, "PAE", "Physical-address extensions (PAE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 7, 1, "MCE", "Machine check exception (MCE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 8, 1, "CX8", "CMPXCHG8B instruction (CMPXCHG8B)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 9, 1, "APIC", "Advanced programmable interrupt controller (APIC)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 11, 1, "SEP", "SYSENTER and SYSEXIT instructions (SysEnterSysExit)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 12, 1, "MTRR", "Memory-type range registers (MTRR)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 13, 1, "PGE", "Page global extension (PGE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 14, 1, "MCA", "Machine check architecture (MCA)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 15, 1, "CMOV", "Conditional move instructions (CMOV)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 16, 1, "PAT", "Page attribute table (PAT)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 17, 1, "PSE36", "Page-size extensions (PSE36)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 19, 1, "CLFSH", "CLFLUSH instruction (CLFSH)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 23, 1, "MMX", "MMX instructions (MMX)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 24, 1, "FXSR", "FXSAVE and FXRSTOR instructions (FXSR)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 25, 1, "SSE", "SSE instructions (SSE)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 26, 1, "SSE2", "SSE2 instructions (SSE2)"},
+    {0x00000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 28, 1, "HTT", "Hyper-threading technology (HTT)"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 16, "MIN_MONITOR_LINE", "Smallest monitor-line size in bytes"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 16, "MAX_MONITOR_LINE", "Largest monitor-line size in bytes"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 0, 1, "EMX", "Enumeration of MONITOR/MWAIT extensions supported"},
+    {0x00000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 1, 1, "IBE", "Interrupts as break-event for MWAIT, even when interrupts are disabled"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 2, 1, "ARAT", "APIC timer always running (ARAT)"},
+    {0x00000006u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 0, 1, "EFF_FREQ", "Effective frequency interface (MPERF and APERF)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Eax, 0, 32, "MAX_SUBLEAF", "Maximum leaf 7 subleaf"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 0, 1, "FSGSBASE", "FS and GS base read/write instructions (FSGSBASE)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 3, 1, "BMI1", "Bit manipulation group 1 instructions (BMI1)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 5, 1, "AVX2", "AVX2 instructions (AVX2)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 7, 1, "SMEP", "Supervisor mode execution prevention (SMEP)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 8, 1, "BMI2", "Bit manipulation group 2 instructions (BMI2)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 9, 1, "ERMS", "Enhanced REP MOVSB/STOSB (ERMS)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 10, 1, "INVPCID", "INVPCID instruction (INVPCID)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 12, 1, "PQM", "Platform QOS monitoring (PQM)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 15, 1, "PQE", "Platform QOS enforcement (PQE)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 16, 1, "AVX512F", "AVX-512 foundation instructions (AVX512F)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 17, 1, "AVX512DQ", "AVX-512 doubleword and quadword instructions (AVX512DQ)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 18, 1, "RDSEED", "RDSEED instruction (RDSEED)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 19, 1, "ADX", "ADCX and ADOX instructions (ADX)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 20, 1, "SMAP", "Supervisor mode access prevention (SMAP)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 21, 1, "AVX512_IFMA", "AVX-512 integer fused multiply-add (AVX512_IFMA)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 23, 1, "CLFLUSHOPT", "CLFLUSHOPT instruction (CLFLUSHOPT)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 24, 1, "CLWB", "CLWB instruction (CLWB)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 28, 1, "AVX512CD", "AVX-512 conflict detection instructions (AVX512CD)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 29, 1, "SHA", "Secure hash algorithm instructions (SHA)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 30, 1, "AVX512BW", "AVX-512 byte and word instructions (AVX512BW)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ebx, 31, 1, "AVX512VL", "AVX-512 vector length extensions (AVX512VL)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 1, 1, "AVX512_VBMI", "AVX-512 vector byte manipulation instructions (AVX512_VBMI)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 2, 1, "UMIP", "User mode instruction prevention (UMIP)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 3, 1, "PKU", "Memory protection keys (PKU)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 4, 1, "OSPKE", "OS has enabled memory protection keys (OSPKE)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 6, 1, "AVX512_VBMI2", "AVX-512 VBMI2 instructions (AVX512_VBMI2)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 7, 1, "CET_SS", "Shadow stacks (CET_SS)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 8, 1, "GFNI", "Galois field transformation instructions (GFNI)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 9, 1, "VAES", "VEX 256-bit AES instructions (VAES)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 10, 1, "VPCLMULQDQ", "VEX 256-bit PCLMULQDQ instructions (VPCLMULQDQ)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 11, 1, "AVX512_VNNI", "AVX-512 vector neural network instructions (AVX512_VNNI)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 12, 1, "AVX512_BITALG", "AVX-512 bit algorithms (AVX512_BITALG)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 14, 1, "AVX512_VPOPCNTDQ", "AVX-512 VPOPCNTD and VPOPCNTQ instructions (AVX512_VPOPCNTDQ)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 16, 1, "LA57", "5-level paging (LA57)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 22, 1, "RDPID", "RDPID instruction (RDPID)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 24, 1, "BUS_LOCK_DETECT", "Bus lock debug exception (BUSLOCKDETECT)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 27, 1, "MOVDIRI", "MOVDIRI instruction (MOVDIRI)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Ecx, 28, 1, "MOVDIR64B", "MOVDIR64B instruction (MOVDIR64B)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Edx, 4, 1, "FSRM", "Fast short REP MOVSB (FSRM)"},
+    {0x00000007u, 0x00000000u, Vendor::Amd, Register::Edx, 8, 1, "AVX512_VP2INTERSECT", "AVX-512 VP2INTERSECT instructions (AVX512_VP2INTERSECT)"},
+    {0x00000007u, 0x00000001u, Vendor::Amd, Register::Eax, 4, 1, "AVX_VNNI", "AVX vector neural network instructions (AVX-VNNI)"},
+    {0x00000007u, 0x00000001u, Vendor::Amd, Register::Eax, 5, 1, "AVX512_BF16", "AVX-512 bfloat16 instructions (AVX512_BF16)"},
+    {0x0000000Bu, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 5, "APIC_ID_SHIFT", "Bits to shift right on x2APIC ID to get the next level ID"},
+    {0x0000000Bu, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 16, "LEVEL_PROCESSORS", "Logical processors at this level"},
+    {0x0000000Bu, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 0, 8, "LEVEL_NUMBER", "Level number"},
+    {0x0000000Bu, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 8, 8, "LEVEL_TYPE", "Level type (1 SMT, 2 core)"},
+    {0x0000000Bu, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 0, 32, "X2APIC_ID", "x2APIC ID of the current logical processor"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Eax, 0, 1, "X87", "x87 state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Eax, 1, 1, "SSE", "SSE state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Eax, 2, 1, "AVX", "AVX state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Eax, 3, 1, "BNDREGS", "MPX BNDREGS state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Eax, 4, 1, "BNDCSR", "MPX BNDCSR state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Eax, 5, 1, "OPMASK", "AVX-512 opmask state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Eax, 6, 1, "ZMM_HI256", "AVX-512 ZMM_Hi256 state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Eax, 7, 1, "HI16_ZMM", "AVX-512 Hi16_ZMM state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Eax, 9, 1, "PKRU", "PKRU state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Eax, 17, 1, "XTILECFG", "AMX XTILECFG state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Eax, 18, 1, "XTILEDATA", "AMX XTILEDATA state supported in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Ebx, 0, 32, "ENABLED_SIZE", "XSAVE area size for the features enabled in XCR0"},
+    {0x0000000Du, 0x00000000u, Vendor::Amd, Register::Ecx, 0, 32, "MAX_SIZE", "XSAVE area size for all supported XCR0 features"},
+    {0x0000000Du, 0x00000001u, Vendor::Amd, Register::Eax, 0, 1, "XSAVEOPT", "XSAVEOPT instruction (XSAVEOPT)"},
+    {0x0000000Du, 0x00000001u, Vendor::Amd, Register::Eax, 1, 1, "XSAVEC", "XSAVEC and compacted XRSTOR (XSAVEC)"},
+    {0x0000000Du, 0x00000001u, Vendor::Amd, Register::Eax, 2, 1, "XGETBV_ECX1", "XGETBV with ECX=1 (XGETBV_ECX1)"},
+    {0x0000000Du, 0x00000001u, Vendor::Amd, Register::Eax, 3, 1, "XSAVES", "XSAVES/XRSTORS and IA32_XSS (XSAVES)"},
+    {0x0000000Du, 0x00000001u, Vendor::Amd, Register::Eax, 4, 1, "XFD", "Extended feature disable (XFD)"},
+    {0x40000000u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 32, "MAX_HYPERVISOR_LEAF", "Maximum hypervisor leaf"},
+    {0x80000000u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 32, "MAX_EXTENDED_LEAF", "Maximum extended leaf"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 16, "BRAND_ID", "Brand ID (BrandId)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 28, 4, "PKG_TYPE", "Package type (PkgType)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 0, 1, "LAHF_SAHF", "LAHF and SAHF instructions in 64-bit mode (LahfSahf)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 1, 1, "CMP_LEGACY", "Core multi-processing legacy mode (CmpLegacy)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 2, 1, "SVM", "Secure Virtual Mode feature (SVM)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 3, 1, "EXT_APIC_SPACE", "Extended APIC space (ExtApicSpace)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 4, 1, "ALT_MOV_CR8", "LOCK MOV CR0 means MOV CR8 (AltMovCr8)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 5, 1, "ABM", "LZCNT instruction support (ABM)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 6, 1, "SSE4A", "EXTRQ, INSERTQ, MOVNTSS, and MOVNTSD instructions (SSE4A)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 7, 1, "MISALIGN_SSE", "Misaligned SSE mode support (MisAlignSse)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 8, 1, "PREFETCHW", "PREFETCH and PREFETCHW instructions (3DNowPrefetch)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 9, 1, "OSVW", "OS visible workaround (OSVW)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 10, 1, "IBS", "Instruction based sampling (IBS)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 11, 1, "XOP", "Extended operation support (XOP)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 12, 1, "SKINIT", "SKINIT and STGI are support (SKINIT)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 13, 1, "WDT", "Watchdog Timer support"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 15, 1, "LWP", "Lightweight profiling support (LWP)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 16, 1, "FMA4", "Four-operand FMA instruction support (FMA4)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 17, 1, "TCE", "Translation Cache Extension support (TCE)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 21, 1, "TBM", "Trailing bit manipulation instruction support (TBM)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 22, 1, "TOPOLOGY_EXT", "Topology extensions support"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 23, 1, "PERF_CTR_EXT_CORE", "Processor performance counter extensions (PerfCtrExtCore)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 24, 1, "PERF_CTR_EXT_NB", "NB performance counter extensions support (PerfCtrExtNB)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 26, 1, "DATA_BKPT_EXT", "Data Breakpoint Extension (DataBkptExt)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 27, 1, "PERF_TSC", "Performance Time-Stamp Counter (PerfTsc)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 28, 1, "PERF_CTR_EXT_LLC", "L3 Performance Counter Extensions (PerfCtrExtLLC)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 29, 1, "MONITORX", "MWAITX and MONITORX capability (MONITORX)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 30, 1, "ADDR_MASK_EXT", "Breakpoint Addressing Masking (AddrMaskExt)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 0, 1, "FPU", "x87 floating-point unit on-chip (FPU)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 1, 1, "VME", "Virtual-mode enhancements (VME)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 2, 1, "DE", "Debugging extensions (DE)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 3, 1, "PSE", "Page-size extensions (PSE)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 4, 1, "TSC", "Time stamp counter (TSC)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 5, 1, "MSR", "AMD model-specific registers (MSR)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 6, 1, "PAE", "Physical-address extensions (PAE)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 7, 1, "MCE", "Machine check exception (MCE)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 8, 1, "CX8", "CMPXCHG8B instruction (CMPXCHG8B)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 9, 1, "APIC", "Advanced programmable interrupt controller (APIC)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 11, 1, "SYSCALL", "SYSCALL and SYSRET instructions (SysCallSysRet)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 12, 1, "MTRR", "Memory-type range registers (MTRR)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 13, 1, "PGE", "Page global extension (PGE)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 14, 1, "MCA", "Machine check architecture (MCA)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 15, 1, "CMOV", "Conditional move instructions (CMOV)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 16, 1, "PAT", "Page attribute table (PAT)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 17, 1, "PSE36", "Page-size extensions (PSE36)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 20, 1, "NX", "No-execute page protection (NX)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 22, 1, "MMX_EXT", "AMD extensions to MMX instructions (MmxExt)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 23, 1, "MMX", "MMX instructions (MMX)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 24, 1, "FXSR", "FXSAVE and FXRSTOR instructions (FXSR)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 25, 1, "FFXSR", "FXSAVE and FXRSTOR instruction optimizations (FFXSR)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 26, 1, "PAGE_1GB", "1-GB large page support (Page1GB)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 27, 1, "RDTSCP", "RDTSCP instruction (RDTSCP)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 29, 1, "LM", "Long mode (LM)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 30, 1, "AMD_3DNOW_EXT", "AMD extensions to 3DNow! instructions (3DNowExt)"},
+    {0x80000001u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 31, 1, "AMD_3DNOW", "3DNow! instructions (3DNow)"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 8, "L1_ITLB_2M_ENTRIES", "Instruction TLB entries for 2MB and 4MB pages"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 8, 8, "L1_ITLB_2M_ASSOC", "Instruction TLB associativity for 2MB and 4MB pages"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 16, 8, "L1_DTLB_2M_ENTRIES", "Data TLB entries for 2MB and 4MB pages"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 24, 8, "L1_DTLB_2M_ASSOC", "Data TLB associativity for 2MB and 4MB pages"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 8, "L1_ITLB_4K_ENTRIES", "Instruction TLB entries for 4KB pages"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 8, 8, "L1_ITLB_4K_ASSOC", "Instruction TLB associativity for 4KB pages"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 16, 8, "L1_DTLB_4K_ENTRIES", "Data TLB entries for 4KB pages"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 24, 8, "L1_DTLB_4K_ASSOC", "Data TLB associativity for 4KB pages"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 0, 8, "L1D_LINE_SIZE", "L1 data cache line size in bytes"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 8, 8, "L1D_LINES_PER_TAG", "L1 data cache lines per tag"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 16, 8, "L1D_ASSOC", "L1 data cache associativity"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 24, 8, "L1D_SIZE_KB", "L1 data cache size in KB"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 0, 8, "L1I_LINE_SIZE", "L1 instruction cache line size in bytes"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 8, 8, "L1I_LINES_PER_TAG", "L1 instruction cache lines per tag"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 16, 8, "L1I_ASSOC", "L1 instruction cache associativity"},
+    {0x80000005u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 24, 8, "L1I_SIZE_KB", "L1 instruction cache size in KB"},
+    {0x80000006u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 0, 8, "L2_LINE_SIZE", "L2 cache line size in bytes"},
+    {0x80000006u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 8, 4, "L2_LINES_PER_TAG", "L2 cache lines per tag"},
+    {0x80000006u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 12, 4, "L2_ASSOC", "L2 associativity field"},
+    {0x80000006u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 16, 16, "L2_SIZE_KB", "L2 cache size in KB"},
+    {0x80000006u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 0, 8, "L3_LINE_SIZE", "L3 cache line size in bytes"},
+    {0x80000006u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 8, 4, "L3_LINES_PER_TAG", "L3 cache lines per tag"},
+    {0x80000006u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 12, 4, "L3_ASSOC", "L3 associativity field"},
+    {0x80000006u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 18, 14, "L3_SIZE_512KB", "L3 cache size in 512KB units"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 1, "MCA_OVERFLOW_RECOV", "MCA overflow recovery support (McaOverflowRecov)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 1, 1, "SUCCOR", "Software uncorrectable error containment and recovery (SUCCOR)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 2, 1, "HWA", "Hardware assert support (HWA)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 3, 1, "SCALABLE_MCA", "Scalable MCA (ScalableMca)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 0, 32, "PWR_SAMPLE_RATIO", "Compute unit power sample time ratio (CpuPwrSampleTimeRatio)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 0, 1, "TS", "Temperature sensor (TS)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 1, 1, "FID", "Frequency ID control (FID)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 2, 1, "VID", "Voltage ID control (VID)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 3, 1, "TTP", "THERMTRIP (TTP)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 4, 1, "TM", "Hardware thermal control (HTC)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 6, 1, "STEPS_100MHZ", "100 MHz multiplier control (100MHzSteps)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 7, 1, "HW_PSTATE", "Hardware P-state control (HwPstate)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 8, 1, "INVARIANT_TSC", "TSC invariant across P-states, C-states and stop grant (TscInvariant)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 9, 1, "CPB", "Core performance boost (CPB)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 10, 1, "EFF_FREQ_RO", "Read-only effective frequency interface (EffFreqRO)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 11, 1, "PROC_FEEDBACK", "Processor feedback interface (ProcFeedbackInterface)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 12, 1, "PROC_POWER_REPORTING", "Core power reporting interface (ProcPowerReporting)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 13, 1, "CONNECTED_STANDBY", "Connected standby (ConnectedStandby)"},
+    {0x80000007u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 14, 1, "RAPL", "Running average power limit (RAPL)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 8, "PHYS_ADDR_BITS", "Physical address bits"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 8, 8, "LINEAR_ADDR_BITS", "Linear address bits"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 16, 8, "GUEST_PHYS_ADDR_BITS", "Guest physical address bits (0 means same as physical)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 1, "CLZERO", "CLZERO instruction (CLZERO)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 1, 1, "INST_RET_CNT_MSR", "Instruction retired counter MSR (InstRetCntMsr)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 2, 1, "RSTR_FP_ERR_PTRS", "FP error pointers restored by XRSTOR (RstrFpErrPtrs)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 3, 1, "INVLPGB", "INVLPGB and TLBSYNC instructions (INVLPGB)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 4, 1, "RDPRU", "RDPRU instruction (RDPRU)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 6, 1, "MBE", "Memory bandwidth enforcement (MBE)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 8, 1, "MCOMMIT", "MCOMMIT instruction (MCOMMIT)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 9, 1, "WBNOINVD", "WBNOINVD instruction (WBNOINVD)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 12, 1, "IBPB", "Indirect branch prediction barrier (IBPB)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 13, 1, "INT_WBINVD", "WBINVD and WBNOINVD are interruptible (INT_WBINVD)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 14, 1, "IBRS", "Indirect branch restricted speculation (IBRS)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 15, 1, "STIBP", "Single thread indirect branch predictor (STIBP)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 16, 1, "IBRS_ALWAYS_ON", "IBRS always on mode preferred (IbrsAlwaysOn)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 17, 1, "STIBP_ALWAYS_ON", "STIBP always on mode preferred (StibpAlwaysOn)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 18, 1, "IBRS_PREFERRED", "IBRS preferred over software solution (IbrsPreferred)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 19, 1, "IBRS_SAME_MODE", "IBRS provides same mode protection (IbrsSameMode)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 20, 1, "EFER_LMSLE_UNSUPPORTED", "EFER.LMSLE is unsupported (EferLmsleUnsupported)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 21, 1, "INVLPGB_NESTED", "INVLPGB support for invalidating guest nested translations"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 24, 1, "SSBD", "Speculative store bypass disable (SSBD)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 25, 1, "VIRT_SSBD", "VIRT_SPEC_CTL speculative store bypass disable (VirtSsbd)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 26, 1, "SSBD_NOT_REQUIRED", "SSBD not needed on this processor (SsbdNotRequired)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 27, 1, "CPPC", "Collaborative processor performance control (CPPC)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 28, 1, "PSFD", "Predictive store forward disable (PSFD)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 29, 1, "BTC_NO", "Not affected by branch type confusion (BTC_NO)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 30, 1, "IBPB_RET", "IBPB clears return address predictor (IBPB_RET)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 31, 1, "BRS", "Branch sampling (BRS)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 0, 8, "NC", "Number of physical threads in the package (minus 1)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 12, 4, "APIC_ID_SIZE", "APIC ID size (ApicIdSize)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 16, 2, "PERF_TSC_SIZE", "Performance time-stamp counter size (PerfTscSize)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 0, 16, "INVLPGB_COUNT_MAX", "Maximum page count for INVLPGB (InvlpgbCountMax)"},
+    {0x80000008u, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 16, 10, "MAX_RDPRU_ID", "Maximum ECX value recognized by RDPRU (MaxRdpruID)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 8, "SVM_REV", "SVM revision number (SvmRev)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 32, "NASID", "Number of address space identifiers (NASID)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 0, 1, "NP", "Nested paging (NP)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 1, 1, "LBR_VIRT", "LBR virtualization (LbrVirt)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 2, 1, "SVML", "SVM lock (SVML)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 3, 1, "NRIPS", "NRIP save on #VMEXIT (NRIPS)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 4, 1, "TSC_RATE_MSR", "MSR based TSC rate control (TscRateMsr)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 5, 1, "VMCB_CLEAN", "VMCB clean bits (VmcbClean)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 6, 1, "FLUSH_BY_ASID", "Flush by ASID (FlushByAsid)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 7, 1, "DECODE_ASSISTS", "Decode assists (DecodeAssists)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 8, 1, "PMC_VIRT", "Performance counter virtualization (PmcVirt)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 10, 1, "PAUSE_FILTER", "PAUSE intercept filter (PauseFilter)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 12, 1, "PAUSE_FILTER_THRESHOLD", "PAUSE filter threshold (PauseFilterThreshold)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 13, 1, "AVIC", "Advanced virtual interrupt controller (AVIC)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 15, 1, "VMSAVE_VIRT", "Virtualized VMSAVE/VMLOAD (VMSAVEvirt)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 16, 1, "VGIF", "Virtualized global interrupt flag (VGIF)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 17, 1, "GMET", "Guest mode execute trap (GMET)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 18, 1, "X2AVIC", "x2APIC virtualization (x2AVIC)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 19, 1, "SSS_CHECK", "Supervisor shadow stack restrictions (SSSCheck)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 20, 1, "SPEC_CTRL", "SPEC_CTRL virtualization (SpecCtrl)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 21, 1, "ROGPT", "Read-only guest page table support (ROGPT)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 23, 1, "HOST_MCE_OVERRIDE", "Guest machine check override (HOST_MCE_OVERRIDE)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 24, 1, "TLBI_CTL", "INVLPGB/TLBSYNC hypervisor enable (TlbiCtl)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 25, 1, "VNMI", "Virtual NMI (VNMI)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 26, 1, "IBS_VIRT", "IBS virtualization (IbsVirt)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 27, 1, "EXT_LVT_AVIC_ACCESS", "Extended LVT AVIC access changes (ExtLvtAvicAccessChg)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 28, 1, "NESTED_VMCB_ADDR_CHK", "VMCB address check for nested guests (NestedVirtVmcbAddrChk)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 29, 1, "BUS_LOCK_THRESHOLD", "Bus lock threshold (BusLockThreshold)"},
+    {0x8000000Au, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 30, 1, "IDLE_HLT_INTERCEPT", "Idle HLT intercept (IdleHltIntercept)"},
+    {0x8000001Du, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 5, "CACHE_TYPE", "Cache type (1 data, 2 instruction, 3 unified)"},
+    {0x8000001Du, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 5, 3, "CACHE_LEVEL", "Cache level"},
+    {0x8000001Du, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 8, 1, "SELF_INITIALIZING", "Self initializing cache level"},
+    {0x8000001Du, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 9, 1, "FULLY_ASSOCIATIVE", "Fully associative cache"},
+    {0x8000001Du, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 14, 12, "SHARING_THREADS", "Logical processors sharing this cache (minus 1)"},
+    {0x8000001Du, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 12, "LINE_SIZE", "Cache line size in bytes (minus 1)"},
+    {0x8000001Du, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 12, 10, "PARTITIONS", "Physical line partitions (minus 1)"},
+    {0x8000001Du, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 22, 10, "WAYS", "Ways of associativity (minus 1)"},
+    {0x8000001Du, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 0, 32, "SETS", "Number of sets (minus 1)"},
+    {0x8000001Du, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 0, 1, "WBINVD", "WBINVD/INVD does not invalidate lower level caches of other threads"},
+    {0x8000001Du, 0xFFFFFFFFu, Vendor::Amd, Register::Edx, 1, 1, "INCLUSIVE", "Cache is inclusive of lower cache levels"},
+    {0x8000001Eu, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 32, "EXTENDED_APIC_ID", "Extended APIC ID"},
+    {0x8000001Eu, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 8, "CORE_ID", "Core ID"},
+    {0x8000001Eu, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 8, 8, "THREADS_PER_CORE", "Threads per core (minus 1)"},
+    {0x8000001Eu, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 0, 8, "NODE_ID", "Node ID"},
+    {0x8000001Eu, 0xFFFFFFFFu, Vendor::Amd, Register::Ecx, 8, 3, "NODES_PER_PROCESSOR", "Nodes per processor (minus 1)"},
+    {0x8000001Fu, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 1, "SME", "Secure memory encryption (SME)"},
+    {0x8000001Fu, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 1, 1, "SEV", "Secure encrypted virtualization (SEV)"},
+    {0x8000001Fu, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 2, 1, "PAGE_FLUSH_MSR", "Page flush MSR (PageFlushMsr)"},
+    {0x8000001Fu, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 3, 1, "SEV_ES", "SEV encrypted state (SEV-ES)"},
+    {0x8000001Fu, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 4, 1, "SEV_SNP", "SEV secure nested paging (SEV-SNP)"},
+    {0x8000001Fu, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 5, 1, "VMPL", "VM permission levels (VMPL)"},
+    {0x8000001Fu, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 6, "C_BIT", "Page table bit used to mark pages encrypted (C-bit)"},
+    {0x8000001Fu, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 6, 6, "PHYS_ADDR_REDUCTION", "Physical address bit reduction when memory encryption is enabled"},
+    {0x80000021u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 1, "NO_NESTED_DATA_BP", "No nested data breakpoints (NoNestedDataBp)"},
+    {0x80000021u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 1, 1, "FSGS_NON_SERIALIZING", "WRMSR to FS_BASE, GS_BASE and KernelGSBase is non-serializing"},
+    {0x80000021u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 2, 1, "LFENCE_SERIALIZING", "LFENCE is always dispatch serializing (LFenceAlwaysSerializing)"},
+    {0x80000021u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 6, 1, "NULL_SELECTOR_CLEARS_BASE", "Null segment selector loads clear the base (NullSelectClearsBase)"},
+    {0x80000021u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 7, 1, "UPPER_ADDRESS_IGNORE", "Upper address ignore (UpperAddressIgnore)"},
+    {0x80000021u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 8, 1, "AUTOMATIC_IBRS", "Automatic IBRS (AutomaticIBRS)"},
+    {0x80000021u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 10, 1, "FSRS", "Fast short REP STOSB (FSRS)"},
+    {0x80000021u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 11, 1, "FSRC", "Fast short REPE CMPSB (FSRC)"},
+    {0x80000021u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 13, 1, "PREFETCH_CTL_MSR", "Prefetch control MSR (PrefetchCtlMsr)"},
+    {0x80000021u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 17, 1, "CPUID_USER_DIS", "CPUID disable for non-privileged software (CpuidUserDis)"},
+    {0x80000021u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 18, 1, "EPSF", "Enhanced predictive store forwarding (EPSF)"},
+    {0x80000022u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 0, 1, "PERFMON_V2", "Performance monitoring version 2 (PerfMonV2)"},
+    {0x80000022u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 1, 1, "LBR_STACK", "Last branch record stack (LbrStack, LbrExtV2)"},
+    {0x80000022u, 0xFFFFFFFFu, Vendor::Amd, Register::Eax, 2, 1, "LBR_PMC_FREEZE", "Freezing the LBR stack and PMCs on overflow (LbrAndPmcFreeze)"},
+    {0x80000022u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 0, 4, "NUM_PERF_CTR_CORE", "Number of core performance counters (NumPerfCtrCore)"},
+    {0x80000022u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 4, 6, "LBR_V2_STACK_SIZE", "Number of LBR stack entries (LbrV2StackSz)"},
+    {0x80000022u, 0xFFFFFFFFu, Vendor::Amd, Register::Ebx, 10, 6, "NUM_PERF_CTR_NB", "Number of northbridge performance counters (NumPerfCtrNB)"},
+};
+
+inline constexpr std::size_t kFieldCount = sizeof(kFields) / sizeof(kFields[0]);
+
+// Returns the field holding a bit of a register, or nullptr for reserved bits.
+inline const Field *find(Vendor vendor, std::uint32_t leaf, std::uint32_t subleaf, Register reg, unsigned bit) {
+    const Field *any = nullptr;
+    for (const Field &field : kFields) {
+        if (field.vendor != vendor || field.reg != reg || !field.covers(leaf, subleaf))
+            continue;
+        if (bit < field.lsb || bit >= field.lsb + field.width)
+            continue;
+        if (field.subleaf == subleaf)
+            return &field;
+        any = &field;
+    }
+    return any;
+}
+
+// On-disk layout of featuredb.bin for loaders that map the blob instead of compiling the table in.
+struct BlobHeader {
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t header_size;
+    std::uint32_t source_crc;
+    std::uint32_t register_count;
+    std::uint32_t register_offset;
+    std::uint32_t field_count;
+    std::uint32_t field_offset;
+    std::uint32_t string_offset;
+    std::uint32_t string_size;
+};
+
+struct BlobRegister {
+    std::uint32_t leaf;
+    std::uint32_t subleaf;
+    std::uint8_t vendor;
+    std::uint8_t reg;
+    std::uint16_t field_count;
+    std::uint32_t first_field;
+};
+
+struct BlobField {
+    std::uint8_t lsb;
+    std::uint8_t width;
+    std::uint16_t reserved;
+    std::uint32_t mnemonic_offset;
+    std::uint32_t name_offset;
+};
+
+static_assert(sizeof(BlobHeader) == 36, "BlobHeader does not match featuredb.bin");
+static_assert(sizeof(BlobRegister) == 16, "BlobRegister does not match featuredb.bin");
+static_assert(sizeof(BlobField) == 12, "BlobField does not match featuredb.bin");
+
+// Named accessors, e.g. intel::leaf_00000007_0::AVX2.extract(ebx)
+namespace amd::leaf_00000000 {
+inline constexpr const Field &MAX_BASIC_LEAF = kFields[350];
+} // namespace amd::leaf_00000000
+
+namespace amd::leaf_00000001 {
+inline constexpr const Field &STEPPING_ID = kFields[351];
+inline constexpr const Field &MODEL_ID = kFields[352];
+inline constexpr const Field &FAMILY_ID = kFields[353];
+inline constexpr const Field &PROCESSOR_TYPE = kFields[354];
+inline constexpr const Field &EXTENDED_MODEL_ID = kFields[355];
+inline constexpr const Field &EXTENDED_FAMILY_ID = kFields[356];
+inline constexpr const Field &BRAND_ID = kFields[357];
+inline constexpr const Field &CLFLUSH_LINE_SIZE = kFields[358];
+inline constexpr const Field &LOGICAL_PROCESSORS = kFields[359];
+inline constexpr const Field &INITIAL_APIC_ID = kFields[360];
+inline constexpr const Field &SSE3 = kFields[361];
+inline constexpr const Field &PCLMULQDQ = kFields[362];
+inline constexpr const Field &MONITOR = kFields[363];
+inline constexpr const Field &SSSE3 = kFields[364];
+inline constexpr const Field &FMA = kFields[365];
+inline constexpr const Field &CMPXCHG16B = kFields[366];
+inline constexpr const Field &SSE4_1 = kFields[367];
+inline constexpr const Field &SSE4_2 = kFields[368];
+inline constexpr const Field &X2APIC = kFields[369];
+inline constexpr const Field &MOVBE = kFields[370];
+inline constexpr const Field &POPCNT = kFields[371];
+inline constexpr const Field &AES = kFields[372];
+inline constexpr const Field &XSAVE = kFields[373];
+inline constexpr const Field &OSXSAVE = kFields[374];
+inline constexpr const Field &AVX = kFields[375];
+inline constexpr const Field &F16C = kFields[376];
+inline constexpr const Field &RDRAND = kFields[377];
+inline constexpr const Field &HYPERVISOR = kFields[378];
+inline constexpr const Field &FPU = kFields[379];
+inline constexpr const Field &VME = kFields[380];
+inline constexpr const Field &DE = kFields[381];
+inline constexpr const Field &PSE = kFields[382];
+inline constexpr const Field &TSC = kFields[383];
+inline constexpr const Field &MSR = kFields[384];
+inline constexpr const Field &PAE = kFields[385];
+inline constexpr const Field &MCE = kFields[386];
+inline constexpr const Field &CX8 = kFields[387];
+inline constexpr const Field &APIC = kFields[388];
+inline constexpr const Field &SEP = kFields[389];
+inline constexpr const Field &MTRR = kFields[390];
+inline constexpr const Field &PGE = kFields[391];
+inline constexpr const Field &MCA = kFields[392];
+inline constexpr const Field &CMOV = kFields[393];
+inline constexpr const Field &PAT = kFields[394];
+inline constexpr const Field &PSE36 = kFields[395];
+inline constexpr const Field &CLFSH = kFields[396];
+inline constexpr const Field &MMX = kFields[397];
+inline constexpr const Field &FXSR = kFields[398];
+inline constexpr const Field &SSE = kFields[399];
+inline constexpr const Field &SSE2 = kFields[400];
+inline constexpr const Field &HTT = kFields[401];
+} // namespace amd::leaf_00000001
+
+namespace amd::leaf_00000005 {
+inline constexpr const Field &MIN_MONITOR_LINE = kFields[402];
+inline constexpr const Field &MAX_MONITOR_LINE = kFields[403];
+inline constexpr const Field &EMX = kFields[404];
+inline constexpr const Field &IBE = kFields[405];
+} // namespace amd::leaf_00000005
+
+namespace amd::leaf_00000006 {
+inline constexpr const Field &ARAT = kFields[406];
+inline constexpr const Field &EFF_FREQ = kFields[407];
+} // namespace amd::leaf_00000006
+
+namespace amd::leaf_00000007_0 {
+inline constexpr const Field &MAX_SUBLEAF = kFields[408];
+inline constexpr const Field &FSGSBASE = kFields[409];
+inline constexpr const Field &BMI1 = kFields[410];
+inline constexpr const Field &AVX2 = kFields[411];
+inline constexpr const Field &SMEP = kFields[412];
+inline constexpr const Field &BMI2 = kFields[413];
+inline constexpr const Field &ERMS = kFields[414];
+inline constexpr const Field &INVPCID = kFields[415];
+inline constexpr const Field &PQM = kFields[416];
+inline constexpr const Field &PQE = kFields[417];
+inline constexpr const Field &AVX512F = kFields[418];
+inline constexpr const Field &AVX512DQ = kFields[419];
+inline constexpr const Field &RDSEED = kFields[420];
+inline constexpr const Field &ADX = kFields[421];
+inline constexpr const Field &SMAP = kFields[422];
+inline constexpr const Field &AVX512_IFMA = kFields[423];
+inline constexpr const Field &CLFLUSHOPT = kFields[424];
+inline constexpr const Field &CLWB = kFields[425];
+inline constexpr const Field &AVX512CD = kFields[426];
+inline constexpr const Field &SHA = kFields[427];
+inline constexpr const Field &AVX512BW = kFields[428];
+inline constexpr const Field &AVX512VL = kFields[429];
+inline constexpr const Field &AVX512_VBMI = kFields[430];
+inline constexpr const Field &UMIP = kFields[431];
+inline constexpr const Field &PKU = kFields[432];
+inline constexpr const Field &OSPKE = kFields[433];
+inline constexpr const Field &AVX512_VBMI2 = kFields[434];
+inline constexpr const Field &CET_SS = kFields[435];
+inline constexpr const Field &GFNI = kFields[436];
+inline constexpr const Field &VAES = kFields[437];
+inline constexpr const Field &VPCLMULQDQ = kFields[438];
+inline constexpr const Field &AVX512_VNNI = kFields[439];
+inline constexpr const Field &AVX512_BITALG = kFields[440];
+inline constexpr const Field &AVX512_VPOPCNTDQ = kFields[441];
+inline constexpr const Field &LA57 = kFields[442];
+inline constexpr const Field &RDPID = kFields[443];
+inline constexpr const Field &BUS_LOCK_DETECT = kFields[444];
+inline constexpr const Field &MOVDIRI = kFields[445];
+inline constexpr const Field &MOVDIR64B = kFields[446];
+inline constexpr const Field &FSRM = kFields[447];
+inline constexpr const Field &AVX512_VP2INTERSECT = kFields[448];
+} // namespace amd::leaf_00000007_0
+
+namespace amd::leaf_00000007_1 {
+inline constexpr const Field &AVX_VNNI = kFields[449];
+inline constexpr const Field &AVX512_BF16 = kFields[450];
+} // namespace amd::leaf_00000007_1
+
+namespace amd::leaf_0000000B {
+inline constexpr const Field &APIC_ID_SHIFT = kFields[451];
+inline constexpr const Field &LEVEL_PROCESSORS = kFields[452];
+inline constexpr const Field &LEVEL_NUMBER = kFields[453];
+inline constexpr const Field &LEVEL_TYPE = kFields[454];
+inline constexpr const Field &X2APIC_ID = kFields[455];
+} // namespace amd::leaf_0000000B
+
+namespace amd::leaf_0000000D_0 {
+inline constexpr const Field &X87 = kFields[456];
+inline constexpr const Field &SSE = kFields[457];
+inline constexpr const Field &AVX = kFields[458];
+inline constexpr const Field &BNDREGS = kFields[459];
+inline constexpr const Field &BNDCSR = kFields[460];
+inline constexpr const Field &OPMASK = kFields[461];
+inline constexpr const Field &ZMM_HI256 = kFields[462];
+inline constexpr const Field &HI16_ZMM = kFields[463];
+inline constexpr const Field &PKRU = kFields[464];
+inline constexpr const Field &XTILECFG = kFields[465];
+inline constexpr const Field &XTILEDATA = kFields[466];
+inline constexpr const Field &ENABLED_SIZE = kFields[467];
+inline constexpr const Field &MAX_SIZE = kFields[468];
+} // namespace amd::leaf_0000000D_0
+
+namespace amd::leaf_0000000D_1 {
+inline constexpr const Field &XSAVEOPT = kFields[469];
+inline constexpr const Field &XSAVEC = kFields[470];
+inline constexpr const Field &XGETBV_ECX1 = kFields[471];
+inline constexpr const Field &XSAVES = kFields[472];
+inline constexpr const Field &XFD = kFields[473];
+} // namespace amd::leaf_0000000D_1
+
+namespace amd::leaf_40000000 {
+inline constexpr const Field &MAX_HYPERVISOR_LEAF = kFields[474];
+} // namespace amd::leaf_40000000
+
+namespace amd::leaf_80000000 {
+inline constexpr const Field &MAX_EXTENDED_LEAF = kFields[475];
+} // namespace amd::leaf_80000000
+
+namespace amd::leaf_80000001 {
+inline constexpr const Field &BRAND_ID = kFields[476];
+inline constexpr const Field &PKG_TYPE = kFields[477];
+inline constexpr const Field &LAHF_SAHF = kFields[478];
+inline constexpr const Field &CMP_LEGACY = kFields[479];
+inline constexpr const Field &SVM = kFields[480];
+inline constexpr const Field &EXT_APIC_SPACE = kFields[481];
+inline constexpr const Field &ALT_MOV_CR8 = kFields[482];
+inline constexpr const Field &ABM = kFields[483];
+inline constexpr const Field &SSE4A = kFields[484];
+inline constexpr const Field &MISALIGN_SSE = kFields[485];
+inline constexpr const Field &PREFETCHW = kFields[486];
+inline constexpr const Field &OSVW = kFields[487];
+inline constexpr const Field &IBS = kFields[488];
+inline constexpr const Field &XOP = kFields[489];
+inline constexpr const Field &SKINIT = kFields[490];
+inline constexpr const Field &WDT = kFields[491];
+inline constexpr const Field &LWP = kFields[492];
+inline constexpr const Field &FMA4 = kFields[493];
+inline constexpr const Field &TCE = kFields[494];
+inline constexpr const Field &TBM = kFields[495];
+inline constexpr const Field &TOPOLOGY_EXT = kFields[496];
+inline constexpr const Field &PERF_CTR_EXT_CORE = kFields[497];
+inline constexpr const Field &PERF_CTR_EXT_NB = kFields[498];
+inline constexpr const Field &DATA_BKPT_EXT = kFields[499];
+inline constexpr const Field &PERF_TSC = kFields[500];
+inline constexpr const Field &PERF_CTR_EXT_LLC = kFields[501];
+inline constexpr const Field &MONITORX = kFields[502];
+inline constexpr const Field &ADDR_MASK_EXT = kFields[503];
+inline constexpr const Field &FPU = kFields[504];
+inline constexpr const Field &VME = kFields[505];
+inline constexpr const Field &DE = kFields[506];
+inline constexpr const Field &PSE = kFields[507];
+inline constexpr const Field &TSC = kFields[508];
+inline constexpr const Field &MSR = kFields[509];
+inline constexpr const Field &PAE = kFields[510];
+inline constexpr const Field &MCE = kFields[511];
+inline constexpr const Field &CX8 = kFields[512];
+inline constexpr const Field &APIC = kFields[513];
+inline constexpr const Field &SYSCALL = kFields[514];
+inline constexpr const Field &MTRR = kFields[515];
+inline constexpr const Field &PGE = kFields[516];
+inline constexpr const Field &MCA = kFields[517];
+inline constexpr const Field &CMOV = kFields[518];
+inline constexpr const Field &PAT = kFields[519];
+inline constexpr const Field &PSE36 = kFields[520];
+inline constexpr const Field &NX = kFields[521];
+inline constexpr const Field &MMX_EXT = kFields[522];
+inline constexpr const Field &MMX = kFields[523];
+inline constexpr const Field &FXSR = kFields[524];
+inline constexpr const Field &FFXSR = kFields[525];
+inline constexpr const Field &PAGE_1GB = kFields[526];
+inline constexpr const Field &RDTSCP = kFields[527];
+inline constexpr const Field &LM = kFields[528];
+inline constexpr const Field &AMD_3DNOW_EXT = kFields[529];
+inline constexpr const Field &AMD_3DNOW = kFields[530];
+} // namespace amd::leaf_80000001
+
+namespace amd::leaf_80000005 {
+inline constexpr const Field &L1_ITLB_2M_ENTRIES = kFields[531];
+inline constexpr const Field &L1_ITLB_2M_ASSOC = kFields[532];
+inline constexpr const Field &L1_DTLB_2M_ENTRIES = kFields[533];
+inline constexpr const Field &L1_DTLB_2M_ASSOC = kFields[534];
+inline constexpr const Field &L1_ITLB_4K_ENTRIES = kFields[535];
+inline constexpr const Field &L1_ITLB_4K_ASSOC = kFields[536];
+inline constexpr const Field &L1_DTLB_4K_ENTRIES = kFields[537];
+inline constexpr const Field &L1_DTLB_4K_ASSOC = kFields[538];
+inline constexpr const Field &L1D_LINE_SIZE = kFields[539];
+inline constexpr const Field &L1D_LINES_PER_TAG = kFields[540];
+inline constexpr const Field &L1D_ASSOC = kFields[541];
+inline constexpr const Field &L1D_SIZE_KB = kFields[542];
+inline constexpr const Field &L1I_LINE_SIZE = kFields[543];
+inline constexpr const Field &L1I_LINES_PER_TAG = kFields[544];
+inline constexpr const Field &L1I_ASSOC = kFields[545];
+inline constexpr const Field &L1I_SIZE_KB = kFields[546];
+} // namespace amd::leaf_80000005
+
+namespace amd::leaf_80000006 {
+inline constexpr const Field &L2_LINE_SIZE = kFields[547];
+inline constexpr const Field &L2_LINES_PER_TAG = kFields[548];
+inline constexpr const Field &L2_ASSOC = kFields[549];
+inline constexpr const Field &L2_SIZE_KB = kFields[550];
+inline constexpr const Field &L3_LINE_SIZE = kFields[551];
+inline constexpr const Field &L3_LINES_PER_TAG = kFields[552];
+inline constexpr const Field &L3_ASSOC = kFields[553];
+inline constexpr const Field &L3_SIZE_512KB = kFields[554];
+} // namespace amd::leaf_80000006
+
+namespace amd::leaf_80000007 {
+inline constexpr const Field &MCA_OVERFLOW_RECOV = kFields[555];
+inline constexpr const Field &SUCCOR = kFields[556];
+inline constexpr const Field &HWA = kFields[557];
+inline constexpr const Field &SCALABLE_MCA = kFields[558];
+inline constexpr const Field &PWR_SAMPLE_RATIO = kFields[559];
+inline constexpr const Field &TS = kFields[560];
+inline constexpr const Field &FID = kFields[561];
+inline constexpr const Field &VID = kFields[562];
+inline constexpr const Field &TTP = kFields[563];
+inline constexpr const Field &TM = kFields[564];
+inline constexpr const Field &STEPS_100MHZ = kFields[565];
+inline constexpr const Field &HW_PSTATE = kFields[566];
+inline constexpr const Field &INVARIANT_TSC = kFields[567];
+inline constexpr const Field &CPB = kFields[568];
+inline constexpr const Field &EFF_FREQ_RO = kFields[569];
+inline constexpr const Field &PROC_FEEDBACK = kFields[570];
+inline constexpr const Field &PROC_POWER_REPORTING = kFields[571];
+inline constexpr const Field &CONNECTED_STANDBY = kFields[572];
+inline constexpr const Field &RAPL = kFields[573];
+} // namespace amd::leaf_80000007
+
+namespace amd::leaf_80000008 {
+inline constexpr const Field &PHYS_ADDR_BITS = kFields[574];
+inline constexpr const Field &LINEAR_ADDR_BITS = kFields[575];
+inline constexpr const Field &GUEST_PHYS_ADDR_BITS = kFields[576];
+inline constexpr const Field &CLZERO = kFields[577];
+inline constexpr const Field &INST_RET_CNT_MSR = kFields[578];
+inline constexpr const Field &RSTR_FP_ERR_PTRS = kFields[579];
+inline constexpr const Field &INVLPGB = kFields[580];
+inline constexpr const Field &RDPRU = kFields[581];
+inline constexpr const Field &MBE = kFields[582];
+inline constexpr const Field &MCOMMIT = kFields[583];
+inline constexpr const Field &WBNOINVD = kFields[584];
+inline constexpr const Field &IBPB = kFields[585];
+inline constexpr const Field &INT_WBINVD = kFields[586];
+inline constexpr const Field &IBRS = kFields[587];
+inline constexpr const Field &STIBP = kFields[588];
+inline constexpr const Field &IBRS_ALWAYS_ON = kFields[589];
+inline constexpr const Field &STIBP_ALWAYS_ON = kFields[590];
+inline constexpr const Field &IBRS_PREFERRED = kFields[591];
+inline constexpr const Field &IBRS_SAME_MODE = kFields[592];
+inline constexpr const Field &EFER_LMSLE_UNSUPPORTED = kFields[593];
+inline constexpr const Field &INVLPGB_NESTED = kFields[594];
+inline constexpr const Field &SSBD = kFields[595];
+inline constexpr const Field &VIRT_SSBD = kFields[596];
+inline constexpr const Field &SSBD_NOT_REQUIRED = kFields[597];
+inline constexpr const Field &CPPC = kFields[598];
+inline constexpr const Field &PSFD = kFields[599];
+inline constexpr const Field &BTC_NO = kFields[600];
+inline constexpr const Field &IBPB_RET = kFields[601];
+inline constexpr const Field &BRS = kFields[602];
+inline constexpr const Field &NC = kFields[603];
+inline constexpr const Field &APIC_ID_SIZE = kFields[604];
+inline constexpr const Field &PERF_TSC_SIZE = kFields[605];
+inline constexpr const Field &INVLPGB_COUNT_MAX = kFields[606];
+inline constexpr const Field &MAX_RDPRU_ID = kFields[607];
+} // namespace amd::leaf_80000008
+
+namespace amd::leaf_8000000A {
+inline constexpr const Field &SVM_REV = kFields[608];
+inline constexpr const Field &NASID = kFields[609];
+inline constexpr const Field &NP = kFields[610];
+inline constexpr const Field &LBR_VIRT = kFields[611];
+inline constexpr const Field &SVML = kFields[612];
+inline constexpr const Field &NRIPS = kFields[613];
+inline constexpr const Field &TSC_RATE_MSR = kFields[614];
+inline constexpr const Field &VMCB_CLEAN = kFields[615];
+inline constexpr const Field &FLUSH_BY_ASID = kFields[616];
+inline constexpr const Field &DECODE_ASSISTS = kFields[617];
+inline constexpr const Field &PMC_VIRT = kFields[618];
+inline constexpr const Field &PAUSE_FILTER = kFields[619];
+inline constexpr const Field &PAUSE_FILTER_THRESHOLD = kFields[620];
+inline constexpr const Field &AVIC = kFields[621];
+inline constexpr const Field &VMSAVE_VIRT = kFields[622];
+inline constexpr const Field &VGIF = kFields[623];
+inline constexpr const Field &GMET = kFields[624];
+inline constexpr const Field &X2AVIC = kFields[625];
+inline constexpr const Field &SSS_CHECK = kFields[626];
+inline constexpr const Field &SPEC_CTRL = kFields[627];
+inline constexpr const Field &ROGPT = kFields[628];
+inline constexpr const Field &HOST_MCE_OVERRIDE = kFields[629];
+inline constexpr const Field &TLBI_CTL = kFields[630];
+inline constexpr const Field &VNMI = kFields[631];
+inline constexpr const Field &IBS_VIRT = kFields[632];
+inline constexpr const Field &EXT_LVT_AVIC_ACCESS = kFields[633];
+inline constexpr const Field &NESTED_VMCB_ADDR_CHK = kFields[634];
+inline constexpr const Field &BUS_LOCK_THRESHOLD = kFields[635];
+inline constexpr const Field &IDLE_HLT_INTERCEPT = kFields[636];
+} // namespace amd::leaf_8000000A
+
+namespace amd::leaf_8000001D {
+inline constexpr const Field &CACHE_TYPE = kFields[637];
+inline constexpr const Field &CACHE_LEVEL = kFields[638];
+inline constexpr const Field &SELF_INITIALIZING = kFields[639];
+inline constexpr const Field &FULLY_ASSOCIATIVE = kFields[640];
+inline constexpr const Field &SHARING_THREADS = kFields[641];
+inline constexpr const Field &LINE_SIZE = kFields[642];
+inline constexpr const Field &PARTITIONS = kFields[643];
+inline constexpr const Field &WAYS = kFields[644];
+inline constexpr const Field &SETS = kFields[645];
+inline constexpr const Field &WBINVD = kFields[646];
+inline constexpr const Field &INCLUSIVE = kFields[647];
+} // namespace amd::leaf_8000001D
+
+namespace amd::leaf_8000001E {
+inline constexpr const Field &EXTENDED_APIC_ID = kFields[648];
+inline constexpr const Field &CORE_ID = kFields[649];
+inline constexpr const Field &THREADS_PER_CORE = kFields[650];
+inline constexpr const Field &NODE_ID = kFields[651];
+inline constexpr const Field &NODES_PER_PROCESSOR = kFields[652];
+} // namespace amd::leaf_8000001E
+
+namespace amd::leaf_8000001F {
+inline constexpr const Field &SME = kFields[653];
+inline constexpr const Field &SEV = kFields[654];
+inline constexpr const Field &PAGE_FLUSH_MSR = kFields[655];
+inline constexpr const Field &SEV_ES = kFields[656];
+inline constexpr const Field &SEV_SNP = kFields[657];
+inline constexpr const Field &VMPL = kFields[658];
+inline constexpr const Field &C_BIT = kFields[659];
+inline constexpr const Field &PHYS_ADDR_REDUCTION = kFields[660];
+} // namespace amd::leaf_8000001F
+
+namespace amd::leaf_80000021 {
+inline constexpr const Field &NO_NESTED_DATA_BP = kFields[661];
+inline constexpr const Field &FSGS_NON_SERIALIZING = kFields[662];
+inline constexpr const Field &LFENCE_SERIALIZING = kFields[663];
+inline constexpr const Field &NULL_SELECTOR_CLEARS_BASE = kFields[664];
+inline constexpr const Field &UPPER_ADDRESS_IGNORE = kFields[665];
+inline constexpr const Field &AUTOMATIC_IBRS = kFields[666];
+inline constexpr const Field &FSRS = kFields[667];
+inline constexpr const Field &FSRC = kFields[668];
+inline constexpr const Field &PREFETCH_CTL_MSR = kFields[669];
+inline constexpr const Field &CPUID_USER_DIS = kFields[670];
+inline constexpr const Field &EPSF = kFields[671];
+} // namespace amd::leaf_80000021
+
+namespace amd::leaf_80000022 {
+inline constexpr const Field &PERFMON_V2 = kFields[672];
+inline constexpr const Field &LBR_STACK = kFields[673];
+inline constexpr const Field &LBR_PMC_FREEZE = kFields[674];
+inline constexpr const Field &NUM_PERF_CTR_CORE = kFields[675];
+inline constexpr const Field &LBR_V2_STACK_SIZE = kFields[676];
+inline constexpr const Field &NUM_PERF_CTR_NB = kFields[677];
+} // namespace amd::leaf_80000022
+
+namespace intel::leaf_00000000 {
+inline constexpr const Field &MAX_BASIC_LEAF = kFields[0];
+} // namespace intel::leaf_00000000
+
+namespace intel::leaf_00000001 {
+inline constexpr const Field &STEPPING_ID = kFields[1];
+inline constexpr const Field &MODEL_ID = kFields[2];
+inline constexpr const Field &FAMILY_ID = kFields[3];
+inline constexpr const Field &PROCESSOR_TYPE = kFields[4];
+inline constexpr const Field &EXTENDED_MODEL_ID = kFields[5];
+inline constexpr const Field &EXTENDED_FAMILY_ID = kFields[6];
+inline constexpr const Field &BRAND_INDEX = kFields[7];
+inline constexpr const Field &CLFLUSH_LINE_SIZE = kFields[8];
+inline constexpr const Field &LOGICAL_PROCESSORS = kFields[9];
+inline constexpr const Field &INITIAL_APIC_ID = kFields[10];
+inline constexpr const Field &SSE3 = kFields[11];
+inline constexpr const Field &PCLMULQDQ = kFields[12];
+inline constexpr const Field &DTES64 = kFields[13];
+inline constexpr const Field &MONITOR = kFields[14];
+inline constexpr const Field &DS_CPL = kFields[15];
+inline constexpr const Field &VMX = kFields[16];
+inline constexpr const Field &SMX = kFields[17];
+inline constexpr const Field &EST = kFields[18];
+inline constexpr const Field &TM2 = kFields[19];
+inline constexpr const Field &SSSE3 = kFields[20];
+inline constexpr const Field &CNXT_ID = kFields[21];
+inline constexpr const Field &SDBG = kFields[22];
+inline constexpr const Field &FMA = kFields[23];
+inline constexpr const Field &CMPXCHG16B = kFields[24];
+inline constexpr const Field &XTPR = kFields[25];
+inline constexpr const Field &PDCM = kFields[26];
+inline constexpr const Field &PCID = kFields[27];
+inline constexpr const Field &DCA = kFields[28];
+inline constexpr const Field &SSE4_1 = kFields[29];
+inline constexpr const Field &SSE4_2 = kFields[30];
+inline constexpr const Field &X2APIC = kFields[31];
+inline constexpr const Field &MOVBE = kFields[32];
+inline constexpr const Field &POPCNT = kFields[33];
+inline constexpr const Field &TSC_DEADLINE = kFields[34];
+inline constexpr const Field &AES = kFields[35];
+inline constexpr const Field &XSAVE = kFields[36];
+inline constexpr const Field &OSXSAVE = kFields[37];
+inline constexpr const Field &AVX = kFields[38];
+inline constexpr const Field &F16C = kFields[39];
+inline constexpr const Field &RDRAND = kFields[40];
+inline constexpr const Field &HYPERVISOR = kFields[41];
+inline constexpr const Field &FPU = kFields[42];
+inline constexpr const Field &VME = kFields[43];
+inline constexpr const Field &DE = kFields[44];
+inline constexpr const Field &PSE = kFields[45];
+inline constexpr const Field &TSC = kFields[46];
+inline constexpr const Field &MSR = kFields[47];
+inline constexpr const Field &PAE = kFields[48];
+inline constexpr const Field &MCE = kFields[49];
+inline constexpr const Field &CX8 = kFields[50];
+inline constexpr const Field &APIC = kFields[51];
+inline constexpr const Field &SEP = kFields[52];
+inline constexpr const Field &MTRR = kFields[53];
+inline constexpr const Field &PGE = kFields[54];
+inline constexpr const Field &MCA = kFields[55];
+inline constexpr const Field &CMOV = kFields[56];
+inline constexpr const Field &PAT = kFields[57];
+inline constexpr const Field &PSE36 = kFields[58];
+inline constexpr const Field &PSN = kFields[59];
+inline constexpr const Field &CLFSH = kFields[60];
+inline constexpr const Field &DS = kFields[61];
+inline constexpr const Field &ACPI = kFields[62];
+inline constexpr const Field &MMX = kFields[63];
+inline constexpr const Field &FXSR = kFields[64];
+inline constexpr const Field &SSE = kFields[65];
+inline constexpr const Field &SSE2 = kFields[66];
+inline constexpr const Field &SS = kFields[67];
+inline constexpr const Field &HTT = kFields[68];
+inline constexpr const Field &TM = kFields[69];
+inline constexpr const Field &PBE = kFields[70];
+} // namespace intel::leaf_00000001
+
+namespace intel::leaf_00000004 {
+inline constexpr const Field &CACHE_TYPE = kFields[71];
+inline constexpr const Field &CACHE_LEVEL = kFields[72];
+inline constexpr const Field &SELF_INITIALIZING = kFields[73];
+inline constexpr const Field &FULLY_ASSOCIATIVE = kFields[74];
+inline constexpr const Field &SHARING_THREADS = kFields[75];
+inline constexpr const Field &PACKAGE_CORES = kFields[76];
+inline constexpr const Field &LINE_SIZE = kFields[77];
+inline constexpr const Field &PARTITIONS = kFields[78];
+inline constexpr const Field &WAYS = kFields[79];
+inline constexpr const Field &SETS = kFields[80];
+inline constexpr const Field &WBINVD = kFields[81];
+inline constexpr const Field &INCLUSIVE = kFields[82];
+inline constexpr const Field &COMPLEX_INDEXING = kFields[83];
+} // namespace intel::leaf_00000004
+
+namespace intel::leaf_00000005 {
+inline constexpr const Field &MIN_MONITOR_LINE = kFields[84];
+inline constexpr const Field &MAX_MONITOR_LINE = kFields[85];
+inline constexpr const Field &EMX = kFields[86];
+inline constexpr const Field &IBE = kFields[87];
+inline constexpr const Field &C0_SUBSTATES = kFields[88];
+inline constexpr const Field &C1_SUBSTATES = kFields[89];
+inline constexpr const Field &C2_SUBSTATES = kFields[90];
+inline constexpr const Field &C3_SUBSTATES = kFields[91];
+inline constexpr const Field &C4_SUBSTATES = kFields[92];
+inline constexpr const Field &C5_SUBSTATES = kFields[93];
+inline constexpr const Field &C6_SUBSTATES = kFields[94];
+inline constexpr const Field &C7_SUBSTATES = kFields[95];
+} // namespace intel::leaf_00000005
+
+namespace intel::leaf_00000006 {
+inline constexpr const Field &DTS = kFields[96];
+inline constexpr const Field &TURBO_BOOST = kFields[97];
+inline constexpr const Field &ARAT = kFields[98];
+inline constexpr const Field &PLN = kFields[99];
+inline constexpr const Field &ECMD = kFields[100];
+inline constexpr const Field &PTM = kFields[101];
+inline constexpr const Field &HWP = kFields[102];
+inline constexpr const Field &HWP_NOTIFICATION = kFields[103];
+inline constexpr const Field &HWP_ACTIVITY_WINDOW = kFields[104];
+inline constexpr const Field &HWP_EPP = kFields[105];
+inline constexpr const Field &HWP_PACKAGE_REQUEST = kFields[106];
+inline constexpr const Field &HDC = kFields[107];
+inline constexpr const Field &TURBO_BOOST_MAX_3 = kFields[108];
+inline constexpr const Field &HWP_HIGHEST_CHANGE = kFields[109];
+inline constexpr const Field &HWP_PECI_OVERRIDE = kFields[110];
+inline constexpr const Field &FLEXIBLE_HWP = kFields[111];
+inline constexpr const Field &HWP_FAST_ACCESS = kFields[112];
+inline constexpr const Field &HW_FEEDBACK = kFields[113];
+inline constexpr const Field &HWP_IGNORE_IDLE = kFields[114];
+inline constexpr const Field &HWP_CTL = kFields[115];
+inline constexpr const Field &THREAD_DIRECTOR = kFields[116];
+inline constexpr const Field &INTERRUPT_THRESHOLDS = kFields[117];
+inline constexpr const Field &HW_COORD_FEEDBACK = kFields[118];
+inline constexpr const Field &ENERGY_PERF_BIAS = kFields[119];
+inline constexpr const Field &TD_CLASSES = kFields[120];
+} // namespace intel::leaf_00000006
+
+namespace intel::leaf_00000007_0 {
+inline constexpr const Field &MAX_SUBLEAF = kFields[121];
+inline constexpr const Field &FSGSBASE = kFields[122];
+inline constexpr const Field &TSC_ADJUST = kFields[123];
+inline constexpr const Field &SGX = kFields[124];
+inline constexpr const Field &BMI1 = kFields[125];
+inline constexpr const Field &HLE = kFields[126];
+inline constexpr const Field &AVX2 = kFields[127];
+inline constexpr const Field &FDP_EXCPTN_ONLY = kFields[128];
+inline constexpr const Field &SMEP = kFields[129];
+inline constexpr const Field &BMI2 = kFields[130];
+inline constexpr const Field &ERMS = kFields[131];
+inline constexpr const Field &INVPCID = kFields[132];
+inline constexpr const Field &RTM = kFields[133];
+inline constexpr const Field &RDT_M = kFields[134];
+inline constexpr const Field &FPU_CS_DS = kFields[135];
+inline constexpr const Field &MPX = kFields[136];
+inline constexpr const Field &RDT_A = kFields[137];
+inline constexpr const Field &AVX512F = kFields[138];
+inline constexpr const Field &AVX512DQ = kFields[139];
+inline constexpr const Field &RDSEED = kFields[140];
+inline constexpr const Field &ADX = kFields[141];
+inline constexpr const Field &SMAP = kFields[142];
+inline constexpr const Field &AVX512_IFMA = kFields[143];
+inline constexpr const Field &PCOMMIT = kFields[144];
+inline constexpr const Field &CLFLUSHOPT = kFields[145];
+inline constexpr const Field &CLWB = kFields[146];
+inline constexpr const Field &INTEL_PT = kFields[147];
+inline constexpr const Field &AVX512PF = kFields[148];
+inline constexpr const Field &AVX512ER = kFields[149];
+inline constexpr const Field &AVX512CD = kFields[150];
+inline constexpr const Field &SHA = kFields[151];
+inline constexpr const Field &AVX512BW = kFields[152];
+inline constexpr const Field &AVX512VL = kFields[153];
+inline constexpr const Field &PREFETCHWT1 = kFields[154];
+inline constexpr const Field &AVX512_VBMI = kFields[155];
+inline constexpr const Field &UMIP = kFields[156];
+inline constexpr const Field &PKU = kFields[157];
+inline constexpr const Field &OSPKE = kFields[158];
+inline constexpr const Field &WAITPKG = kFields[159];
+inline constexpr const Field &AVX512_VBMI2 = kFields[160];
+inline constexpr const Field &CET_SS = kFields[161];
+inline constexpr const Field &GFNI = kFields[162];
+inline constexpr const Field &VAES = kFields[163];
+inline constexpr const Field &VPCLMULQDQ = kFields[164];
+inline constexpr const Field &AVX512_VNNI = kFields[165];
+inline constexpr const Field &AVX512_BITALG = kFields[166];
+inline constexpr const Field &TME = kFields[167];
+inline constexpr const Field &AVX512_VPOPCNTDQ = kFields[168];
+inline constexpr const Field &LA57 = kFields[169];
+inline constexpr const Field &MAWAU = kFields[170];
+inline constexpr const Field &RDPID = kFields[171];
+inline constexpr const Field &KL = kFields[172];
+inline constexpr const Field &BUS_LOCK_DETECT = kFields[173];
+inline constexpr const Field &CLDEMOTE = kFields[174];
+inline constexpr const Field &MOVDIRI = kFields[175];
+inline constexpr const Field &MOVDIR64B = kFields[176];
+inline constexpr const Field &ENQCMD = kFields[177];
+inline constexpr const Field &SGX_LC = kFields[178];
+inline constexpr const Field &PKS = kFields[179];
+inline constexpr const Field &SGX_KEYS = kFields[180];
+inline constexpr const Field &AVX512_4VNNIW = kFields[181];
+inline constexpr const Field &AVX512_4FMAPS = kFields[182];
+inline constexpr const Field &FSRM = kFields[183];
+inline constexpr const Field &UINTR = kFields[184];
+inline constexpr const Field &AVX512_VP2INTERSECT = kFields[185];
+inline constexpr const Field &SRBDS_CTRL = kFields[186];
+inline constexpr const Field &MD_CLEAR = kFields[187];
+inline constexpr const Field &RTM_ALWAYS_ABORT = kFields[188];
+inline constexpr const Field &TSX_FORCE_ABORT = kFields[189];
+inline constexpr const Field &SERIALIZE = kFields[190];
+inline constexpr const Field &HYBRID = kFields[191];
+inline constexpr const Field &TSXLDTRK = kFields[192];
+inline constexpr const Field &PCONFIG = kFields[193];
+inline constexpr const Field &ARCH_LBR = kFields[194];
+inline constexpr const Field &CET_IBT = kFields[195];
+inline constexpr const Field &AMX_BF16 = kFields[196];
+inline constexpr const Field &AVX512_FP16 = kFields[197];
+inline constexpr const Field &AMX_TILE = kFields[198];
+inline constexpr const Field &AMX_INT8 = kFields[199];
+inline constexpr const Field &IBRS_IBPB = kFields[200];
+inline constexpr const Field &STIBP = kFields[201];
+inline constexpr const Field &L1D_FLUSH = kFields[202];
+inline constexpr const Field &ARCH_CAPABILITIES = kFields[203];
+inline constexpr const Field &CORE_CAPABILITIES = kFields[204];
+inline constexpr const Field &SSBD = kFields[205];
+} // namespace intel::leaf_00000007_0
+
+namespace intel::leaf_00000007_1 {
+inline constexpr const Field &SHA512 = kFields[206];
+inline constexpr const Field &SM3 = kFields[207];
+inline constexpr const Field &SM4 = kFields[208];
+inline constexpr const Field &RAO_INT = kFields[209];
+inline constexpr const Field &AVX_VNNI = kFields[210];
+inline constexpr const Field &AVX512_BF16 = kFields[211];
+inline constexpr const Field &LASS = kFields[212];
+inline constexpr const Field &CMPCCXADD = kFields[213];
+inline constexpr const Field &ARCH_PERFMON_EXT = kFields[214];
+inline constexpr const Field &FZLRM = kFields[215];
+inline constexpr const Field &FSRS = kFields[216];
+inline constexpr const Field &FSRC = kFields[217];
+inline constexpr const Field &FRED = kFields[218];
+inline constexpr const Field &LKGS = kFields[219];
+inline constexpr const Field &WRMSRNS = kFields[220];
+inline constexpr const Field &AMX_FP16 = kFields[221];
+inline constexpr const Field &HRESET = kFields[222];
+inline constexpr const Field &AVX_IFMA = kFields[223];
+inline constexpr const Field &LAM = kFields[224];
+inline constexpr const Field &MSRLIST = kFields[225];
+inline constexpr const Field &AVX_VNNI_INT8 = kFields[226];
+inline constexpr const Field &AVX_NE_CONVERT = kFields[227];
+inline constexpr const Field &AMX_COMPLEX = kFields[228];
+inline constexpr const Field &AVX_VNNI_INT16 = kFields[229];
+inline constexpr const Field &PREFETCHI = kFields[230];
+inline constexpr const Field &UIRET_UIF = kFields[231];
+inline constexpr const Field &CET_SSS = kFields[232];
+inline constexpr const Field &AVX10 = kFields[233];
+inline constexpr const Field &APX_F = kFields[234];
+} // namespace intel::leaf_00000007_1
+
+namespace intel::leaf_00000007_2 {
+inline constexpr const Field &PSFD = kFields[235];
+inline constexpr const Field &IPRED_CTRL = kFields[236];
+inline constexpr const Field &RRSBA_CTRL = kFields[237];
+inline constexpr const Field &DDPD_U = kFields[238];
+inline constexpr const Field &BHI_CTRL = kFields[239];
+inline constexpr const Field &MCDT_NO = kFields[240];
+} // namespace intel::leaf_00000007_2
+
+namespace intel::leaf_0000000A {
+inline constexpr const Field &PERFMON_VERSION = kFields[241];
+inline constexpr const Field &GP_COUNTERS = kFields[242];
+inline constexpr const Field &GP_COUNTER_WIDTH = kFields[243];
+inline constexpr const Field &EBX_VECTOR_LENGTH = kFields[244];
+inline constexpr const Field &NO_CORE_CYCLES = kFields[245];
+inline constexpr const Field &NO_INSTRUCTIONS = kFields[246];
+inline constexpr const Field &NO_REF_CYCLES = kFields[247];
+inline constexpr const Field &NO_LLC_REFERENCES = kFields[248];
+inline constexpr const Field &NO_LLC_MISSES = kFields[249];
+inline constexpr const Field &NO_BRANCHES = kFields[250];
+inline constexpr const Field &NO_BRANCH_MISSES = kFields[251];
+inline constexpr const Field &NO_TOPDOWN_SLOTS = kFields[252];
+inline constexpr const Field &FIXED_COUNTERS = kFields[253];
+inline constexpr const Field &FIXED_COUNTER_WIDTH = kFields[254];
+inline constexpr const Field &ANYTHREAD_DEPRECATED = kFields[255];
+} // namespace intel::leaf_0000000A
+
+namespace intel::leaf_0000000B {
+inline constexpr const Field &APIC_ID_SHIFT = kFields[256];
+inline constexpr const Field &LEVEL_PROCESSORS = kFields[257];
+inline constexpr const Field &LEVEL_NUMBER = kFields[258];
+inline constexpr const Field &LEVEL_TYPE = kFields[259];
+inline constexpr const Field &X2APIC_ID = kFields[260];
+} // namespace intel::leaf_0000000B
+
+namespace intel::leaf_0000000D_0 {
+inline constexpr const Field &X87 = kFields[261];
+inline constexpr const Field &SSE = kFields[262];
+inline constexpr const Field &AVX = kFields[263];
+inline constexpr const Field &BNDREGS = kFields[264];
+inline constexpr const Field &BNDCSR = kFields[265];
+inline constexpr const Field &OPMASK = kFields[266];
+inline constexpr const Field &ZMM_HI256 = kFields[267];
+inline constexpr const Field &HI16_ZMM = kFields[268];
+inline constexpr const Field &PKRU = kFields[269];
+inline constexpr const Field &XTILECFG = kFields[270];
+inline constexpr const Field &XTILEDATA = kFields[271];
+inline constexpr const Field &ENABLED_SIZE = kFields[272];
+inline constexpr const Field &MAX_SIZE = kFields[273];
+} // namespace intel::leaf_0000000D_0
+
+namespace intel::leaf_0000000D_1 {
+inline constexpr const Field &XSAVEOPT = kFields[274];
+inline constexpr const Field &XSAVEC = kFields[275];
+inline constexpr const Field &XGETBV_ECX1 = kFields[276];
+inline constexpr const Field &XSAVES = kFields[277];
+inline constexpr const Field &XFD = kFields[278];
+} // namespace intel::leaf_0000000D_1
+
+namespace intel::leaf_0000000F_0 {
+inline constexpr const Field &L3_MONITORING = kFields[279];
+} // namespace intel::leaf_0000000F_0
+
+namespace intel::leaf_00000010_0 {
+inline constexpr const Field &L3_CAT = kFields[280];
+inline constexpr const Field &L2_CAT = kFields[281];
+inline constexpr const Field &MBA = kFields[282];
+} // namespace intel::leaf_00000010_0
+
+namespace intel::leaf_00000014_0 {
+inline constexpr const Field &MAX_SUBLEAF = kFields[283];
+inline constexpr const Field &CR3_FILTER = kFields[284];
+inline constexpr const Field &PSB_CYC = kFields[285];
+inline constexpr const Field &IP_FILTER = kFields[286];
+inline constexpr const Field &MTC = kFields[287];
+inline constexpr const Field &PTWRITE = kFields[288];
+inline constexpr const Field &POWER_EVENT_TRACE = kFields[289];
+inline constexpr const Field &PSB_PMI_PRESERVE = kFields[290];
+inline constexpr const Field &EVENT_TRACE = kFields[291];
+inline constexpr const Field &TNT_DISABLE = kFields[292];
+inline constexpr const Field &TOPA = kFields[293];
+inline constexpr const Field &TOPA_MULTI_ENTRY = kFields[294];
+inline constexpr const Field &SINGLE_RANGE = kFields[295];
+inline constexpr const Field &TRANSPORT_OUTPUT = kFields[296];
+inline constexpr const Field &LIP = kFields[297];
+} // namespace intel::leaf_00000014_0
+
+namespace intel::leaf_00000014_1 {
+inline constexpr const Field &ADDR_RANGES = kFields[298];
+inline constexpr const Field &MTC_PERIODS = kFields[299];
+inline constexpr const Field &CYC_THRESHOLDS = kFields[300];
+inline constexpr const Field &PSB_FREQUENCIES = kFields[301];
+} // namespace intel::leaf_00000014_1
+
+namespace intel::leaf_00000015 {
+inline constexpr const Field &TSC_DENOMINATOR = kFields[302];
+inline constexpr const Field &TSC_NUMERATOR = kFields[303];
+inline constexpr const Field &CRYSTAL_HZ = kFields[304];
+} // namespace intel::leaf_00000015
+
+namespace intel::leaf_00000016 {
+inline constexpr const Field &BASE_MHZ = kFields[305];
+inline constexpr const Field &MAX_MHZ = kFields[306];
+inline constexpr const Field &BUS_MHZ = kFields[307];
+} // namespace intel::leaf_00000016
+
+namespace intel::leaf_0000001A {
+inline constexpr const Field &NATIVE_MODEL_ID = kFields[308];
+inline constexpr const Field &CORE_TYPE = kFields[309];
+} // namespace intel::leaf_0000001A
+
+namespace intel::leaf_0000001C {
+inline constexpr const Field &DEPTHS = kFields[310];
+inline constexpr const Field &DEEP_CSTATE_RESET = kFields[311];
+inline constexpr const Field &LIP = kFields[312];
+inline constexpr const Field &CPL_FILTER = kFields[313];
+inline constexpr const Field &BRANCH_FILTER = kFields[314];
+inline constexpr const Field &CALL_STACK = kFields[315];
+inline constexpr const Field &MISPREDICT = kFields[316];
+inline constexpr const Field &TIMED_LBR = kFields[317];
+inline constexpr const Field &BRANCH_TYPE = kFields[318];
+inline constexpr const Field &EVENT_LOGGING = kFields[319];
+} // namespace intel::leaf_0000001C
+
+namespace intel::leaf_0000001D_1 {
+inline constexpr const Field &TOTAL_TILE_BYTES = kFields[320];
+inline constexpr const Field &BYTES_PER_TILE = kFields[321];
+inline constexpr const Field &BYTES_PER_ROW = kFields[322];
+inline constexpr const Field &MAX_NAMES = kFields[323];
+inline constexpr const Field &MAX_ROWS = kFields[324];
+} // namespace intel::leaf_0000001D_1
+
+namespace intel::leaf_0000001E_0 {
+inline constexpr const Field &TMUL_MAXK = kFields[325];
+inline constexpr const Field &TMUL_MAXN = kFields[326];
+} // namespace intel::leaf_0000001E_0
+
+namespace intel::leaf_0000001F {
+inline constexpr const Field &APIC_ID_SHIFT = kFields[327];
+inline constexpr const Field &LEVEL_PROCESSORS = kFields[328];
+inline constexpr const Field &LEVEL_NUMBER = kFields[329];
+inline constexpr const Field &LEVEL_TYPE = kFields[330];
+inline constexpr const Field &X2APIC_ID = kFields[331];
+} // namespace intel::leaf_0000001F
+
+namespace intel::leaf_40000000 {
+inline constexpr const Field &MAX_HYPERVISOR_LEAF = kFields[332];
+} // namespace intel::leaf_40000000
+
+namespace intel::leaf_80000000 {
+inline constexpr const Field &MAX_EXTENDED_LEAF = kFields[333];
+} // namespace intel::leaf_80000000
+
+namespace intel::leaf_80000001 {
+inline constexpr const Field &LAHF_SAHF = kFields[334];
+inline constexpr const Field &LZCNT = kFields[335];
+inline constexpr const Field &PREFETCHW = kFields[336];
+inline constexpr const Field &SYSCALL = kFields[337];
+inline constexpr const Field &NX = kFields[338];
+inline constexpr const Field &PAGE_1GB = kFields[339];
+inline constexpr const Field &RDTSCP = kFields[340];
+inline constexpr const Field &LM = kFields[341];
+} // namespace intel::leaf_80000001
+
+namespace intel::leaf_80000006 {
+inline constexpr const Field &L2_LINE_SIZE = kFields[342];
+inline constexpr const Field &L2_ASSOC = kFields[343];
+inline constexpr const Field &L2_SIZE_KB = kFields[344];
+} // namespace intel::leaf_80000006
+
+namespace intel::leaf_80000007 {
+inline constexpr const Field &INVARIANT_TSC = kFields[345];
+} // namespace intel::leaf_80000007
+
+namespace intel::leaf_80000008 {
+inline constexpr const Field &PHYS_ADDR_BITS = kFields[346];
+inline constexpr const Field &LINEAR_ADDR_BITS = kFields[347];
+inline constexpr const Field &GUEST_PHYS_ADDR_BITS = kFields[348];
+inline constexpr const Field &WBNOINVD = kFields[349];
+} // namespace intel::leaf_80000008
+
+
+} // namespace chipinspect::featuredb
@@ -0,0 +1,94 @@
+# -----------------------------------------------------------------------------
+#
+# ChipInspect - CPUID feature database accessors.
+#
+# Generated by gen_featuredb.py from features.def, do not edit.
+#
+# -----------------------------------------------------------------------------
+
+import os
+import mmap
+import struct
+
+FORMAT_VERSION = 1
+SOURCE_CRC = 0x95E2B30B
+MAGIC = b'CIFD'
+VENDORS = ('intel', 'amd')
+REGISTERS = ('eax', 'ebx', 'ecx', 'edx')
+ANY_SUBLEAF = 0xFFFFFFFF
+
+HEADER = struct.Struct("<4sHHIIIIIII")
+REGISTER = struct.Struct("<IIBBHI")
+FIELD = struct.Struct("<BBHII")
+
+class FeatureDatabase:
+    """
+    CPUID field database backed by featuredb.bin.
+
+    The blob is mapped read-only the first time it is queried and fields are unpacked one register at a
+    time, so importing this module costs nothing however many leaves the database covers.
+    """
+
+    def __init__(self, path=None):
+        self.path = path or os.path.join(os.path.dirname(os.path.abspath(__file__)), "featuredb.bin")
+        self.blob = None
+        self.index = None
+        self.field_cache = {}
+
+    def load(self):
+        """Maps the blob and indexes its register table, raising ValueError if it is stale or corrupt."""
+        if self.blob is not None:
+            return
+        with open(self.path, "rb") as handle:
+            blob = mmap.mmap(handle.fileno(), 0, access=mmap.ACCESS_READ)
+        (magic, version, _, source_crc, register_count, register_offset,
+         self.field_count, self.field_offset, self.string_offset, _) = HEADER.unpack_from(blob, 0)
+        if magic != MAGIC or version != FORMAT_VERSION:
+            raise ValueError(f"{self.path} is not a version {FORMAT_VERSION} feature database")
+        if source_crc != SOURCE_CRC:
+            raise ValueError(f"{self.path} does not match featuredb.py, rerun gen_featuredb.py")
+
+        index = {}
+        for handle_index in range(register_count):
+            leaf, subleaf, vendor, register, count, first = REGISTER.unpack_from(
+                blob, register_offset + handle_index * REGISTER.size)
+            index.setdefault((VENDORS[vendor], leaf, subleaf), {})[REGISTERS[register]] = (first, count)
+        self.blob = blob
+        self.index = index
+
+    def string(self, offset):
+        """Reads a NUL terminated string from the string pool."""
+        start = self.string_offset + offset
+        return self.blob[start:self.blob.find(b"\0", start)].decode("utf-8")
+
+    def registers(self, vendor, leaf, subleaf):
+        """Returns {register: handle} for a leaf, preferring an exact subleaf over an any-subleaf entry."""
+        self.load()
+        return self.index.get((vendor, leaf, subleaf)) or self.index.get((vendor, leaf, ANY_SUBLEAF)) or {}
+
+    def fields(self, handle):
+        """Returns the (lsb, width, mnemonic, name) fields of a register handle, lowest bit first."""
+        fields = self.field_cache.get(handle)
+        if fields is None:
+            first, count = handle
+            fields = []
+            for field_index in range(first, first + count):
+                lsb, width, _, mnemonic, name = FIELD.unpack_from(self.blob, self.field_offset + field_index * FIELD.size)
+                fields.append((lsb, width, self.string(mnemonic), self.string(name)))
+            fields = self.field_cache[handle] = tuple(fields)
+        return fields
+
+    def leaves(self, vendor):
+        """Yields (leaf, subleaf or None, {register: handle}) for every leaf the database describes for a vendor."""
+        self.load()
+        for (entry_vendor, leaf, subleaf), registers in sorted(self.index.items()):
+            if entry_vendor == vendor:
+                yield leaf, None if subleaf == ANY_SUBLEAF else subleaf, registers
+
+    def find(self, vendor, leaf, subleaf, mnemonic):
+        """Returns (register, lsb, width) for a field mnemonic, or None if the leaf does not define it."""
+        for register, handle in self.registers(vendor, leaf, subleaf).items():
+            for lsb, width, field_mnemonic, name in self.fields(handle):
+                if field_mnemonic == mnemonic:
+                    return register, lsb, width
+        return None
@@ -0,0 +1,400 @@
+# -----------------------------------------------------------------------------
+#
+# ChipInspect - Feature database compiler.
+#
+# Compiles features.def into featuredb.bin, featuredb.py and featuredb.hpp.
+# Run with --check to only verify the generated files are up to date.
+#
+# Copyright (c) 2024 RoyalGraphX - BSD 3-Clause License
+# See LICENSE file for more detailed information.
+#
+# -----------------------------------------------------------------------------
+
+import os
+import re
+import sys
+import struct
+import zlib
+
+SOURCE_DIR = os.path.dirname(os.path.abspath(__file__))
+SOURCE_PATH = os.path.join(SOURCE_DIR, "features.def")
+BLOB_PATH = os.path.join(SOURCE_DIR, "featuredb.bin")
+PYTHON_PATH = os.path.join(SOURCE_DIR, "featuredb.py")
+HEADER_PATH = os.path.join(SOURCE_DIR, "featuredb.hpp")
+
+VENDORS = ("intel", "amd")
+REGISTERS = ("eax", "ebx", "ecx", "edx")
+ANY_SUBLEAF = 0xFFFFFFFF
+FORMAT_VERSION = 1
+MAGIC = b"CIFD"
+
+# Blob layout, all little-endian:
+#   header:   magic, version, header size, source CRC-32, register count, register table offset,
+#             field count, field table offset, string pool offset, string pool size
+#   register: leaf, subleaf (ANY_SUBLEAF for any), vendor, register, field count, first field index
+#   field:    lowest bit, width, reserved, mnemonic offset, name offset (NUL terminated strings)
+HEADER_FORMAT = "<4sHHIIIIIII"
+REGISTER_FORMAT = "<IIBBHI"
+FIELD_FORMAT = "<BBHII"
+
+block_pattern = re.compile(r"^\[([a-z,]+)\s+(0x[0-9A-Fa-f]{8})\s+(\*|\d+)\s+(eax|ebx|ecx|edx)\]$")
+field_pattern = re.compile(r"^(\d+)(?::(\d+))?\s+([A-Z][A-Z0-9_]*)\s+(.+)$")
+
+def fail(line_number, message):
+    sys.exit(f"features.def:{line_number}: {message}")
+
+def parse_source(text):
+    """
+    Parses features.def into a sorted list of registers.
+
+    Returns:
+        list: (vendor index, leaf, subleaf, register index, [(lsb, width, mnemonic, name)]) tuples,
+              sorted by vendor, leaf, subleaf and register with fields sorted by lowest bit.
+    """
+    registers = {}
+    mnemonics = {}
+    current = None
+
+    for line_number, line in enumerate(text.splitlines(), 1):
+        line = line.strip()
+        if not line or line.startswith('#'):
+            continue
+
+        if line.startswith('['):
+            match = block_pattern.match(line)
+            if not match:
+                fail(line_number, f"malformed block header '{line}'")
+            vendors, leaf, subleaf, register = match.groups()
+            current = []
+            current_keys = []
+            for vendor in vendors.split(','):
+                if vendor not in VENDORS:
+                    fail(line_number, f"unknown vendor '{vendor}'")
+                key = (VENDORS.index(vendor), int(leaf, 16),
+                       ANY_SUBLEAF if subleaf == '*' else int(subleaf), REGISTERS.index(register))
+                if key in registers:
+                    fail(line_number, f"{vendor} {leaf} {subleaf} {register} is defined twice")
+                registers[key] = current
+                current_keys.append(key[:3])
+            continue
+
+        if current is None:
+            fail(line_number, "field outside of a block")
+        match = field_pattern.match(line)
+        if not match:
+            fail(line_number, f"malformed field '{line}'")
+        high, low, mnemonic, name = match.groups()
+        high = int(high)
+        low = high if low is None else int(low)
+        if not 0 <= low <= high <= 31:
+            fail(line_number, f"bad bit range {high}:{low}")
+        width = high - low + 1
+        mask = ((1 << width) - 1) << low
+        for other_low, other_width, other_mnemonic, other_name in current:
+            if mask & (((1 << other_width) - 1) << other_low):
+                fail(line_number, f"{mnemonic} overlaps {other_mnemonic}")
+        for owner in current_keys:
+            if mnemonics.setdefault(owner + (mnemonic,), line_number) != line_number:
+                fail(line_number, f"mnemonic {mnemonic} is already used in this leaf")
+        current.append((low, width, mnemonic, name.strip()))
+
+    return [key[:3] + (key[3], sorted(fields)) for key, fields in sorted(registers.items())]
+
+def build_blob(registers, source_crc):
+    """Packs the parsed registers into the binary blob mapped by featuredb.py."""
+    strings = bytearray()
+    string_offsets = {}
+
+    def intern(text):
+        offset = string_offsets.get(text)
+        if offset is None:
+            offset = string_offsets[text] = len(strings)
+            strings.extend(text.encode("utf-8") + b"\0")
+        return offset
+
+    register_table = bytearray()
+    field_table = bytearray()
+    field_count = 0
+    for vendor, leaf, subleaf, register, fields in registers:
+        register_table += struct.pack(REGISTER_FORMAT, leaf, subleaf, vendor, register, len(fields), field_count)
+        for lsb, width, mnemonic, name in fields:
+            field_table += struct.pack(FIELD_FORMAT, lsb, width, 0, intern(mnemonic), intern(name))
+            field_count += 1
+
+    header_size = struct.calcsize(HEADER_FORMAT)
+    register_offset = header_size
+    field_offset = register_offset + len(register_table)
+    string_offset = field_offset + len(field_table)
+    header = struct.pack(HEADER_FORMAT, MAGIC, FORMAT_VERSION, header_size, source_crc,
+                         len(registers), register_offset, field_count, field_offset, string_offset, len(strings))
+    return bytes(header + register_table + field_table + strings)
+
+python_template = '''\
+# -----------------------------------------------------------------------------
+#
+# ChipInspect - CPUID feature database accessors.
+#
+# Generated by gen_featuredb.py from features.def, do not edit.
+#
+# -----------------------------------------------------------------------------
+
+import os
+import mmap
+import struct
+
+FORMAT_VERSION = {version}
+SOURCE_CRC = 0x{crc:08X}
+MAGIC = {magic!r}
+VENDORS = {vendors!r}
+REGISTERS = {registers!r}
+ANY_SUBLEAF = 0x{any_subleaf:08X}
+
+HEADER = struct.Struct("{header_format}")
+REGISTER = struct.Struct("{register_format}")
+FIELD = struct.Struct("{field_format}")
+
+class FeatureDatabase:
+    """
+    CPUID field database backed by featuredb.bin.
+
+    The blob is mapped read-only the first time it is queried and fields are unpacked one register at a
+    time, so importing this module costs nothing however many leaves the database covers.
+    """
+
+    def __init__(self, path=None):
+        self.path = path or os.path.join(os.path.dirname(os.path.abspath(__file__)), "featuredb.bin")
+        self.blob = None
+        self.index = None
+        self.field_cache = {{}}
+
+    def load(self):
+        """Maps the blob and indexes its register table, raising ValueError if it is stale or corrupt."""
+        if self.blob is not None:
+            return
+        with open(self.path, "rb") as handle:
+            blob = mmap.mmap(handle.fileno(), 0, access=mmap.ACCESS_READ)
+        (magic, version, _, source_crc, register_count, register_offset,
+         self.field_count, self.field_offset, self.string_offset, _) = HEADER.unpack_from(blob, 0)
+        if magic != MAGIC or version != FORMAT_VERSION:
+            raise ValueError(f"{{self.path}} is not a version {{FORMAT_VERSION}} feature database")
+        if source_crc != SOURCE_CRC:
+            raise ValueError(f"{{self.path}} does not match featuredb.py, rerun gen_featuredb.py")
+
+        index = {{}}
+        for handle_index in range(register_count):
+            leaf, subleaf, vendor, register, count, first = REGISTER.unpack_from(
+                blob, register_offset + handle_index * REGISTER.size)
+            index.setdefault((VENDORS[vendor], leaf, subleaf), {{}})[REGISTERS[register]] = (first, count)
+        self.blob = blob
+        self.index = index
+
+    def string(self, offset):
+        """Reads a NUL terminated string from the string pool."""
+        start = self.string_offset + offset
+        return self.blob[start:self.blob.find(b"\\0", start)].decode("utf-8")
+
+    def registers(self, vendor, leaf, subleaf):
+        """Returns {{register: handle}} for a leaf, preferring an exact subleaf over an any-subleaf entry."""
+        self.load()
+        return self.index.get((vendor, leaf, subleaf)) or self.index.get((vendor, leaf, ANY_SUBLEAF)) or {{}}
+
+    def fields(self, handle):
+        """Returns the (lsb, width, mnemonic, name) fields of a register handle, lowest bit first."""
+        fields = self.field_cache.get(handle)
+        if fields is None:
+            first, count = handle
+            fields = []
+            for field_index in range(first, first + count):
+                lsb, width, _, mnemonic, name = FIELD.unpack_from(self.blob, self.field_offset + field_index * FIELD.size)
+                fields.append((lsb, width, self.string(mnemonic), self.string(name)))
+            fields = self.field_cache[handle] = tuple(fields)
+        return fields
+
+    def leaves(self, vendor):
+        """Yields (leaf, subleaf or None, {{register: handle}}) for every leaf the database describes for a vendor."""
+        self.load()
+        for (entry_vendor, leaf, subleaf), registers in sorted(self.index.items()):
+            if entry_vendor == vendor:
+                yield leaf, None if subleaf == ANY_SUBLEAF else subleaf, registers
+
+    def find(self, vendor, leaf, subleaf, mnemonic):
+        """Returns (register, lsb, width) for a field mnemonic, or None if the leaf does not define it."""
+        for register, handle in self.registers(vendor, leaf, subleaf).items():
+            for lsb, width, field_mnemonic, name in self.fields(handle):
+                if field_mnemonic == mnemonic:
+                    return register, lsb, width
+        return None
+'''
+
+header_template = '''\
+// -----------------------------------------------------------------------------
+//
+// ChipInspect - CPUID feature database accessors.
+//
+// Generated by gen_featuredb.py from features.def, do not edit.
+//
+// -----------------------------------------------------------------------------
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chipinspect::featuredb {{
+
+enum class Vendor : std::uint8_t {{ Intel = 0, Amd = 1 }};
+enum class Register : std::uint8_t {{ Eax = 0, Ebx = 1, Ecx = 2, Edx = 3 }};
+
+inline constexpr std::uint32_t kFormatVersion = {version};
+inline constexpr std::uint32_t kSourceCrc = 0x{crc:08X}u;
+inline constexpr std::uint32_t kAnySubleaf = 0x{any_subleaf:08X}u;
+
+struct Field {{
+    std::uint32_t leaf;
+    std::uint32_t subleaf;
+    Vendor vendor;
+    Register reg;
+    std::uint8_t lsb;
+    std::uint8_t width;
+    const char *mnemonic;
+    const char *name;
+
+    constexpr std::uint32_t extract(std::uint32_t value) const {{
+        return width >= 32 ? value : (value >> lsb) & ((1u << width) - 1u);
+    }}
+
+    constexpr bool covers(std::uint32_t queried_leaf, std::uint32_t queried_subleaf) const {{
+        return leaf == queried_leaf && (subleaf == kAnySubleaf || subleaf == queried_subleaf);
+    }}
+}};
+
+inline constexpr Field kFields[] = {{
+{fields}
+}};
+
+inline constexpr std::size_t kFieldCount = sizeof(kFields) / sizeof(kFields[0]);
+
+// Returns the field holding a bit of a register, or nullptr for reserved bits.
+inline const Field *find(Vendor vendor, std::uint32_t leaf, std::uint32_t subleaf, Register reg, unsigned bit) {{
+    const Field *any = nullptr;
+    for (const Field &field : kFields) {{
+        if (field.vendor != vendor || field.reg != reg || !field.covers(leaf, subleaf))
+            continue;
+        if (bit < field.lsb || bit >= field.lsb + field.width)
+            continue;
+        if (field.subleaf == subleaf)
+            return &field;
+        any = &field;
+    }}
+    return any;
+}}
+
+// On-disk layout of featuredb.bin for loaders that map the blob instead of compiling the table in.
+struct BlobHeader {{
+    char magic[4];
+    std::uint16_t version;
+    std::uint16_t header_size;
+    std::uint32_t source_crc;
+    std::uint32_t register_count;
+    std::uint32_t register_offset;
+    std::uint32_t field_count;
+    std::uint32_t field_offset;
+    std::uint32_t string_offset;
+    std::uint32_t string_size;
+}};
+
+struct BlobRegister {{
+    std::uint32_t leaf;
+    std::uint32_t subleaf;
+    std::uint8_t vendor;
+    std::uint8_t reg;
+    std::uint16_t field_count;
+    std::uint32_t first_field;
+}};
+
+struct BlobField {{
+    std::uint8_t lsb;
+    std::uint8_t width;
+    std::uint16_t reserved;
+    std::uint32_t mnemonic_offset;
+    std::uint32_t name_offset;
+}};
+
+static_assert(sizeof(BlobHeader) == {header_size}, "BlobHeader does not match featuredb.bin");
+static_assert(sizeof(BlobRegister) == {register_size}, "BlobRegister does not match featuredb.bin");
+static_assert(sizeof(BlobField) == {field_size}, "BlobField does not match featuredb.bin");
+
+// Named accessors, e.g. intel::leaf_00000007_0::AVX2.extract(ebx)
+{accessors}
+
+}} // namespace chipinspect::featuredb
+'''
+
+def c_string(text):
+    return '"' + text.replace('\\', '\\\\').replace('"', '\\"') + '"'
+
+def build_header(registers, source_crc):
+    """Renders featuredb.hpp, a constexpr copy of the database with one named accessor per field."""
+    field_lines = []
+    namespaces = {}
+    for vendor, leaf, subleaf, register, fields in registers:
+        leaf_name = f"leaf_{leaf:08X}" if subleaf == ANY_SUBLEAF else f"leaf_{leaf:08X}_{subleaf}"
+        for lsb, width, mnemonic, name in fields:
+            namespaces.setdefault((VENDORS[vendor], leaf_name), []).append((mnemonic, len(field_lines)))
+            field_lines.append(
+                f"    {{0x{leaf:08X}u, 0x{subleaf:08X}u, Vendor::{VENDORS[vendor].capitalize()}, "
+                f"Register::{REGISTERS[register].capitalize()}, {lsb}, {width}, {c_string(mnemonic)}, {c_string(name)}}},")
+
+    accessors = []
+    for (vendor, leaf_name), entries in sorted(namespaces.items()):
+        accessors.append(f"namespace {vendor}::{leaf_name} {{")
+        accessors.extend(f"inline constexpr const Field &{mnemonic} = kFields[{index}];" for mnemonic, index in entries)
+        accessors.append(f"}} // namespace {vendor}::{leaf_name}\n")
+
+    return header_template.format(
+        version=FORMAT_VERSION, crc=source_crc, any_subleaf=ANY_SUBLEAF, fields='\n'.join(field_lines),
+        header_size=struct.calcsize(HEADER_FORMAT), register_size=struct.calcsize(REGISTER_FORMAT),
+        field_size=struct.calcsize(FIELD_FORMAT), accessors='\n'.join(accessors).rstrip() + '\n')
+
+def build_python(source_crc):
+    return python_template.format(
+        version=FORMAT_VERSION, crc=source_crc, magic=MAGIC, vendors=VENDORS, registers=REGISTERS,
+        any_subleaf=ANY_SUBLEAF, header_format=HEADER_FORMAT, register_format=REGISTER_FORMAT,
+        field_format=FIELD_FORMAT)
+
+def main():
+    with open(SOURCE_PATH, "rb") as source:
+        text = source.read()
+    source_crc = zlib.crc32(text)
+    registers = parse_source(text.decode("utf-8"))
+
+    outputs = {
+        BLOB_PATH: build_blob(registers, source_crc),
+        PYTHON_PATH: build_python(source_crc).encode("utf-8"),
+        HEADER_PATH: build_header(registers, source_crc).encode("utf-8"),
+    }
+
+    if "--check" in sys.argv[1:]:
+        stale = []
+        for path, data in outputs.items():
+            try:
+                with open(path, "rb") as existing:
+                    if existing.read() == data:
+                        continue
+            except OSError:
+                pass
+            stale.append(os.path.basename(path))
+        if stale:
+            sys.exit(f"Out of date: {', '.join(stale)}, run gen_featuredb.py")
+        return
+
+    for path, data in outputs.items():
+        with open(path, "wb") as output:
+            output.write(data)
+
+    field_count = sum(len(fields) for *_, fields in registers)
+    print(f"Compiled {field_count} fields in {len(registers)} registers, "
+          f"featuredb.bin is {len(outputs[BLOB_PATH])} bytes")
+
+if __name__ == "__main__":
+    main()
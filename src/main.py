@@ -7,17 +7,28 @@
 # 
 # -----------------------------------------------------------------------------
 
+import io
 import os
 import re
 import sys
 import time
 import json
+import math
+import mmap
+import zlib
 import click
 import shutil
+import signal
 import string
+import struct
 import getpass
+import hashlib
+import datetime
 import platform
+import functools
+import contextlib
 import subprocess
+import featuredb
 from cffi import FFI
 from itertools import permutations
 
@@ -26,6 +37,24 @@ DEBUG = "FALSE"
 CI_vers = "0.0.25"
 ffi = FFI()
 
+# Phase profiler state, enabled with --profile (see enable_profiling)
+profile_enabled = False
+profile_start = None
+profile_events = []
+profile_phases = {}
+profile_counters = {"cpuid_instructions": 0, "ffi_allocations": 0, "bytes_written": 0}
+
+# Energy meter of the benchmark section running now, operations are counted into it (see EnergyMeter)
+active_energy_meter = None
+
+# MSR values loaded from a replay file, used instead of /dev/cpu/N/msr when set
+msr_replay_table = None
+
+# Snapshot registers served by call_cpuid instead of the CPUID instruction when set (see start_replay)
+replay_registers = None
+replay_cpus = None
+replay_subleafless = set()
+
 # Define the list of leaf values with comments explaining their purpose
 # Note: The actual availability and use of these leaves can depend on the specific CPU and vendor.
 leaf_list = [
@@ -211,694 +240,222 @@ ryzen_leaf_list = [
     0x80000009,  # SVM Revision and Feature Identifiers (AMD-specific)
     0x8000000A,  # SVM Features (AMD-specific)
 ]
-# List defining each bit in EAX register from CPUID leaf 1 for Intel platforms
-intel_leaf1_eax_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Reserved"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: Extended family ID"),
-    (26, "Bit 26: Extended family ID"),
-    (25, "Bit 25: Extended family ID"),
-    (24, "Bit 24: Extended family ID"),
-    (23, "Bit 23: Extended family ID"),
-    (22, "Bit 22: Extended family ID"),
-    (21, "Bit 21: Extended family ID"),
-    (20, "Bit 20: Extended family ID"),
-    (19, "Bit 19: Extended model ID"),
-    (18, "Bit 18: Extended model ID"),
-    (17, "Bit 17: Extended model ID"),
-    (16, "Bit 16: Extended model ID"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Processor type (0 for Original OEM Processor)"),
-    (12, "Bit 12: Processor type (0 for Original OEM Processor)"),
-    (11, "Bit 11: Family ID"),
-    (10, "Bit 10: Family ID"),
-    (9,  "Bit 9: Family ID"),
-    (8,  "Bit 8: Family ID"),
-    (7,  "Bit 7: Model ID"),
-    (6,  "Bit 6: Model ID"),
-    (5,  "Bit 5: Model ID"),
-    (4,  "Bit 4: Model ID"),
-    (3,  "Bit 3: Stepping ID"),
-    (2,  "Bit 2: Stepping ID"),
-    (1,  "Bit 1: Stepping ID"),
-    (0,  "Bit 0: Stepping ID"),
-]
-
-# List defining each bit in EBX register from CPUID leaf 1 for Intel platforms
-intel_leaf1_ebx_bits = [
-    (31, "Bit 31: Initial APIC value"),
-    (30, "Bit 30: Initial APIC value"),
-    (29, "Bit 29: Initial APIC value"),
-    (28, "Bit 28: Initial APIC value"),
-    (27, "Bit 27: Initial APIC value"),
-    (26, "Bit 26: Initial APIC value"),
-    (25, "Bit 25: Initial APIC value"),
-    (24, "Bit 24: Initial APIC value"),
-    (23, "Bit 23: Logical processors"),
-    (22, "Bit 22: Logical processors"),
-    (21, "Bit 21: Logical processors"),
-    (20, "Bit 20: Logical processors"),
-    (19, "Bit 19: Logical processors"),
-    (18, "Bit 18: Logical processors"),
-    (17, "Bit 17: Logical processors"),
-    (16, "Bit 16: Logical processors"),
-    (15, "Bit 15: CLFLUSH line size"),
-    (14, "Bit 14: CLFLUSH line size"),
-    (13, "Bit 13: CLFLUSH line size"),
-    (12, "Bit 12: CLFLUSH line size"),
-    (11, "Bit 11: CLFLUSH line size"),
-    (10, "Bit 10: CLFLUSH line size"),
-    (9,  "Bit  9: CLFLUSH line size"),
-    (8,  "Bit  8: CLFLUSH line size"),
-    (7,  "Bit  7: Brand index"),
-    (6,  "Bit  6: Brand index"),
-    (5,  "Bit  5: Brand index"),
-    (4,  "Bit  4: Brand index"),
-    (3,  "Bit  3: Brand index"),
-    (2,  "Bit  2: Brand index"),
-    (1,  "Bit  1: Brand index"),
-    (0,  "Bit  0: Brand index"),
-]
-
-# List defining each bit in ECX register from CPUID leaf 1 for Intel platforms
-intel_leaf1_ecx_bits = [
-    (31, "Bit 31: Hypervisor present (always zero on physical CPUs)"),
-    (30, "Bit 30: RDRAND (on-chip random number generator) feature"),
-    (29, "Bit 29: Floating-point conversion instructions to/from FP16 format (F16C)"),
-    (28, "Bit 28: Advanced Vector Extensions (AVX)"),
-    (27, "Bit 27: XSAVE enabled by OS (OSXSAVE)"),
-    (26, "Bit 26: Extensible processor state save/restore (XSAVE, XRSTOR, XSETBV, XGETBV)"),
-    (25, "Bit 25: AES instruction set (AES-NI)"),
-    (24, "Bit 24: APIC implements one-shot operation using a TSC deadline value (TSC-DEADLINE)"),
-    (23, "Bit 23: POPCNT instruction"),
-    (22, "Bit 22: MOVBE instruction (big-endian MOV)"),
-    (21, "Bit 21: x2APIC (enhanced APIC)"),
-    (20, "Bit 20: SSE4.2 instructions"),
-    (19, "Bit 19: SSE4.1 instructions"),
-    (18, "Bit 18: Direct cache access for DMA writes (DCA)"),
-    (17, "Bit 17: Process context identifiers (CR4 Bit 17) (PCID)"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Perfmon & debug capability (PDCM)"),
-    (14, "Bit 14: Can disable sending task priority messages (XTPR)"),
-    (13, "Bit 13: CMPXCHG16B instruction"),
-    (12, "Bit 12: Fused multiply-add (FMA3)"),
-    (11, "Bit 11: Silicon Debug interface (SDBG)"),
-    (10, "Bit 10: L1 Context ID (CNXT-ID)"),
-    (9, "Bit  9: Supplemental SSE3 instructions"),
-    (8, "Bit  8: Thermal Monitor 2 (TM2)"),
-    (7, "Bit  7: Enhanced SpeedStep (EST)"),
-    (6, "Bit  6: Safer Mode Extensions (SMX) (GETSEC instruction)"),
-    (5, "Bit  5: Virtual Machine eXtensions (VMX)"),
-    (4, "Bit  4: CPL qualified debug store (DS-CPL)"),
-    (3, "Bit  3: MONITOR and MWAIT instructions (PNI)"),
-    (2, "Bit  2: 64-bit debug store (DTES64) (EDX Bit 21)"),
-    (1, "Bit  1: PCLMULQDQ (carry-less multiply) instruction"),
-    (0, "Bit  0: SSE3 (Prescott New Instructions - PNI)"),
-]
-
-# List defining each bit in EDX register from CPUID leaf 1 for Intel platforms
-intel_leaf1_edx_bits = [
-    (31, "Bit 31: Pending break enable (PBE)"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Thermal monitor (TM)"),
-    (28, "Bit 28: HyperThreading / max APIC IDs field is valid (HTT)"),
-    (27, "Bit 27: Self Snoop (SS)"),
-    (26, "Bit 26: SSE2"),
-    (25, "Bit 25: SSE"),
-    (24, "Bit 24: FXSAVE/FXSTOR instructions (FXSR)"),
-    (23, "Bit 23: MMX"),
-    (22, "Bit 22: ACPI"),
-    (21, "Bit 21: Debug store (DS)"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: CLFLUSH support (CLFSH)"),
-    (18, "Bit 18: Processor serial number (PSN)"),
-    (17, "Bit 17: 32-bit page size extension (PSE36)"),
-    (16, "Bit 16: Page attribute table (PAT)"),
-    (15, "Bit 15: Conditional move instructions (CMOV)"),
-    (14, "Bit 14: Machine check architecture (MCA)"),
-    (13, "Bit 13: Page global bit (PGE)"),
-    (12, "Bit 12: Memory type range registers (MTRR)"),
-    (11, "Bit 11: SYSENTER/SYSEXIT instructions (SEP)"),
-    (10, "Bit 10: Reserved"),
-    (9, "Bit  9: APIC on chip (APIC)"),
-    (8, "Bit  8: CMPXCHG8B (CX8)"),
-    (7, "Bit  7: Machine check exception (MCE)"),
-    (6, "Bit  6: Physical address extension (PAE)"),
-    (5, "Bit  5: Model specific registers (MSR)"),
-    (4, "Bit  4: Time stamp counter (TSC)"),
-    (3, "Bit  3: Page size extension (PSE)"),
-    (2, "Bit  2: Debugging extensions (DE)"),
-    (1, "Bit  1: Virtual 8086 mode enhancements (VME)"),
-    (0, "Bit  0: x87 FPU on chip (FPU)"),
-]
-
-# List defining each bit in EBX register from CPUID leaf 7 for Intel platforms
-intel_leaf7_ebx_bits = [
-    (31, "Bit 31: AVX512 Vector Length (VL) Extensions"),
-    (30, "Bit 30: AVX512 Byte and Word (BW) Instructions"),
-    (29, "Bit 29: SHA-1 and SHA-256 Extensions"),
-    (28, "Bit 28: AVX-512 Conflict Detection (CD) Instructions"),
-    (27, "Bit 27: AVX-512 Exponential and Reciprocal (ER) Instructions"),
-    (26, "Bit 26: AVX-512 Prefetch (PF) Instructions"),
-    (25, "Bit 25: Intel Processor Trace (IPT)"),
-    (24, "Bit 24: Cache line writeback (CLWB)"),
-    (23, "Bit 23: CLFLUSHOPT instruction"),
-    (22, "Bit 22: PCOMMIT instruction"),
-    (21, "Bit 21: AVX-512 Integer Fused Multiply-Add (IFMA) Instructions"),
-    (20, "Bit 20: Supervisor Mode Access Prevention (SMAP)"),
-    (19, "Bit 19: Intel ADX (Multi-Precision Add-Carry Instruction Extensions)"),
-    (18, "Bit 18: RDSEED - Supports RDSEED instruction"),
-    (17, "Bit 17: AVX-512 Doubleword and Quadword (DQ) Instructions"),
-    (16, "Bit 16: AVX-512 Foundation Instructions"),
-    (15, "Bit 15: Intel Resource Director (RDT) Allocation"),
-    (14, "Bit 14: Intel Memory Protection Extensions (MPX)"),
-    (13, "Bit 13: x87 FPU CS and DS Instructions"),
-    (12, "Bit 12: Intel Resource Director (RDT) Monitoring"),
-    (11, "Bit 11: Restricted Transactional Memory"),
-    (10, "Bit 10: INVPCID instruction"),
-    (9, "Bit  9: Enhanced REP MOVSB/STOSB (ERMS)"),
-    (8, "Bit  8: Bit Manipulation Instruction Set 2 (BMI2)"),
-    (7, "Bit  7: Supervisor Mode Execution Protection (SMEP)"),
-    (6, "Bit  6: FDP exception only (FDP_EXCPTN_ONLY) feature"),
-    (5, "Bit  5: Advanced Vector Extensions 2 (AVX2)"),
-    (4, "Bit  4: Hardware Lock Elision (HLE)"),
-    (3, "Bit  3: Bit Manipulation Instruction Set 1 (BMI1)"),
-    (2, "Bit  2: Intel Software Guard Extensions (SGX)"),
-    (1, "Bit  1: IA32_TSC_ADJUST MSR"),
-    (0, "Bit  0: FSGSBASE instructions"),
-]
-
-# List defining each bit in ECX register from CPUID leaf 7 for Intel platforms
-intel_leaf7_ecx_bits = [
-    (31, "Bit 31: Protection keys for supervisor-mode pages (PKS)"),
-    (30, "Bit 30: SGX launch configuration"),
-    (29, "Bit 29: Enqueue stores (ENQCMD)"),
-    (28, "Bit 28: 64-bit direct stores (MOVDIRI64B)"),
-    (27, "Bit 27: 32-bit direct stores (MOVDIRI)"),
-    (26, "Bit 26: Reserved"),
-    (25, "Bit 25: Cache line demote (CLDEMOTE)"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Key locker (KL)"),
-    (22, "Bit 22: Read processor ID (RDPID)"),
-    (21, "Bit 21: Value of MAWAU used by BNDLDX and BNDSTX instructions in 64-bit mode"),
-    (20, "Bit 20: Value of MAWAU used by BNDLDX and BNDSTX instructions in 64-bit mode"),
-    (19, "Bit 19: Value of MAWAU used by BNDLDX and BNDSTX instructions in 64-bit mode"),
-    (18, "Bit 18: Value of MAWAU used by BNDLDX and BNDSTX instructions in 64-bit mode"),
-    (17, "Bit 17: Value of MAWAU used by BNDLDX and BNDSTX instructions in 64-bit mode"),
-    (16, "Bit 16: 5-level paging (LA57)"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: AVX512 VPOPCNTDQ"),
-    (13, "Bit 13: Total memory encryption (TME) enable"),
-    (12, "Bit 12: AVX512 bitwise algorithms (AVX512BITALG)"),
-    (11, "Bit 11: AVX512 vector neural network instructions (AVX512VNNI)"),
-    (10, "Bit 10: VEX-encoded PCLMUL (VPCL)"),
-    (9,  "Bit  9: VEX-encoded AES-NI (VAES)"),
-    (8,  "Bit  8: Galois field NI / Galois field affine transformation (GFNI)"),
-    (7,  "Bit  7: CET shadow stack (CET SS)"),
-    (6,  "Bit  6: AVX512 VBMI2"),
-    (5,  "Bit  5: Wait and pause enhancements (WAITPKG)"),
-    (4,  "Bit  4: OS support enabled for protection keys (OSPKE)"),
-    (3,  "Bit  3: Supports protection keys for user-mode pages (PKU)"),
-    (2,  "Bit  2: User-mode instruction prevention (UMIP)"),
-    (1,  "Bit  1: AVX512 vector byte manipulation instructions (AVX512VBMI)"),
-    (0,  "Bit  0: PREFETCHWT1"),
-]
-
-# List defining each bit in EDX register from CPUID leaf 7 for Intel platforms
-intel_leaf7_edx_bits = [
-    (31, "Bit 31: Speculative store bypass disable (SSBD)"),
-    (30, "Bit 30: IA32_CORE_CAPABILITIES MSR available"),
-    (29, "Bit 29: IA32_ARCH_CAPABILITIES MSR available"),
-    (28, "Bit 28: L1 data cache (L1D) flush"),
-    (27, "Bit 27: Single thread indirect branch predictors (STIBP)"),
-    (26, "Bit 26: Speculation control (IBRS and IPBP)"),
-    (25, "Bit 25: Tile computation on 8-bit integers (AMX-INT8)"),
-    (24, "Bit 24: Tile architecture (AMX-TILE)"),
-    (23, "Bit 23: AVX512 FP16"),
-    (22, "Bit 22: Tile computation on bfloat16 (AMX-BF16)"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: CET indirect branch tracking (CET IBT)"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Platform configuration instruction (PCONFIG)"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: TSX suspend load address tracking"),
-    (15, "Bit 15: Hybrid architecture"),
-    (14, "Bit 14: SERIALIZE instruction"),
-    (13, "Bit 13: TSX force abort MSR available"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: Reserved"),
-    (10, "Bit 10: Microarchitectural data sampling mitigation (MD_CLEAR)"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: AVX512 VP2INTERSECT dword/qword intersection instructions"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: User interrupts (UINTR)"),
-    (4,  "Bit  4: Fast short REP MOV"),
-    (3,  "Bit  3: AVX512 4FMAPS 4-iteration fused multiply-add"),
-    (2,  "Bit  2: AVX512 4VNNIW 4-iteration dot product with accumulation"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: Reserved"),
-]
-
-# List defining each bit in EBX register from CPUID leaf 0x80000001 for Intel platforms
-intel_leaf80000001_ebx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Reserved"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: Reserved"),
-    (26, "Bit 26: Reserved"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Reserved"),
-    (22, "Bit 22: Reserved"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Reserved"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: Reserved"),
-    (10, "Bit 10: Reserved"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: Reserved"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: Reserved"),
-    (4,  "Bit  4: Reserved"),
-    (3,  "Bit  3: Reserved"),
-    (2,  "Bit  2: Reserved"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: Reserved"),
-]
-
-# List defining each bit in ECX register from CPUID leaf 80000001 for Intel platforms
-intel_leaf80000001_ecx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Reserved"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: Reserved"),
-    (26, "Bit 26: Reserved"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Reserved"),
-    (22, "Bit 22: Reserved"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Reserved"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: Reserved"),
-    (10, "Bit 10: Reserved"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: PREFETCHW"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: LZCNT"),
-    (4,  "Bit  4: Reserved"),
-    (3,  "Bit  3: Reserved"),
-    (2,  "Bit  2: Reserved"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: LAHF/SAHF available in 64-bit mode"),
-]
-
-# List defining each bit in EDX register from CPUID leaf 80000001 for Intel platforms
-intel_leaf80000001_edx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Intel 64 architecture available (EM64T)"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: RDTSCP and IA32_TSC_AUX available"),
-    (26, "Bit 26: 1GB pages available"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Reserved"),
-    (22, "Bit 22: Reserved"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: Execute disable bit (NX) available"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Reserved"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: SYSCALL/SYSRET available in 64-bit mode"),
-    (10, "Bit 10: Reserved"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: Reserved"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: Reserved"),
-    (4,  "Bit  4: Reserved"),
-    (3,  "Bit  3: Reserved"),
-    (2,  "Bit  2: Reserved"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: Reserved"),
-]
-
-# List defining each bit in EBX register from CPUID leaf 1 for AMD platforms
-amd_leaf1_ebx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Reserved"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: Reserved"),
-    (26, "Bit 26: Reserved"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Reserved"),
-    (22, "Bit 22: Reserved"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Reserved"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: Reserved"),
-    (10, "Bit 10: Reserved"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: Reserved"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: Reserved"),
-    (4,  "Bit  4: Reserved"),
-    (3,  "Bit  3: Reserved"),
-    (2,  "Bit  2: Reserved"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: Reserved"),
-]
-
-# List defining each bit in ECX register from CPUID leaf 1 for AMD platforms
-amd_leaf1_ecx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Reserved"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: Reserved"),
-    (26, "Bit 26: Reserved"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Reserved"),
-    (22, "Bit 22: Reserved"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Reserved"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: Reserved"),
-    (10, "Bit 10: Reserved"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: Reserved"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: Reserved"),
-    (4,  "Bit  4: Reserved"),
-    (3,  "Bit  3: Reserved"),
-    (2,  "Bit  2: Reserved"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: Reserved"),
+# CPUID field database compiled from features.def by gen_featuredb.py, mapped on first use
+feature_database = featuredb.FeatureDatabase()
+
+# List defining the allowed-1 bits of IA32_VMX_PINBASED_CTLS (MSR 0x481, high dword) for Intel platforms
+intel_vmx_pinbased_ctls_bits = [
+    (7,  "Bit  7: Process posted interrupts"),
+    (6,  "Bit  6: Activate VMX-preemption timer"),
+    (5,  "Bit  5: Virtual NMIs"),
+    (3,  "Bit  3: NMI exiting"),
+    (0,  "Bit  0: External-interrupt exiting"),
 ]
 
-# List defining each bit in EDX register from CPUID leaf 1 for AMD platforms
-amd_leaf1_edx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Reserved"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: Reserved"),
-    (26, "Bit 26: Reserved"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Reserved"),
-    (22, "Bit 22: Reserved"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Reserved"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: Reserved"),
-    (10, "Bit 10: Reserved"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: Reserved"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: Reserved"),
-    (4,  "Bit  4: Reserved"),
-    (3,  "Bit  3: Reserved"),
-    (2,  "Bit  2: Reserved"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: Reserved"),
+# List defining the allowed-1 bits of IA32_VMX_PROCBASED_CTLS (MSR 0x482, high dword) for Intel platforms
+intel_vmx_procbased_ctls_bits = [
+    (31, "Bit 31: Activate secondary controls"),
+    (30, "Bit 30: PAUSE exiting"),
+    (28, "Bit 28: Use MSR bitmaps"),
+    (25, "Bit 25: Use I/O bitmaps"),
+    (21, "Bit 21: Use TPR shadow"),
+    (17, "Bit 17: Activate tertiary controls"),
+    (7,  "Bit  7: HLT exiting"),
+    (3,  "Bit  3: Use TSC offsetting"),
 ]
 
-# List defining each bit in EBX register from CPUID leaf 7 for AMD platforms
-amd_leaf7_ebx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Reserved"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: Reserved"),
-    (26, "Bit 26: Reserved"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Reserved"),
-    (22, "Bit 22: Reserved"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Reserved"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: Reserved"),
-    (10, "Bit 10: Reserved"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: Reserved"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: Reserved"),
-    (4,  "Bit  4: Reserved"),
-    (3,  "Bit  3: Reserved"),
-    (2,  "Bit  2: Reserved"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: Reserved"),
+# List defining the allowed-1 bits of IA32_VMX_PROCBASED_CTLS2 (MSR 0x48B, high dword) for Intel platforms
+intel_vmx_procbased_ctls2_bits = [
+    (26, "Bit 26: Enable user wait and pause"),
+    (25, "Bit 25: Use TSC scaling"),
+    (22, "Bit 22: Mode-based execute control for EPT"),
+    (20, "Bit 20: Enable XSAVES/XRSTORS"),
+    (18, "Bit 18: EPT-violation #VE"),
+    (17, "Bit 17: Enable page-modification logging (PML)"),
+    (14, "Bit 14: VMCS shadowing"),
+    (13, "Bit 13: Enable VM functions"),
+    (10, "Bit 10: PAUSE-loop exiting"),
+    (9,  "Bit  9: Virtual-interrupt delivery"),
+    (8,  "Bit  8: APIC-register virtualization"),
+    (7,  "Bit  7: Unrestricted guest"),
+    (5,  "Bit  5: Enable VPID"),
+    (4,  "Bit  4: Virtualize x2APIC mode"),
+    (1,  "Bit  1: Enable EPT"),
+    (0,  "Bit  0: Virtualize APIC accesses"),
 ]
 
-# List defining each bit in ECX register from CPUID leaf 7 for AMD platforms
-amd_leaf7_ecx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Reserved"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: Reserved"),
-    (26, "Bit 26: Reserved"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Reserved"),
-    (22, "Bit 22: Reserved"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Reserved"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: Reserved"),
-    (10, "Bit 10: Reserved"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: Reserved"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: Reserved"),
-    (4,  "Bit  4: Reserved"),
-    (3,  "Bit  3: Reserved"),
-    (2,  "Bit  2: Reserved"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: Reserved"),
+# List defining each bit of IA32_VMX_EPT_VPID_CAP (MSR 0x48C) for Intel platforms
+intel_vmx_ept_vpid_cap_bits = [
+    (43, "Bit 43: Single-context-retaining-globals INVVPID"),
+    (42, "Bit 42: All-context INVVPID"),
+    (41, "Bit 41: Single-context INVVPID"),
+    (40, "Bit 40: Individual-address INVVPID"),
+    (32, "Bit 32: INVVPID instruction"),
+    (26, "Bit 26: All-context INVEPT"),
+    (25, "Bit 25: Single-context INVEPT"),
+    (22, "Bit 22: Advanced VM-exit information for EPT violations"),
+    (21, "Bit 21: Accessed and dirty flags for EPT"),
+    (20, "Bit 20: INVEPT instruction"),
+    (17, "Bit 17: EPT 1GB pages"),
+    (16, "Bit 16: EPT 2MB pages"),
+    (14, "Bit 14: Write-back EPT paging structures"),
+    (8,  "Bit  8: Uncacheable EPT paging structures"),
+    (7,  "Bit  7: 5-level EPT page walk"),
+    (6,  "Bit  6: 4-level EPT page walk"),
+    (0,  "Bit  0: Execute-only EPT translations"),
 ]
 
-# List defining each bit in EDX register from CPUID leaf 7 for AMD platforms
-amd_leaf7_edx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Reserved"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: Reserved"),
-    (26, "Bit 26: Reserved"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Reserved"),
-    (22, "Bit 22: Reserved"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Reserved"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: Reserved"),
-    (10, "Bit 10: Reserved"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: Reserved"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: Reserved"),
-    (4,  "Bit  4: Reserved"),
-    (3,  "Bit  3: Reserved"),
-    (2,  "Bit  2: Reserved"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: Reserved"),
+# List of features a hypervisor commonly hides from guests, ranked by likely performance impact (10 = highest)
+# Each entry is (feature, leaf, subleaf, register, bit, impact, QEMU/libvirt feature name)
+passthrough_feature_list = [
+    ("AVX-512 Foundation (AVX512F)",             0x00000007, 0, "ebx", 16, 10, "avx512f"),
+    ("AVX-512 Byte and Word (AVX512BW)",         0x00000007, 0, "ebx", 30, 9,  "avx512bw"),
+    ("AVX-512 Doubleword and Quadword (AVX512DQ)", 0x00000007, 0, "ebx", 17, 9, "avx512dq"),
+    ("AVX-512 Vector Length (AVX512VL)",         0x00000007, 0, "ebx", 31, 9,  "avx512vl"),
+    ("AVX-512 Conflict Detection (AVX512CD)",    0x00000007, 0, "ebx", 28, 7,  "avx512cd"),
+    ("AVX-512 VNNI",                             0x00000007, 0, "ecx", 11, 8,  "avx512vnni"),
+    ("AVX-512 BF16",                             0x00000007, 1, "eax", 5,  7,  "avx512-bf16"),
+    ("AVX-512 FP16",                             0x00000007, 0, "edx", 23, 7,  "avx512-fp16"),
+    ("AVX-512 VBMI",                             0x00000007, 0, "ecx", 1,  6,  "avx512vbmi"),
+    ("AVX-512 VBMI2",                            0x00000007, 0, "ecx", 6,  6,  "avx512vbmi2"),
+    ("AVX-512 BITALG",                           0x00000007, 0, "ecx", 12, 5,  "avx512bitalg"),
+    ("AVX-512 VPOPCNTDQ",                        0x00000007, 0, "ecx", 14, 5,  "avx512-vpopcntdq"),
+    ("AVX-512 IFMA",                             0x00000007, 0, "ebx", 21, 5,  "avx512ifma"),
+    ("AMX Tile (AMX-TILE)",                      0x00000007, 0, "edx", 24, 8,  "amx-tile"),
+    ("AMX INT8",                                 0x00000007, 0, "edx", 25, 7,  "amx-int8"),
+    ("AMX BF16",                                 0x00000007, 0, "edx", 22, 7,  "amx-bf16"),
+    ("AVX2",                                     0x00000007, 0, "ebx", 5,  10, "avx2"),
+    ("Fused multiply-add (FMA3)",                0x00000001, 0, "ecx", 12, 9,  "fma"),
+    ("AVX",                                      0x00000001, 0, "ecx", 28, 9,  "avx"),
+    ("AVX-VNNI",                                 0x00000007, 1, "eax", 4,  6,  "avx-vnni"),
+    ("Process context identifiers (PCID)",       0x00000001, 0, "ecx", 17, 9,  "pcid"),
+    ("INVPCID instruction",                      0x00000007, 0, "ebx", 10, 9,  "invpcid"),
+    ("TSC deadline timer (TSC-DEADLINE)",        0x00000001, 0, "ecx", 24, 8,  "tsc-deadline"),
+    ("x2APIC",                                   0x00000001, 0, "ecx", 21, 7,  "x2apic"),
+    ("Invariant TSC",                            0x80000007, 0, "edx", 8,  8,  "invtsc"),
+    ("Always running APIC timer (ARAT)",         0x00000006, 0, "eax", 2,  5,  "arat"),
+    ("Fast short REP MOV (FSRM)",                0x00000007, 0, "edx", 4,  7,  "fsrm"),
+    ("Enhanced REP MOVSB/STOSB (ERMS)",          0x00000007, 0, "ebx", 9,  7,  "erms"),
+    ("1GB pages",                                0x80000001, 0, "edx", 26, 7,  "pdpe1gb"),
+    ("5-level paging (LA57)",                    0x00000007, 0, "ecx", 16, 3,  "la57"),
+    ("AES instruction set (AES-NI)",             0x00000001, 0, "ecx", 25, 8,  "aes"),
+    ("VEX-encoded AES-NI (VAES)",                0x00000007, 0, "ecx", 9,  6,  "vaes"),
+    ("Carry-less multiply (PCLMULQDQ)",          0x00000001, 0, "ecx", 1,  7,  "pclmulqdq"),
+    ("VEX-encoded PCLMUL (VPCLMULQDQ)",          0x00000007, 0, "ecx", 10, 6,  "vpclmulqdq"),
+    ("SHA extensions",                           0x00000007, 0, "ebx", 29, 6,  "sha-ni"),
+    ("Galois field NI (GFNI)",                   0x00000007, 0, "ecx", 8,  5,  "gfni"),
+    ("BMI1",                                     0x00000007, 0, "ebx", 3,  6,  "bmi1"),
+    ("BMI2",                                     0x00000007, 0, "ebx", 8,  6,  "bmi2"),
+    ("Multi-precision add-carry (ADX)",          0x00000007, 0, "ebx", 19, 5,  "adx"),
+    ("POPCNT instruction",                       0x00000001, 0, "ecx", 23, 6,  "popcnt"),
+    ("LZCNT instruction (ABM)",                  0x80000001, 0, "ecx", 5,  5,  "abm"),
+    ("MOVBE instruction",                        0x00000001, 0, "ecx", 22, 4,  "movbe"),
+    ("SSE4.2",                                   0x00000001, 0, "ecx", 20, 8,  "sse4.2"),
+    ("SSE4.1",                                   0x00000001, 0, "ecx", 19, 7,  "sse4.1"),
+    ("F16C",                                     0x00000001, 0, "ecx", 29, 4,  "f16c"),
+    ("RDRAND",                                   0x00000001, 0, "ecx", 30, 4,  "rdrand"),
+    ("RDSEED",                                   0x00000007, 0, "ebx", 18, 3,  "rdseed"),
+    ("XSAVEOPT",                                 0x0000000D, 1, "eax", 0,  4,  "xsaveopt"),
+    ("XSAVEC",                                   0x0000000D, 1, "eax", 1,  4,  "xsavec"),
+    ("XSAVES/XRSTORS",                           0x0000000D, 1, "eax", 3,  4,  "xsaves"),
+    ("FSGSBASE instructions",                    0x00000007, 0, "ebx", 0,  5,  "fsgsbase"),
+    ("RDTSCP",                                   0x80000001, 0, "edx", 27, 5,  "rdtscp"),
+    ("RDPID",                                    0x00000007, 0, "ecx", 22, 4,  "rdpid"),
+    ("CLFLUSHOPT",                               0x00000007, 0, "ebx", 23, 4,  "clflushopt"),
+    ("CLWB",                                     0x00000007, 0, "ebx", 24, 4,  "clwb"),
+    ("MOVDIRI",                                  0x00000007, 0, "ecx", 27, 3,  "movdiri"),
+    ("MOVDIR64B",                                0x00000007, 0, "ecx", 28, 3,  "movdir64b"),
+    ("SERIALIZE instruction",                    0x00000007, 0, "edx", 14, 3,  "serialize"),
+    ("Wait and pause enhancements (WAITPKG)",    0x00000007, 0, "ecx", 5,  4,  "waitpkg"),
+    ("Protection keys for user-mode pages (PKU)", 0x00000007, 0, "ecx", 3, 3,  "pku"),
+    ("PREFETCHW instruction",                    0x80000001, 0, "ecx", 8,  3,  "3dnowprefetch"),
+    ("Virtual Machine eXtensions (VMX)",         0x00000001, 0, "ecx", 5,  2,  "vmx"),
+    ("Secure Virtual Machine (SVM)",             0x80000001, 0, "ecx", 2,  2,  "svm"),
 ]
 
-# List defining each bit in EBX register from CPUID leaf 0x80000001 for AMD platforms
-amd_leaf80000001_ebx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Reserved"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: Reserved"),
-    (26, "Bit 26: Reserved"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Reserved"),
-    (22, "Bit 22: Reserved"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Reserved"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: Reserved"),
-    (10, "Bit 10: Reserved"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: Reserved"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: Reserved"),
-    (4,  "Bit  4: Reserved"),
-    (3,  "Bit  3: Reserved"),
-    (2,  "Bit  2: Reserved"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: Reserved"),
+# Microarchitecture of each family/model range reported by leaf 1
+# Each entry is (vendor, family, first model, last model, microarchitecture, timing reference)
+uarch_model_list = [
+    ("intel", 0x06, 0x3C, 0x3C, "Haswell",                 "Haswell / Broadwell"),
+    ("intel", 0x06, 0x3F, 0x3F, "Haswell-E/EP",            "Haswell / Broadwell"),
+    ("intel", 0x06, 0x45, 0x46, "Haswell",                 "Haswell / Broadwell"),
+    ("intel", 0x06, 0x3D, 0x3D, "Broadwell",               "Haswell / Broadwell"),
+    ("intel", 0x06, 0x47, 0x47, "Broadwell",               "Haswell / Broadwell"),
+    ("intel", 0x06, 0x4F, 0x4F, "Broadwell-E/EP",          "Haswell / Broadwell"),
+    ("intel", 0x06, 0x56, 0x56, "Broadwell-DE",            "Haswell / Broadwell"),
+    ("intel", 0x06, 0x4E, 0x4E, "Skylake",                 "Skylake"),
+    ("intel", 0x06, 0x5E, 0x5E, "Skylake",                 "Skylake"),
+    ("intel", 0x06, 0x55, 0x55, "Skylake-SP/Cascade Lake", "Skylake-SP"),
+    ("intel", 0x06, 0x8E, 0x8E, "Kaby/Coffee/Whiskey Lake", "Skylake"),
+    ("intel", 0x06, 0x9E, 0x9E, "Kaby/Coffee Lake",        "Skylake"),
+    ("intel", 0x06, 0xA5, 0xA6, "Comet Lake",              "Skylake"),
+    ("intel", 0x06, 0x7D, 0x7E, "Ice Lake",                "Sunny Cove (client)"),
+    ("intel", 0x06, 0xA7, 0xA7, "Rocket Lake",             "Sunny Cove (client)"),
+    ("intel", 0x06, 0x6A, 0x6C, "Ice Lake-SP",             "Sunny/Willow Cove (1.25 MB L2)"),
+    ("intel", 0x06, 0x8C, 0x8D, "Tiger Lake",              "Sunny/Willow Cove (1.25 MB L2)"),
+    ("intel", 0x06, 0x97, 0x97, "Alder Lake",              "Golden Cove (1.25 MB L2)"),
+    ("intel", 0x06, 0x9A, 0x9A, "Alder Lake",              "Golden Cove (1.25 MB L2)"),
+    ("intel", 0x06, 0xB7, 0xB7, "Raptor Lake",             "Golden/Raptor/Redwood Cove (2 MB L2)"),
+    ("intel", 0x06, 0xBA, 0xBA, "Raptor Lake",             "Golden/Raptor/Redwood Cove (2 MB L2)"),
+    ("intel", 0x06, 0xBF, 0xBF, "Raptor Lake",             "Golden/Raptor/Redwood Cove (2 MB L2)"),
+    ("intel", 0x06, 0x8F, 0x8F, "Sapphire Rapids",         "Golden/Raptor/Redwood Cove (2 MB L2)"),
+    ("intel", 0x06, 0xCF, 0xCF, "Emerald Rapids",          "Golden/Raptor/Redwood Cove (2 MB L2)"),
+    ("intel", 0x06, 0xAA, 0xAC, "Meteor Lake",             "Golden/Raptor/Redwood Cove (2 MB L2)"),
+    ("intel", 0x06, 0xAD, 0xAE, "Granite Rapids",          "Golden/Raptor/Redwood Cove (2 MB L2)"),
+    ("intel", 0x06, 0xBE, 0xBE, "Alder Lake-N",            "Gracemont"),
+    ("intel", 0x06, 0xAF, 0xAF, "Sierra Forest",           "Gracemont"),
+    ("amd",   0x17, 0x00, 0x2F, "Zen/Zen+",                "Zen / Zen+ / Zen 2"),
+    ("amd",   0x17, 0x30, 0xAF, "Zen 2",                   "Zen / Zen+ / Zen 2"),
+    ("amd",   0x19, 0x00, 0x0F, "Zen 3",                   "Zen 3"),
+    ("amd",   0x19, 0x20, 0x5F, "Zen 3",                   "Zen 3"),
+    ("amd",   0x19, 0x10, 0x1F, "Zen 4",                   "Zen 4"),
+    ("amd",   0x19, 0x60, 0xAF, "Zen 4",                   "Zen 4"),
+    ("amd",   0x1A, 0x00, 0x7F, "Zen 5",                   "Zen 5"),
 ]
 
-# List defining each bit in ECX register from CPUID leaf 0x80000001 for AMD platforms
-amd_leaf80000001_ecx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Breakpoint Addressing Masking (AddrMaskExt)"),
-    (29, "Bit 29: MWAITX and MONITORX capability (MONITORX)"),
-    (28, "Bit 28: L3 Performance Counter Extensions (PerfCtrExtLLC)"),
-    (27, "Bit 27: Performance Time-Stamp Counter (PerfTsc)"),
-    (26, "Bit 26: Data Breakpoint Extension (DataBkptExt)"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: NB performance counter extensions support (PerfCtrExtNB)"),
-    (23, "Bit 23: Processor performance counter extensions (PerfCtrExtCore)"),
-    (22, "Bit 22: Topology extensions support"),
-    (21, "Bit 21: Trailing bit manipulation instruction support (TBM)"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Translation Cache Extension support (TCE)"),
-    (16, "Bit 16: Four-operand FMA instruction support (FMA4)"),
-    (15, "Bit 15: Lightweight profiling support (LWP)"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Watchdog Timer support"),
-    (12, "Bit 12: SKINIT and STGI are support (SKINIT)"),
-    (11, "Bit 11: Extended operation support (XOP)"),
-    (10, "Bit 10: Instruction based sampling (IBS)"),
-    (9, "Bit  9: OS visible workaround (OSVW)"),
-    (8, "Bit  8: PREFETCH and PREFETCHW instructions (3DNowPrefetch)"),
-    (7, "Bit  7: Misaligned SSE mode support (MisAlignSse)"),
-    (6, "Bit  6: EXTRQ, INSERTQ, MOVNTSS, and MOVNTSD instructions (SSE4A)"),
-    (5, "Bit  5: LZCNT instruction support (ABM)"),
-    (4, "Bit  4: LOCK MOV CR0 means MOV CR8 (AltMovCr8)"),
-    (3, "Bit  3: Extended APIC space (ExtApicSpace)"),
-    (2, "Bit  2: Secure Virtual Mode feature (SVM)"),
-    (1, "Bit  1: Core multi-processing legacy mode (CmpLegacy)"),
-    (0, "Bit  0: LAHF and SAHF instructions in 64-bit mode (LahfSahf)"),
+# Approximate published core parameters used to recognise a core by timing, None where no figure is known
+# L1D and L2 latencies are in core cycles for a simple pointer chase, PAUSE in core cycles
+# Each entry is (timing reference, L1D KB, L1D latency, L2 KB, L2 latency, PAUSE, loads/cycle, ALU ops/cycle, L1 DTLB entries)
+uarch_timing_list = [
+    ("Haswell / Broadwell",                  32, 4, 256,  12, 10,   2, 4, 64),
+    ("Skylake",                              32, 4, 256,  12, 140,  2, 4, 64),
+    ("Skylake-SP",                           32, 4, 1024, 14, 140,  2, 4, 64),
+    ("Sunny Cove (client)",                  48, 5, 512,  13, None,  2, 4, 64),
+    ("Sunny/Willow Cove (1.25 MB L2)",       48, 5, 1280, 14, None,  2, 4, 64),
+    ("Golden Cove (1.25 MB L2)",             48, 5, 1280, 15, None,  3, 5, 96),
+    ("Golden/Raptor/Redwood Cove (2 MB L2)", 48, 5, 2048, 16, None,  3, 5, 96),
+    ("Gracemont",                            32, 3, 2048, 17, None, 2, 4, 32),
+    ("Zen / Zen+ / Zen 2",                   32, 4, 512,  12, None, 2, 4, 64),
+    ("Zen 3",                                32, 4, 512,  12, None, 3, 4, 64),
+    ("Zen 4",                                32, 4, 1024, 14, None, 3, 4, 72),
+    ("Zen 5",                                48, 4, 1024, 14, None, 4, 6, 96),
 ]
 
-# List defining each bit in EDX register from CPUID leaf 0x80000001 for AMD platforms
-amd_leaf80000001_edx_bits = [
-    (31, "Bit 31: Reserved"),
-    (30, "Bit 30: Reserved"),
-    (29, "Bit 29: Reserved"),
-    (28, "Bit 28: Reserved"),
-    (27, "Bit 27: Reserved"),
-    (26, "Bit 26: Reserved"),
-    (25, "Bit 25: Reserved"),
-    (24, "Bit 24: Reserved"),
-    (23, "Bit 23: Reserved"),
-    (22, "Bit 22: Reserved"),
-    (21, "Bit 21: Reserved"),
-    (20, "Bit 20: Reserved"),
-    (19, "Bit 19: Reserved"),
-    (18, "Bit 18: Reserved"),
-    (17, "Bit 17: Reserved"),
-    (16, "Bit 16: Reserved"),
-    (15, "Bit 15: Reserved"),
-    (14, "Bit 14: Reserved"),
-    (13, "Bit 13: Reserved"),
-    (12, "Bit 12: Reserved"),
-    (11, "Bit 11: Reserved"),
-    (10, "Bit 10: Reserved"),
-    (9,  "Bit  9: Reserved"),
-    (8,  "Bit  8: Reserved"),
-    (7,  "Bit  7: Reserved"),
-    (6,  "Bit  6: Reserved"),
-    (5,  "Bit  5: Reserved"),
-    (4,  "Bit  4: Reserved"),
-    (3,  "Bit  3: Reserved"),
-    (2,  "Bit  2: Reserved"),
-    (1,  "Bit  1: Reserved"),
-    (0,  "Bit  0: Reserved"),
+# Approximate published out-of-order window sizes, None where no figure is known
+# Each entry is (timing reference, reorder buffer entries, load buffer entries, store buffer entries)
+uarch_window_list = [
+    ("Haswell / Broadwell",                  192, 72,   42),
+    ("Skylake",                              224, 72,   56),
+    ("Skylake-SP",                           224, 72,   56),
+    ("Sunny Cove (client)",                  352, 128,  72),
+    ("Sunny/Willow Cove (1.25 MB L2)",       352, 128,  72),
+    ("Golden Cove (1.25 MB L2)",             512, 192,  114),
+    ("Golden/Raptor/Redwood Cove (2 MB L2)", 512, 192,  114),
+    ("Gracemont",                            256, None, None),
+    ("Zen / Zen+ / Zen 2",                   None, None, None),
+    ("Zen 3",                                256, None, 64),
+    ("Zen 4",                                320, None, 64),
+    ("Zen 5",                                448, None, None),
 ]
 
 # Ensure GCC is used
 os.environ['CC'] = 'gcc'
 
 def compile_and_load_cpuid():
+    # Replayed snapshots need no native code
+    if replay_registers is not None:
+        return
+
     ffi.cdef("""
         void cpuid(uint32_t func, uint32_t subfunc, uint32_t *eax, uint32_t *ebx, uint32_t *ecx, uint32_t *edx);
     """,override=True)
@@ -950,16 +507,367 @@ void cpuid(uint32_t func, uint32_t subfunc, uint32_t *eax, uint32_t *ebx, uint32
     os.remove('cpuid.c')
     os.remove('cpuid.dylib')
 
+def compile_and_load_native(name, cdef, c_code):
+    """Compiles C source into a shared library named after the probe and loads it, returns None on failure."""
+    ffi.cdef(cdef, override=True)
+
+    with open(f'{name}.c', 'w') as f:
+        f.write(c_code)
+
+    # Probes are timing sensitive so they are always built with optimizations
+    status = os.system(f'gcc -O2 -shared -o {name}.dylib -fPIC {name}.c -lpthread' if os.name == 'posix' else f'cl /O2 /LD {name}.c')
+
+    lib = None
+    if status == 0:
+        lib = ffi.dlopen(f'./{name}.dylib')
+
+    # Clean up generated files
+    for generated in (f'{name}.c', f'{name}.dylib'):
+        if os.path.exists(generated):
+            os.remove(generated)
+
+    return lib
+
+def ffi_new(cdecl, init=None):
+    """Allocates C memory with ffi.new, counting the allocation while profiling is enabled."""
+    if profile_enabled:
+        profile_counters["ffi_allocations"] += 1
+    return ffi.new(cdecl, init)
+
 # Define a function to call the cpuid function from the shared library
 def call_cpuid(func, subfunc):
     """A wrapper that lets you call cpudid with a leaf and subleaf value, returns various EXX values."""
-    eax = ffi.new("uint32_t *")
-    ebx = ffi.new("uint32_t *")
-    ecx = ffi.new("uint32_t *")
-    edx = ffi.new("uint32_t *")
+    if replay_registers is not None:
+        values = replay_registers.get((func, subfunc))
+        if values is None:
+            # Leaves without subleaves answer every subleaf like subleaf 0, the rest return zeros past the end
+            values = replay_registers.get((func, 0), (0, 0, 0, 0)) if func in replay_subleafless else (0, 0, 0, 0)
+        return values
+
+    eax = ffi_new("uint32_t *")
+    ebx = ffi_new("uint32_t *")
+    ecx = ffi_new("uint32_t *")
+    edx = ffi_new("uint32_t *")
+    if profile_enabled:
+        profile_counters["cpuid_instructions"] += 1
     cpuid_lib.cpuid(func, subfunc, eax, ebx, ecx, edx)
     return eax[0], ebx[0], ecx[0], edx[0]
 
+def start_replay(snapshot):
+    """Makes call_cpuid answer from a snapshot dictionary, per-CPU leaves are replayed by capture_cpuid_snapshot."""
+    global replay_registers, replay_cpus, replay_subleafless
+    # CPUs mostly report identical leaves, so equal register tuples are stored once
+    shared = {}
+    replay_registers = snapshot_registers(snapshot, shared)
+    replay_cpus = {int(cpu): snapshot_registers({"leaves": leaves}, shared) for cpu, leaves in snapshot.get("cpus", {}).items()}
+    subleaves = {}
+    for leaf, subleaf in replay_registers:
+        subleaves.setdefault(leaf, set()).add(subleaf)
+    replay_subleafless = {leaf for leaf, found in subleaves.items() if found == {0}}
+
+def stop_replay():
+    """Returns call_cpuid to the CPUID instruction."""
+    global replay_registers, replay_cpus
+    replay_registers = None
+    replay_cpus = None
+
+def get_cpu_vendor():
+    """Returns the 12 character vendor string reported by CPUID leaf 0."""
+    eax, ebx, ecx, edx = call_cpuid(0, 0)
+    return b"".join(reg.to_bytes(4, byteorder='little') for reg in (ebx, edx, ecx)).decode('ascii', errors='replace')
+
+def load_msr_replay_file(path):
+    """Loads a JSON object mapping MSR addresses to values, e.g. {"0x480": "0xDA040000000012"}."""
+    global msr_replay_table
+    with open(path) as f:
+        raw = json.load(f)
+    if not isinstance(raw, dict):
+        raise ValueError("expected an object mapping MSR addresses to values")
+    table = {}
+    for msr, value in raw.items():
+        try:
+            table[int(str(msr), 0)] = int(str(value), 0)
+        except ValueError:
+            raise ValueError(f"bad entry {msr!r}: {value!r}") from None
+    msr_replay_table = table
+    return msr_replay_table
+
+def read_msr(msr, cpu=0):
+    """Reads an MSR from the replay table or the Linux msr module, returns None if unavailable."""
+    if msr_replay_table is not None:
+        return msr_replay_table.get(msr)
+
+    try:
+        fd = os.open(f"/dev/cpu/{cpu}/msr", os.O_RDONLY)
+    except OSError:
+        return None
+
+    try:
+        data = os.pread(fd, 8, msr)
+    except OSError:
+        return None
+    finally:
+        os.close(fd)
+
+    if len(data) != 8:
+        return None
+    return int.from_bytes(data, byteorder='little')
+
+def print_bit_list(title, value, bit_list, num_bits=32):
+    """Prints each described bit of a value, green when set and red when clear."""
+    binary = f"{value:0{num_bits}b}"
+    click.echo(title)
+    for bit_index, description in bit_list:
+        bit_value = binary[num_bits - 1 - bit_index]
+        colored_value = colored_binary_value(binary, num_bits - 1 - bit_index)
+        if bit_value == '0':
+            colored_desc = click.style(description, fg='red')
+        else:
+            colored_desc = click.style(description, fg='green', bold=True)
+        click.echo(f"{colored_value} - {colored_desc}")
+    click.echo()
+
+def feature_bits(vendor, leaf, subleaf, register):
+    """Expands the database fields of a register into (bit, "Bit N: description") pairs, bit 31 first."""
+    names = {}
+    handle = feature_database.registers(vendor, leaf, subleaf).get(register)
+    if handle is not None:
+        for lsb, width, mnemonic, name in feature_database.fields(handle):
+            for bit_index in range(lsb, lsb + width):
+                names[bit_index] = name
+    return [(bit_index, f"Bit {bit_index:2d}: {names.get(bit_index, 'Reserved')}") for bit_index in range(31, -1, -1)]
+
+class ProfiledPhase:
+    """
+    Context manager that records wall and CPU time for a named phase while profiling is enabled.
+
+    Every call becomes a trace event unless traced is False. Hot phases such as single CPUID calls or
+    stdout writes run millions of times in a batch, so they are only aggregated into the phase totals.
+    """
+
+    def __init__(self, name, traced=True):
+        self.name = name
+        self.traced = traced
+
+    def __enter__(self):
+        self.wall_start = time.perf_counter()
+        self.cpu_start = time.process_time()
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        if not profile_enabled:
+            return False
+        wall = time.perf_counter() - self.wall_start
+        cpu = time.process_time() - self.cpu_start
+        calls, total_wall, total_cpu = profile_phases.get(self.name, (0, 0.0, 0.0))
+        profile_phases[self.name] = (calls + 1, total_wall + wall, total_cpu + cpu)
+        if self.traced:
+            profile_events.append((self.name, self.wall_start, wall, cpu))
+        return False
+
+class ProfiledWriter:
+    """Wraps an output stream to count bytes written and time spent rendering to it."""
+
+    def __init__(self, stream):
+        self.stream = stream
+
+    def write(self, data):
+        with ProfiledPhase("render (stdout writes)", traced=False):
+            profile_counters["bytes_written"] += len(data.encode('utf-8', errors='replace')) if isinstance(data, str) else len(data)
+            return self.stream.write(data)
+
+    def __getattr__(self, name):
+        return getattr(self.stream, name)
+
+def read_energy_counters():
+    """
+    Reads the cumulative energy counters of the powercap RAPL zones and of the amd_energy hwmon driver.
+
+    Returns:
+        dict: domain name to (microjoules, wrap range in microjoules). Domains whose counters are missing or
+        unreadable, recent kernels restricting energy_uj to root, are left out.
+    """
+    counters = {}
+    powercap = "/sys/class/powercap"
+    if os.path.isdir(powercap):
+        for zone in sorted(os.listdir(powercap)):
+            if not zone.startswith("intel-rapl:"):
+                continue
+            energy = read_sysfs_value(f"{powercap}/{zone}/energy_uj", None)
+            if energy is None or not energy.isdigit():
+                continue
+            # Subzones (intel-rapl:P:N) are named after their domain only, so prefix the package
+            name = read_sysfs_value(f"{powercap}/{zone}/name", zone)
+            parts = zone.split(":")
+            if len(parts) > 2:
+                name = f"package-{parts[1]}/{name}"
+            energy_range = int(read_sysfs_value(f"{powercap}/{zone}/max_energy_range_uj", "0") or 0) or 1 << 32
+            counters[name] = (int(energy), energy_range)
+
+    hwmon = "/sys/class/hwmon"
+    if os.path.isdir(hwmon):
+        for device in sorted(os.listdir(hwmon)):
+            if read_sysfs_value(f"{hwmon}/{device}/name", "") != "amd_energy":
+                continue
+            for entry in sorted(os.listdir(f"{hwmon}/{device}")):
+                if not (entry.startswith("energy") and entry.endswith("_input")):
+                    continue
+                energy = read_sysfs_value(f"{hwmon}/{device}/{entry}", None)
+                if energy is None or not energy.isdigit():
+                    continue
+                label = read_sysfs_value(f"{hwmon}/{device}/{entry[:-len('_input')]}_label", entry)
+                counters[label] = (int(energy), 1 << 64)
+    return counters
+
+def count_benchmark_ops(ops, unit):
+    """Adds ops operations of a unit (e.g. "atomic operations") to the running energy meter, if any."""
+    if active_energy_meter is not None:
+        active_energy_meter.ops[unit] = active_energy_meter.ops.get(unit, 0) + ops
+
+class EnergyMeter:
+    """
+    Context manager that samples the energy counters around the measured sections of a benchmark and reports
+    joules and ops per joule.
+
+    Wrap only the measured code, after prompts and probe compilation. Entering the meter again adds the next
+    section to the same totals, so a benchmark with several sections reports once.
+    """
+
+    def __init__(self):
+        self.ops = {}
+        self.elapsed = 0.0
+        self.joules = {}
+        self.sections = 0
+
+    def __enter__(self):
+        global active_energy_meter
+        self.start_counters = read_energy_counters()
+        self.start = time.perf_counter()
+        active_energy_meter = self
+        return self
+
+    def __exit__(self, exc_type, exc_value, traceback):
+        global active_energy_meter
+        active_energy_meter = None
+        self.elapsed += time.perf_counter() - self.start
+        self.sections += 1
+        end_counters = read_energy_counters()
+        for name, (start_uj, energy_range) in self.start_counters.items():
+            if name in end_counters:
+                delta = end_counters[name][0] - start_uj
+                self.joules[name] = self.joules.get(name, 0.0) + (delta + energy_range if delta < 0 else delta) / 1e6
+        return False
+
+    def report(self):
+        if not self.sections:
+            return
+        if not self.joules:
+            click.echo("Energy: no readable RAPL counters (/sys/class/powercap intel-rapl or amd_energy), not measured.")
+            click.echo()
+            return
+
+        click.echo(f"Energy over {self.elapsed:.2f} s:")
+        for name, joules in self.joules.items():
+            click.echo("  {:<24} {:>10.2f} J {:>9.2f} W".format(name, joules, joules / self.elapsed if self.elapsed > 0 else 0))
+
+        # Operations per joule of the whole package, or of the first domain when no package domain is readable
+        packages = [joules for name, joules in self.joules.items() if (name.startswith("package") and "/" not in name) or name.startswith("Esocket")]
+        total = sum(packages) if packages else next(iter(self.joules.values()))
+        for unit, ops in self.ops.items():
+            if total > 0:
+                click.echo(f"  {ops:,} {unit}, {ops / total:,.0f} per joule")
+        if not self.ops:
+            click.echo("  Mixed probes without a common unit, operations per joule not reported.")
+        click.echo()
+
+def profiled(name, func, traced=True):
+    """Returns a wrapper around func that records each call as a profiler phase (see ProfiledPhase for traced)."""
+    @functools.wraps(func)
+    def wrapper(*args, **kwargs):
+        with ProfiledPhase(name, traced):
+            return func(*args, **kwargs)
+    return wrapper
+
+def enable_profiling():
+    """
+    Turns on the phase profiler by wrapping the instrumented functions.
+
+    CPUID instructions and FFI allocations are counted by call_cpuid and ffi_new themselves, and bytes
+    written by the ProfiledWriter main() puts around stdout for the run.
+    """
+    global profile_enabled, profile_start, call_cpuid, compile_and_load_cpuid, compile_and_load_native
+    global probe_max_subleaf, max_leaf, decode_register, capture_cpuid_snapshot, batch_decode_registers
+    global feature_bits, print_bit_list
+    if profile_enabled:
+        return
+    profile_enabled = True
+    profile_start = time.perf_counter()
+
+    # Rebinding the module globals instrument every caller without costing anything when profiling is off
+    compile_and_load_cpuid = profiled("compile_and_load_cpuid", compile_and_load_cpuid)
+    compile_and_load_native = profiled("compile_and_load_native", compile_and_load_native)
+    probe_max_subleaf = profiled("probe_max_subleaf", probe_max_subleaf)
+    max_leaf = profiled("max_leaf", max_leaf)
+    decode_register = profiled("decode", decode_register)
+    # The interactive leaf views decode through the feature database and print bit lists
+    feature_bits = profiled("decode", feature_bits)
+    print_bit_list = profiled("render (bit lists)", print_bit_list)
+    capture_cpuid_snapshot = profiled("capture_cpuid_snapshot", capture_cpuid_snapshot)
+    batch_decode_registers = profiled("batch_decode_registers", batch_decode_registers)
+    call_cpuid = profiled("cpuid", call_cpuid, traced=False)
+
+def reset_profile():
+    """Clears the recorded phases and counters and restarts the profile clock."""
+    global profile_start
+    profile_start = time.perf_counter()
+    profile_events.clear()
+    profile_phases.clear()
+    for counter in profile_counters:
+        profile_counters[counter] = 0
+
+def print_profile_summary(stream=None):
+    """Prints the time spent per phase and the profiler counters."""
+    stream = stream or sys.stderr
+    total_wall = time.perf_counter() - profile_start
+
+    click.echo("\nChipInspect Profile:", file=stream)
+    click.echo("{:<28} {:>10} {:>12} {:>12} {:>8}".format("Phase", "Calls", "Wall (ms)", "CPU (ms)", "Wall %"), file=stream)
+    click.echo("-" * 74, file=stream)
+    for name, (calls, wall, cpu) in sorted(profile_phases.items(), key=lambda item: -item[1][1]):
+        percent = wall / total_wall * 100 if total_wall > 0 else 0
+        click.echo("{:<28} {:>10} {:>12.2f} {:>12.2f} {:>7.1f}%".format(name, calls, wall * 1000, cpu * 1000, percent), file=stream)
+    click.echo("{:<28} {:>10} {:>12.2f}".format("total", "", total_wall * 1000), file=stream)
+    click.echo(file=stream)
+    click.echo(f"CPUID instructions issued: {profile_counters['cpuid_instructions']}", file=stream)
+    click.echo(f"FFI allocations: {profile_counters['ffi_allocations']}", file=stream)
+    click.echo(f"Bytes written to stdout: {profile_counters['bytes_written']}", file=stream)
+
+def write_profile_trace(path):
+    """Writes the recorded phases as a Chrome trace (chrome://tracing or Perfetto) JSON file."""
+    pid = os.getpid()
+    events = [
+        {
+            "name": name,
+            "ph": "X",
+            "ts": (start - profile_start) * 1e6,
+            "dur": wall * 1e6,
+            "pid": pid,
+            "tid": 1,
+            "args": {"cpu_ms": cpu * 1000},
+        }
+        for name, start, wall, cpu in profile_events
+    ]
+    events.append({
+        "name": "counters",
+        "ph": "C",
+        "ts": (time.perf_counter() - profile_start) * 1e6,
+        "pid": pid,
+        "tid": 1,
+        "args": dict(profile_counters),
+    })
+    with open(path, 'w') as f:
+        json.dump({"traceEvents": events, "displayTimeUnit": "ms"}, f)
+
 def print_bits(value, num_bits):
     """Prints the bit representation of a value with colored output."""
     bit_str = ''.join(str((value >> i) & 1) for i in range(num_bits - 1, -1, -1))
@@ -1193,598 +1101,4476 @@ def generate_raw_table():
             print(f"{leaf:08X}.0{print_subleaf(subleaf)}    "
                   f"{eax:08X}  {ebx:08X}  {ecx:08X}  {edx:08X}")
 
-def get_host_os():
-    """
-    Determine the host operating system.
+def capture_cpuid_leaves():
+    """Captures every valid leaf and subleaf of the current CPU, keyed by leaf.subleaf like the raw table."""
+    max_basic_leaf, _, _, _ = call_cpuid(0, 0)
+    max_extended_leaf, _, _, _ = call_cpuid(0x80000000, 0)
+    _, _, leaf1_ecx, _ = call_cpuid(1, 0)
+    max_hypervisor_leaf = call_cpuid(0x40000000, 0)[0] if leaf1_ecx & (1 << 31) else 0
 
-    Returns:
-        str: The name of the host operating system ('Linux', 'Windows', 'Darwin' for macOS, etc.).
-    """
-    return platform.system()
+    leaves = {}
+    for leaf in leaf_list:
+        # Skip leaves outside the ranges the CPU reports, they only echo other leaves
+        if leaf < 0x40000000 and leaf > max_basic_leaf:
+            continue
+        if 0x40000000 <= leaf < 0x80000000 and leaf > max_hypervisor_leaf:
+            continue
+        if leaf >= 0x80000000 and leaf > max_extended_leaf:
+            continue
 
-def host_os_pretty():
+        max_subleaf = probe_max_subleaf(leaf)
+        for subleaf in range(max_subleaf + 1):
+            eax, ebx, ecx, edx = call_cpuid(leaf, subleaf)
+            leaves[f"{leaf:08X}.{subleaf:02X}"] = [f"{eax:08X}", f"{ebx:08X}", f"{ecx:08X}", f"{edx:08X}"]
+
+    return leaves
+
+def capture_cpuid_snapshot(per_cpu=False):
     """
-    Get a pretty-printed version of the host OS with detailed information.
+    Captures the current CPU into a snapshot dictionary.
+
+    Parameters:
+        per_cpu (bool): Also pin to every CPU this process may run on and store its leaves under "cpus".
 
     Returns:
-        str: A detailed string describing the host OS.
+        dict: The snapshot, "leaves" always holds the leaves of the CPU the capture started on.
     """
-    os_type = get_host_os()
-    
-    if os_type == "Linux":
-        # Read the os-release file to get distribution information
+    global replay_registers
+    snapshot = {
+        "format": 1,
+        "chipinspect": CI_vers,
+        "host": platform.node(),
+        "os": platform.platform(),
+        "captured": int(time.time()),
+        "vendor": get_cpu_vendor(),
+        "leaves": capture_cpuid_leaves(),
+    }
+
+    if per_cpu and replay_cpus:
+        original_registers = replay_registers
+        cpus = {}
         try:
-            with open('/etc/os-release') as f:
-                lines = f.readlines()
-                os_info = {}
-                for line in lines:
-                    key, value = line.strip().split('=', 1)
-                    os_info[key] = value.strip('"')
-                pretty_name = os_info.get('PRETTY_NAME', 'Linux')
-                return pretty_name
-        except Exception:
-            return "Linux"
-    
-    elif os_type == "Darwin":
+            for cpu, registers in sorted(replay_cpus.items()):
+                replay_registers = registers
+                cpus[str(cpu)] = capture_cpuid_leaves()
+        finally:
+            replay_registers = original_registers
+        snapshot["cpus"] = cpus
+    elif per_cpu and replay_registers is None and hasattr(os, 'sched_setaffinity'):
+        original_affinity = os.sched_getaffinity(0)
+        cpus = {}
         try:
-            # Use sw_vers to get macOS version details
-            sw_vers_output = subprocess.check_output(["sw_vers"], text=True).strip().split("\n")
-            version_info = {line.split(":")[0].strip(): line.split(":")[1].strip() for line in sw_vers_output}
-            kernel_version = get_darwin_kernel_version()
-            kernel_type = get_darwin_kernel_type()
-            kernel_integrity = get_darwin_kernel_integrity_status()
-            kernel_build_string = get_darwin_build_string()
-            return f"Darwin {version_info.get('ProductVersion', '')} ({version_info.get('BuildVersion', '')})\n{kernel_integrity}\nDarwin Kernel {kernel_version} ({kernel_type}) - {kernel_build_string}"
-        except Exception:
-            return "Darwin"
-    
-    return os_type
-
-def get_darwin_kernel_version():
+            for cpu in sorted(original_affinity):
+                os.sched_setaffinity(0, {cpu})
+                cpus[str(cpu)] = capture_cpuid_leaves()
+        finally:
+            os.sched_setaffinity(0, original_affinity)
+        snapshot["cpus"] = cpus
+
+    return snapshot
+
+def save_cpuid_snapshot(path, snapshot):
+    """Writes a snapshot dictionary to a JSON file."""
+    with open(path, 'w') as f:
+        json.dump(snapshot, f, indent=1)
+
+def load_cpuid_snapshot(path):
+    """Loads a JSON snapshot and returns a dictionary of (leaf, subleaf) to (eax, ebx, ecx, edx)."""
+    with open(path) as f:
+        snapshot = json.load(f)
+    return snapshot_registers(snapshot)
+
+def snapshot_registers(snapshot, shared=None):
     """
-    Get the kernel version and type for Darwin (macOS) systems.
+    Converts the leaves of a snapshot dictionary into (leaf, subleaf) to (eax, ebx, ecx, edx).
 
-    Returns:
-        str: The kernel version and type.
+    Parameters:
+        snapshot (dict): Snapshot, or any dictionary with a "leaves" key.
+        shared (dict): Optional cache reused across calls, so equal keys and register values share one tuple.
     """
+    if shared is None:
+        shared = {}
+    registers = {}
+    for key, values in snapshot["leaves"].items():
+        leaf_key = shared.get(key)
+        if leaf_key is None:
+            leaf, subleaf = key.split('.')
+            leaf_key = shared[key] = (int(leaf, 16), int(subleaf, 16))
+        raw = tuple(values)
+        parsed = shared.get(raw)
+        if parsed is None:
+            parsed = shared[raw] = tuple(int(value, 16) for value in values)
+        registers[leaf_key] = parsed
+    return registers
+
+def snapshot_feature_bit(registers, leaf, subleaf, register, bit):
+    """Returns True when the given register bit is set in a snapshot, missing leaves count as zero."""
+    values = registers.get((leaf, subleaf), (0, 0, 0, 0))
+    value = values[("eax", "ebx", "ecx", "edx").index(register)]
+    return bool(value & (1 << bit))
+
+def parse_topology_spec(spec):
+    """Parses SOCKETSxDIESxCORESxTHREADS (e.g. 8x2x128x2) into a tuple of four positive counts."""
     try:
-        uname_output = subprocess.check_output(["uname", "-r"], text=True).strip()
-        return uname_output
-    except subprocess.CalledProcessError:
-        return "Unknown Kernel Version"
-
-def get_darwin_kernel_type():
+        counts = tuple(int(part) for part in spec.lower().split('x'))
+    except ValueError:
+        counts = ()
+    if len(counts) != 4 or min(counts) < 1:
+        raise ValueError(f"topology must be SOCKETSxDIESxCORESxTHREADS, got {spec!r}")
+    return counts
+
+def topology_bits(count):
+    """Returns the APIC ID bits needed to number count items, as the topology leaves shift widths."""
+    return (count - 1).bit_length()
+
+def synthesize_topology_snapshot(template, sockets, dies, cores, threads):
     """
-    Detect whether the Darwin (macOS) kernel in use is RELEASE or DEVELOPMENT.
+    Builds a snapshot of a machine with the given topology from a single CPU template snapshot.
+
+    Every CPU gets the template leaves with its topology leaves rewritten: the x2APIC ID is packed as
+    socket | die | core | thread with power of two widths, and leaf 1 EBX, leaves 0xB and 0x1F, the leaf 4
+    or 0x8000001D sharing counts and the AMD 0x80000008 and 0x8000001E leaves are derived from it. CPUs are
+    numbered like Linux does, first thread of every core first, then the SMT siblings. Leaves that do not
+    depend on the CPU are shared between all of them.
+
+    Parameters:
+        template (dict): Snapshot whose "leaves" describe one CPU of the part to synthesize.
+        sockets, dies, cores, threads (int): Sockets, dies per socket, cores per die and threads per core.
 
     Returns:
-        str: 'RELEASE' or 'DEVELOPMENT', or 'Unknown Kernel Type' if detection fails.
+        dict: The snapshot, with "synthetic" recording the topology and "cpus" holding every CPU.
     """
-    try:
-        uname_output = subprocess.check_output(["uname", "-v"], text=True).strip()
-        if "RELEASE" in uname_output:
-            return click.style("RELEASE", fg="green")
-        elif "DEVELOPMENT" in uname_output:
-            return click.style("DEVELOPMENT", fg="bright_red")
+    vendor = schema_vendor(template.get("vendor", ""))
+    base = dict(template["leaves"])
+    smt_bits = topology_bits(threads)
+    core_bits = topology_bits(cores)
+    die_bits = topology_bits(dies)
+    package_shift = smt_bits + core_bits + die_bits
+    package_threads = dies * cores * threads
+
+    def word(key, index):
+        return int(base.get(key, ["0"] * 4)[index], 16)
+
+    def hex_words(*values):
+        return [f"{value & 0xFFFFFFFF:08X}" for value in values]
+
+    max_basic_leaf = word("00000000.00", 0)
+    if vendor == "intel" and dies > 1 and max_basic_leaf < 0x1F:
+        # Die levels are only reported by leaf 0x1F
+        max_basic_leaf = 0x1F
+        base["00000000.00"] = hex_words(max_basic_leaf, *(word("00000000.00", index) for index in range(1, 4)))
+
+    # Cache sharing only depends on the level: L1 and L2 per core, L3 per die
+    cache_leaf = "8000001D" if vendor == "amd" else "00000004"
+    for key in [key for key in base if key.startswith(cache_leaf + '.')]:
+        eax = word(key, 0)
+        if eax & 0x1F == 0:
+            continue
+        sharing_bits = smt_bits + core_bits if (eax >> 5) & 0x7 >= 3 else smt_bits
+        eax = (eax & ~(0xFFF << 14)) | (((1 << sharing_bits) - 1) << 14)
+        if vendor == "intel":
+            eax = (eax & 0x03FFFFFF) | (min((1 << (core_bits + die_bits)) - 1, 63) << 26)
+        base[key] = hex_words(eax, word(key, 1), word(key, 2), word(key, 3))
+
+    if vendor == "amd" and "80000008.00" in base:
+        ecx = (word("80000008.00", 2) & ~0xF0FF) | (package_shift << 12) | min(package_threads - 1, 0xFF)
+        base["80000008.00"] = hex_words(word("80000008.00", 0), word("80000008.00", 1), ecx, word("80000008.00", 3))
+
+    # Topology levels as (level type, shift to the next level, logical CPUs in the level), leaf 0xB has no die level
+    legacy_levels = [(1, smt_bits, threads), (2, package_shift, package_threads)]
+    levels = legacy_levels
+    if dies > 1:
+        levels = [(1, smt_bits, threads), (2, smt_bits + core_bits, cores * threads), (5, package_shift, package_threads)]
+    topology_leaves = [(leaf, leaf_levels) for leaf, leaf_levels in (("0000000B", legacy_levels), ("0000001F", levels))
+                       if max_basic_leaf >= int(leaf, 16)]
+    has_ext1e = vendor == "amd" and word("80000000.00", 0) >= 0x8000001E
+
+    for key in [key for key in base if key[:8] in ("0000000B", "0000001F", "8000001E")]:
+        del base[key]
+    leaf1 = [word("00000001.00", index) for index in range(4)]
+    # Intel reports addressable IDs in the package, AMD the logical CPUs in it
+    logical_count = package_threads if vendor == "amd" else 1 << package_shift
+
+    cores_total = sockets * dies * cores
+    cpus = {}
+    for thread in range(threads):
+        for core_index in range(cores_total):
+            socket, rest = divmod(core_index, dies * cores)
+            die, core = divmod(rest, cores)
+            apic_id = (socket << package_shift) | (die << (smt_bits + core_bits)) | (core << smt_bits) | thread
+            leaves = dict(base)
+
+            ebx = (leaf1[1] & 0x0000FFFF) | (min(logical_count, 0xFF) << 16) | ((apic_id & 0xFF) << 24)
+            edx = leaf1[3] | (1 << 28) if package_threads > 1 else leaf1[3] & ~(1 << 28)
+            leaves["00000001.00"] = hex_words(leaf1[0], ebx, leaf1[2], edx)
+
+            for leaf, leaf_levels in topology_leaves:
+                for subleaf, (level_type, shift, count) in enumerate(leaf_levels):
+                    leaves[f"{leaf}.{subleaf:02X}"] = hex_words(shift, count, (level_type << 8) | subleaf, apic_id)
+                subleaf = len(leaf_levels)
+                leaves[f"{leaf}.{subleaf:02X}"] = hex_words(0, 0, subleaf, apic_id)
+
+            if has_ext1e:
+                ebx = ((threads - 1) << 8) | ((die * cores + core) & 0xFF)
+                ecx = ((dies - 1) << 8) | ((socket * dies + die) & 0xFF)
+                leaves["8000001E.00"] = hex_words(apic_id, ebx, ecx, 0)
+
+            cpus[str(thread * cores_total + core_index)] = leaves
+
+    return {
+        "format": 1,
+        "chipinspect": CI_vers,
+        "host": "synthetic",
+        "os": template.get("os", ""),
+        "captured": template.get("captured", 0),
+        "vendor": template.get("vendor", ""),
+        "synthetic": {"sockets": sockets, "dies": dies, "cores": cores, "threads": threads},
+        "leaves": cpus["0"],
+        "cpus": cpus,
+    }
+
+# Snapshot archive layout, all little-endian:
+#   header: magic, version, codec, dictionary size, blob count, run count, string count,
+#           dictionary offset, blob table offset, run table offset, string table offset
+#   blob:   SHA-256 of the canonical snapshot, data offset, compressed size, raw size (sorted by digest)
+#   run:    host string, os string, blob index, snapshot count, first and last capture time (sorted by host, time)
+#   string: length prefixed UTF-8, sorted so host ids follow host name order
+archive_header = struct.Struct("<4sHHIIIIQQQQ")
+archive_blob_entry = struct.Struct("<32sQII")
+archive_run_entry = struct.Struct("<IIIIqq")
+ARCHIVE_MAGIC = b"CIAR"
+ARCHIVE_CODEC_ZLIB = 1
+ARCHIVE_CODEC_ZSTD = 2
+ARCHIVE_DICTIONARY_SIZE = 32768
+
+# Register fields identifying the CPU that ran the capture, as (leaf, register index, mask): its APIC ID
+# and, in AMD leaf 0x8000001E, its CoreId (EBX[7:0]) and NodeId (ECX[7:0]) as well
+apic_id_fields = [
+    (0x00000001, 1, 0xFF000000),
+    (0x0000000B, 3, 0xFFFFFFFF),
+    (0x0000001F, 3, 0xFFFFFFFF),
+    (0x8000001E, 0, 0xFFFFFFFF),
+    (0x8000001E, 1, 0x000000FF),
+    (0x8000001E, 2, 0x000000FF),
+]
+
+zstd_cdef = """
+    size_t ZSTD_compressBound(size_t srcSize);
+    unsigned ZSTD_isError(size_t code);
+    const char *ZSTD_getErrorName(size_t code);
+    void *ZSTD_createCCtx(void);
+    void *ZSTD_createDCtx(void);
+    void *ZSTD_createCDict(const void *dictBuffer, size_t dictSize, int compressionLevel);
+    void *ZSTD_createDDict(const void *dictBuffer, size_t dictSize);
+    size_t ZSTD_freeCCtx(void *cctx);
+    size_t ZSTD_freeDCtx(void *dctx);
+    size_t ZSTD_freeCDict(void *cdict);
+    size_t ZSTD_freeDDict(void *ddict);
+    size_t ZSTD_compress_usingCDict(void *cctx, void *dst, size_t dstCapacity, const void *src, size_t srcSize, const void *cdict);
+    size_t ZSTD_decompress_usingDDict(void *dctx, void *dst, size_t dstCapacity, const void *src, size_t srcSize, const void *ddict);
+    size_t ZDICT_trainFromBuffer(void *dictBuffer, size_t dictBufferCapacity, const void *samplesBuffer,
+                                 const size_t *samplesSizes, unsigned nbSamples);
+    unsigned ZDICT_isError(size_t errorCode);
+"""
+
+zstd_lib = None
+
+def load_zstd():
+    """Loads the system libzstd through cffi, returns None if it is not installed."""
+    global zstd_lib
+    if zstd_lib is None:
+        ffi.cdef(zstd_cdef, override=True)
+        for name in ("zstd", "libzstd.so.1", "libzstd.1.dylib"):
+            try:
+                zstd_lib = ffi.dlopen(name)
+                break
+            except OSError:
+                continue
         else:
-            return "Unknown Kernel Type"
-    except subprocess.CalledProcessError:
-        return "Unknown Kernel Type"
+            zstd_lib = False
+    return zstd_lib or None
 
-def get_darwin_kernel_integrity_status():
+def canonical_snapshot(snapshot):
     """
-    Check the integrity status of the Darwin (macOS) kernel to determine its type.
+    Serializes the hardware part of a snapshot so identical hosts produce identical bytes.
 
-    Returns:
-        str: Integrity status message indicating the type of kernel.
+    Host, OS, capture time and tool version are dropped since the archive stores them per host. The APIC,
+    core and node ID fields of the top-level leaves are zeroed because they name whichever CPU happened to
+    run the capture, per-CPU leaves are kept exactly.
     """
-    try:
-        uname_output = subprocess.check_output(["uname", "-v"], text=True).strip()
+    leaves = {}
+    for key, values in snapshot["leaves"].items():
+        values = [value.upper() for value in values]
+        leaf = int(key.split('.')[0], 16)
+        for apic_leaf, register, mask in apic_id_fields:
+            if leaf == apic_leaf:
+                values[register] = f"{int(values[register], 16) & ~mask & 0xFFFFFFFF:08X}"
+        leaves[key.upper()] = values
+
+    canonical = {"vendor": snapshot.get("vendor", ""), "leaves": leaves}
+    if snapshot.get("cpus"):
+        canonical["cpus"] = {cpu: {key.upper(): [value.upper() for value in values] for key, values in cpu_leaves.items()}
+                             for cpu, cpu_leaves in snapshot["cpus"].items()}
+    return json.dumps(canonical, sort_keys=True, separators=(',', ':')).encode('ascii')
+
+class SnapshotCodec:
+    """Compresses archive blobs with zstd and a trained dictionary, or zlib with a preset dictionary without libzstd."""
+
+    def __init__(self, codec, dictionary):
+        self.codec = codec
+        self.dictionary = dictionary
+        if codec == ARCHIVE_CODEC_ZSTD:
+            self.lib = load_zstd()
+            if self.lib is None:
+                raise ValueError("archive is zstd compressed but libzstd is not installed")
+            # The dictionary buffer must outlive the digested dictionaries, so keep a reference to it
+            self.dictionary_buffer = ffi.from_buffer(dictionary)
+            # Contexts and digested dictionaries are freed along with the codec
+            self.cctx = ffi.gc(self.lib.ZSTD_createCCtx(), self.lib.ZSTD_freeCCtx)
+            self.dctx = ffi.gc(self.lib.ZSTD_createDCtx(), self.lib.ZSTD_freeDCtx)
+            self.cdict = ffi.gc(self.lib.ZSTD_createCDict(self.dictionary_buffer, len(dictionary), 19), self.lib.ZSTD_freeCDict)
+            self.ddict = ffi.gc(self.lib.ZSTD_createDDict(self.dictionary_buffer, len(dictionary)), self.lib.ZSTD_freeDDict)
+
+    @staticmethod
+    def train(samples):
+        """Builds a codec for new blobs, training a zstd dictionary on them when libzstd is available."""
+        # Raw content dictionary: most repeated content last, where both codecs reach it most cheaply
+        raw_dictionary = b"".join(samples)[-ARCHIVE_DICTIONARY_SIZE:]
+        lib = load_zstd()
+        if lib is None:
+            return SnapshotCodec(ARCHIVE_CODEC_ZLIB, raw_dictionary)
+
+        dictionary = ffi_new("char[]", ARCHIVE_DICTIONARY_SIZE)
+        samples_buffer = ffi.from_buffer(b"".join(samples))
+        sizes = ffi_new("size_t[]", [len(sample) for sample in samples])
+        size = lib.ZDICT_trainFromBuffer(dictionary, ARCHIVE_DICTIONARY_SIZE, samples_buffer, sizes, len(samples))
+        # Training needs a few dozen varied samples, smaller batches use the raw content dictionary
+        if lib.ZDICT_isError(size):
+            return SnapshotCodec(ARCHIVE_CODEC_ZSTD, raw_dictionary)
+        return SnapshotCodec(ARCHIVE_CODEC_ZSTD, ffi.buffer(dictionary, size)[:])
+
+    def compress(self, data):
+        if self.codec == ARCHIVE_CODEC_ZLIB:
+            compressor = zlib.compressobj(9, zdict=self.dictionary)
+            return compressor.compress(data) + compressor.flush()
+        capacity = self.lib.ZSTD_compressBound(len(data))
+        output = ffi_new("char[]", capacity)
+        size = self.lib.ZSTD_compress_usingCDict(self.cctx, output, capacity, ffi.from_buffer(data), len(data), self.cdict)
+        if self.lib.ZSTD_isError(size):
+            raise ValueError(ffi.string(self.lib.ZSTD_getErrorName(size)).decode())
+        return ffi.buffer(output, size)[:]
+
+    def decompress(self, data, raw_size):
+        if self.codec == ARCHIVE_CODEC_ZLIB:
+            decompressor = zlib.decompressobj(zdict=self.dictionary)
+            return decompressor.decompress(data) + decompressor.flush()
+        output = ffi_new("char[]", raw_size)
+        size = self.lib.ZSTD_decompress_usingDDict(self.dctx, output, raw_size, ffi.from_buffer(data), len(data), self.ddict)
+        if self.lib.ZSTD_isError(size):
+            raise ValueError(ffi.string(self.lib.ZSTD_getErrorName(size)).decode())
+        return ffi.buffer(output, size)[:]
+
+class SnapshotArchive:
+    """
+    Read access to a snapshot archive.
 
-        if "RELEASE_ARM64" in uname_output or "RELEASE_X86_64" in uname_output:
-            if "root:xnu-" in uname_output:
-                return "Kernel integrity: Official RELEASE kernel."
+    The file is memory mapped and only the string table is unpacked on open, so finding a host's
+    snapshot costs two binary searches and one blob decompression however large the archive is.
+    """
+
+    def __init__(self, path):
+        self.path = path
+        with open(path, "rb") as f:
+            self.data = mmap.mmap(f.fileno(), 0, access=mmap.ACCESS_READ)
+        if len(self.data) < archive_header.size:
+            raise ValueError(f"{path} is not a ChipInspect snapshot archive")
+        (magic, version, codec, dictionary_size, self.blob_count, self.run_count, string_count,
+         dictionary_offset, self.blob_offset, self.run_offset, string_offset) = archive_header.unpack_from(self.data, 0)
+        if magic != ARCHIVE_MAGIC or version != 1:
+            raise ValueError(f"{path} is not a ChipInspect snapshot archive")
+
+        self.strings = []
+        position = string_offset
+        for _ in range(string_count):
+            length, = struct.unpack_from("<I", self.data, position)
+            self.strings.append(self.data[position + 4:position + 4 + length].decode('utf-8'))
+            position += 4 + length
+        self.string_ids = {text: index for index, text in enumerate(self.strings)}
+        self.codec = SnapshotCodec(codec, self.data[dictionary_offset:dictionary_offset + dictionary_size])
+
+    def blob_entry(self, index):
+        return archive_blob_entry.unpack_from(self.data, self.blob_offset + index * archive_blob_entry.size)
+
+    def run_entry(self, index):
+        return archive_run_entry.unpack_from(self.data, self.run_offset + index * archive_run_entry.size)
+
+    def blob(self, index):
+        """Decompresses a canonical snapshot blob."""
+        digest, offset, size, raw_size = self.blob_entry(index)
+        return self.codec.decompress(self.data[offset:offset + size], raw_size)
+
+    def hosts(self):
+        """Returns the names of every archived host."""
+        return sorted({self.strings[self.run_entry(index)[0]] for index in range(self.run_count)})
+
+    def host_runs(self, host):
+        """Returns the run entries of a host, oldest first, found by binary search on the sorted run table."""
+        host_id = self.string_ids.get(host)
+        if host_id is None:
+            return []
+        low, high = 0, self.run_count
+        while low < high:
+            middle = (low + high) // 2
+            if self.run_entry(middle)[0] < host_id:
+                low = middle + 1
             else:
-                return "Kernel integrity: Non-official kernel (custom or modified)."
-        
-        elif "DEVELOPMENT_ARM64" in uname_output or "DEVELOPMENT_X86_64" in uname_output:
-            if "root:xnu-" in uname_output:
-                return "Kernel integrity: AppleInternal DEVELOPMENT kernel."
+                high = middle
+        runs = []
+        while low < self.run_count and self.run_entry(low)[0] == host_id:
+            runs.append(self.run_entry(low))
+            low += 1
+        return runs
+
+    def snapshot(self, host, when=None):
+        """Rebuilds the snapshot a host had at a time (the latest one when omitted), or None if there is none."""
+        match = None
+        for run in self.host_runs(host):
+            if when is None or run[4] <= when:
+                match = run
+        if match is None:
+            return None
+        host_id, os_id, blob_index, count, first, last = match
+        snapshot = json.loads(self.blob(blob_index))
+        return {
+            "format": 1,
+            "chipinspect": CI_vers,
+            "host": host,
+            "os": self.strings[os_id],
+            "captured": last if when is None else min(when, last),
+            "vendor": snapshot["vendor"],
+            "leaves": snapshot["leaves"],
+            **({"cpus": snapshot["cpus"]} if "cpus" in snapshot else {}),
+        }
+
+    def find_blob(self, digest):
+        """Returns the index of a blob by digest, or None, using a binary search on the sorted blob table."""
+        low, high = 0, self.blob_count
+        while low < high:
+            middle = (low + high) // 2
+            entry_digest = self.blob_entry(middle)[0]
+            if entry_digest == digest:
+                return middle
+            if entry_digest < digest:
+                low = middle + 1
             else:
-                return "Kernel integrity: Non-official kernel (custom or modified)."
-        
-        else:
-            return "Kernel integrity: Non-standard kernel version (not RELEASE or DEVELOPMENT)."
+                high = middle
+        return None
 
-    except subprocess.CalledProcessError:
-        return "Kernel integrity: Unknown"
+def write_snapshot_archive(path, codec, blobs, runs):
+    """
+    Writes a snapshot archive atomically.
 
-def get_darwin_build_string():
+    Parameters:
+        codec (SnapshotCodec): Codec whose dictionary is stored with the archive.
+        blobs (dict): Digest to (compressed bytes, raw size).
+        runs (list): (host, os, digest, count, first, last) tuples.
     """
-    Extracts the build string from the uname output for Darwin (macOS) systems.
+    digests = sorted(blobs)
+    blob_ids = {digest: index for index, digest in enumerate(digests)}
+    strings = sorted({run[0] for run in runs} | {run[1] for run in runs})
+    string_ids = {text: index for index, text in enumerate(strings)}
+
+    dictionary_offset = archive_header.size
+    position = dictionary_offset + len(codec.dictionary)
+    blob_table = bytearray()
+    for digest in digests:
+        data, raw_size = blobs[digest]
+        blob_table += archive_blob_entry.pack(digest, position, len(data), raw_size)
+        position += len(data)
+    blob_offset = position
+    run_offset = blob_offset + len(blob_table)
+    run_table = bytearray()
+    for host, os_name, digest, count, first, last in sorted(runs, key=lambda run: (string_ids[run[0]], run[4])):
+        run_table += archive_run_entry.pack(string_ids[host], string_ids[os_name], blob_ids[digest], count, first, last)
+    string_offset = run_offset + len(run_table)
+
+    temporary_path = f"{path}.tmp"
+    with open(temporary_path, "wb") as f:
+        f.write(archive_header.pack(ARCHIVE_MAGIC, 1, codec.codec, len(codec.dictionary), len(digests), len(runs),
+                                    len(strings), dictionary_offset, blob_offset, run_offset, string_offset))
+        f.write(codec.dictionary)
+        for digest in digests:
+            f.write(blobs[digest][0])
+        f.write(blob_table)
+        f.write(run_table)
+        for text in strings:
+            encoded = text.encode('utf-8')
+            f.write(struct.pack("<I", len(encoded)) + encoded)
+    os.replace(temporary_path, path)
+
+def add_snapshots_to_archive(path, snapshot_paths):
+    """
+    Adds snapshot files to an archive, creating it if needed.
+
+    Identical canonical snapshots are stored once. Consecutive snapshots of a host that did not change
+    extend the host's last run instead of adding a new one, so hourly captures of a stable fleet only
+    grow the archive when some hardware, microcode or hypervisor configuration changes.
 
     Returns:
-        str: The build string extracted from the uname output.
+        tuple: The number of snapshots added and the number of new blobs stored.
     """
-    try:
-        uname_output = subprocess.check_output(["uname", "-v"], text=True).strip()
-        # Find the position of the first ';' after the date
-        semicolon_index = uname_output.find(';')
-        if semicolon_index != -1:
-            return uname_output[semicolon_index + 1:].strip()  # Skip ';' and trim any leading/trailing whitespace
+    snapshots = []
+    for snapshot_path in snapshot_paths:
+        with open(snapshot_path) as f:
+            snapshot = json.load(f)
+        # Parsing every register set rejects anything the canonicalizer cannot handle
+        try:
+            register_sets = [snapshot_registers(snapshot)] + [snapshot_registers({"leaves": leaves}) for leaves in snapshot.get("cpus", {}).values()]
+        except (AttributeError, KeyError, TypeError, ValueError):
+            raise ValueError(f"{snapshot_path} is not a ChipInspect snapshot") from None
+        if any(len(values) != 4 for registers in register_sets for values in registers.values()):
+            raise ValueError(f"{snapshot_path} has a leaf without exactly four registers")
+        captured = int(snapshot.get("captured") or os.path.getmtime(snapshot_path))
+        canonical = canonical_snapshot(snapshot)
+        snapshots.append((captured, snapshot.get("host", ""), snapshot.get("os", ""), hashlib.sha256(canonical).digest(), canonical))
+    snapshots.sort(key=lambda entry: entry[:2])
+
+    blobs = {}
+    runs = []
+    codec = None
+    if os.path.exists(path):
+        archive = SnapshotArchive(path)
+        codec = archive.codec
+        for index in range(archive.blob_count):
+            digest, offset, size, raw_size = archive.blob_entry(index)
+            blobs[digest] = (archive.data[offset:offset + size], raw_size)
+        for index in range(archive.run_count):
+            host_id, os_id, blob_index, count, first, last = archive.run_entry(index)
+            runs.append([archive.strings[host_id], archive.strings[os_id], archive.blob_entry(blob_index)[0], count, first, last])
+
+    if codec is None:
+        # The dictionary is trained once, on the distinct snapshots the archive starts with
+        samples = list({digest: canonical for *_, digest, canonical in snapshots}.values())
+        codec = SnapshotCodec.train(samples)
+
+    last_runs = {}
+    for run in runs:
+        if run[0] not in last_runs or run[5] >= last_runs[run[0]][5]:
+            last_runs[run[0]] = run
+
+    new_blobs = 0
+    for captured, host, os_name, digest, canonical in snapshots:
+        if digest not in blobs:
+            blobs[digest] = (codec.compress(canonical), len(canonical))
+            new_blobs += 1
+        last = last_runs.get(host)
+        if last is not None and last[1] == os_name and last[2] == digest and captured >= last[5]:
+            last[3] += 1
+            last[5] = captured
         else:
-            return uname_output  # Return the whole string if ';' is not found
-
-    except subprocess.CalledProcessError:
-        return "Error: Unable to retrieve build string"
+            last_runs[host] = [host, os_name, digest, 1, captured, captured]
+            runs.append(last_runs[host])
+
+    write_snapshot_archive(path, codec, blobs, runs)
+    return len(snapshots), new_blobs
+
+def print_archive_summary(path):
+    """Prints the hosts, runs and compression ratio of an archive."""
+    archive = SnapshotArchive(path)
+    snapshots = 0
+    raw_bytes = 0
+    for index in range(archive.run_count):
+        snapshots += archive.run_entry(index)[3]
+    for index in range(archive.blob_count):
+        raw_bytes += archive.blob_entry(index)[3]
+    codec = "zstd" if archive.codec.codec == ARCHIVE_CODEC_ZSTD else "zlib"
+    archive_bytes = os.path.getsize(path)
+
+    click.echo(f"Archive: {path}")
+    click.echo(f"Hosts: {len(archive.hosts())}, snapshots: {snapshots}, runs: {archive.run_count}, unique snapshots: {archive.blob_count}")
+    click.echo(f"Codec: {codec} with a {len(archive.codec.dictionary)} byte dictionary")
+    click.echo(f"Size: {archive_bytes} bytes for {raw_bytes} bytes of unique canonical snapshots"
+               + (f" ({raw_bytes / archive_bytes:.1f}x)" if archive_bytes else ""))
+
+# Population count of a host bitmap, int.bit_count needs Python 3.10
+popcount = int.bit_count if hasattr(int, "bit_count") else (lambda value: bin(value).count("1"))
+
+def snapshot_profile(snapshot):
+    """
+    Extracts the placement attributes of a snapshot.
 
+    Returns:
+        dict: vendor, set feature flag mnemonics, logical CPU count, SMT, largest L2/L3 in KB and core types.
+    """
+    vendor = schema_vendor(snapshot.get("vendor", ""))
+    registers = snapshot_registers(snapshot)
+
+    flags = set()
+    for (leaf, subleaf), values in registers.items():
+        for register, handle in feature_database.registers(vendor, leaf, subleaf).items():
+            value = values[("eax", "ebx", "ecx", "edx").index(register)]
+            for lsb, width, mnemonic, name in feature_database.fields(handle):
+                if width == 1 and value & (1 << lsb):
+                    flags.add(mnemonic)
+
+    # Deterministic cache parameters: size = ways * partitions * line size * sets, each stored minus 1
+    cache_kb = {}
+    cache_leaf = 0x8000001D if vendor == "amd" else 0x00000004
+    for (leaf, subleaf), (eax, ebx, ecx, edx) in registers.items():
+        if leaf == cache_leaf and eax & 0x1F in (1, 3):
+            level = (eax >> 5) & 0x7
+            size = ((ebx >> 22) + 1) * (((ebx >> 12) & 0x3FF) + 1) * ((ebx & 0xFFF) + 1) * (ecx + 1)
+            cache_kb[level] = max(cache_kb.get(level, 0), size // 1024)
+
+    # Extended topology: level type 1 is SMT, level type 2 is core and counts every logical CPU in the package
+    smt_threads = 1
+    logical_cpus = (registers.get((0x00000001, 0), (0, 0, 0, 0))[1] >> 16) & 0xFF
+    for (leaf, subleaf), (eax, ebx, ecx, edx) in registers.items():
+        if leaf == 0x0000000B:
+            level_type = (ecx >> 8) & 0xFF
+            if level_type == 1:
+                smt_threads = ebx & 0xFFFF
+            elif level_type == 2:
+                logical_cpus = ebx & 0xFFFF
+    if snapshot.get("cpus"):
+        logical_cpus = len(snapshot["cpus"])
+
+    # Hybrid parts report a core type per CPU in leaf 0x1A, every other part is treated as big cores
+    core_types = set()
+    for cpu_leaves in (snapshot.get("cpus") or {"0": snapshot["leaves"]}).values():
+        core_type = int(cpu_leaves.get("0000001A.00", ["0"])[0], 16) >> 24
+        core_types.add({0x20: "atom", 0x40: "core"}.get(core_type, "core"))
+
+    return {
+        "vendor": vendor,
+        "flags": frozenset(flags),
+        "logical_cpus": logical_cpus,
+        "smt": smt_threads > 1,
+        "l2_kb": cache_kb.get(2, 0),
+        "l3_kb": cache_kb.get(3, 0),
+        "core_types": frozenset(core_types),
+    }
+
+class FleetIndex:
+    """
+    Feature index of a fleet, one bitmap per feature with bit N standing for host N.
 
-def get_system_architecture():
-    return platform.machine()
+    Hosts with identical canonical snapshots share one profile, so attributes are extracted once per
+    distinct machine type and every bitmap is an OR over profile bitmaps rather than over hosts.
+    """
 
-def get_current_user():
+    def __init__(self):
+        self.hosts = []
+        self.profiles = {}
+        self.profile_hosts = {}
+        self.bitmap_cache = {}
+        self.all_hosts = 0
+
+    def add_host(self, host, profile_key, snapshot_loader):
+        """Adds a host, calling snapshot_loader only the first time its profile key is seen."""
+        if profile_key not in self.profiles:
+            self.profiles[profile_key] = snapshot_profile(snapshot_loader())
+            self.profile_hosts[profile_key] = []
+        self.profile_hosts[profile_key].append(len(self.hosts))
+        self.hosts.append(host)
+
+    def finish(self):
+        """Packs the host lists of every profile into bitmaps."""
+        self.profile_bitmaps = {}
+        for key, host_indexes in self.profile_hosts.items():
+            bits = bytearray((len(self.hosts) + 7) // 8)
+            for index in host_indexes:
+                bits[index >> 3] |= 1 << (index & 7)
+            self.profile_bitmaps[key] = int.from_bytes(bits, 'little')
+        self.all_hosts = (1 << len(self.hosts)) - 1
+        self.bitmap_cache.clear()
+
+    def hosts_where(self, cache_key, predicate):
+        """Returns the bitmap of hosts whose profile satisfies a predicate, cached by key."""
+        bitmap = self.bitmap_cache.get(cache_key)
+        if bitmap is None:
+            bitmap = 0
+            for key, profile in self.profiles.items():
+                if predicate(profile):
+                    bitmap |= self.profile_bitmaps[key]
+            self.bitmap_cache[cache_key] = bitmap
+        return bitmap
+
+    def feature(self, mnemonic):
+        return self.hosts_where(("flag", mnemonic), lambda profile: mnemonic in profile["flags"])
+
+    def host_names(self, bitmap, limit):
+        """Returns the names of up to limit hosts in a bitmap, lowest host index first."""
+        names = []
+        while bitmap and len(names) < limit:
+            lowest = bitmap & -bitmap
+            names.append(self.hosts[lowest.bit_length() - 1])
+            bitmap ^= lowest
+        return names
+
+def build_fleet_index(path):
+    """Builds a fleet index from the latest snapshot of every host in an archive or a directory of snapshots."""
+    index = FleetIndex()
+    if os.path.isdir(path):
+        latest = {}
+        for name in sorted(os.listdir(path)):
+            if not name.endswith('.json'):
+                continue
+            with open(os.path.join(path, name)) as f:
+                snapshot = json.load(f)
+            host = snapshot.get("host") or name[:-5]
+            captured = snapshot.get("captured", 0)
+            if host not in latest or captured >= latest[host][0]:
+                latest[host] = (captured, snapshot)
+        for host, (captured, snapshot) in sorted(latest.items()):
+            canonical = canonical_snapshot(snapshot)
+            index.add_host(host, hashlib.sha256(canonical).digest(), lambda: snapshot)
+    else:
+        archive = SnapshotArchive(path)
+        latest = {}
+        for run_index in range(archive.run_count):
+            host_id, os_id, blob_index, count, first, last = archive.run_entry(run_index)
+            latest[host_id] = blob_index
+        for host_id, blob_index in sorted(latest.items()):
+            index.add_host(archive.strings[host_id], blob_index, lambda: json.loads(archive.blob(blob_index)))
+    index.finish()
+    return index
+
+def known_feature_mnemonics():
+    """Returns every single bit feature mnemonic the feature database defines for any vendor."""
+    mnemonics = set()
+    for vendor in featuredb.VENDORS:
+        for leaf, subleaf, registers in feature_database.leaves(vendor):
+            for handle in registers.values():
+                mnemonics.update(mnemonic for lsb, width, mnemonic, name in feature_database.fields(handle) if width == 1)
+    return mnemonics
+
+def place_workload(index, workload, known_mnemonics, top):
     """
-    Get the username of the currently active user running the Python script.
+    Computes the feasible hosts of one workload and ranks them by its preferences.
 
-    This function uses the getpass module to retrieve the login name of the user.
-    It checks the environment variables LOGNAME, USER, LNAME, and USERNAME in order,
-    and returns the value of the first non-empty string.
+    Hard constraints are ANDed into the feasible bitmap in manifest order, so the first one that empties
+    it is reported as the blocker. Preferences are applied in priority order, each one narrowing the
+    candidate set only if some candidate satisfies it.
+    """
+    name = workload.get("name", "")
+    for mnemonic in list(workload.get("require", [])) + list(workload.get("prefer", [])):
+        if mnemonic not in known_mnemonics:
+            return {"workload": name, "error": f"unknown feature '{mnemonic}'"}
+
+    constraints = []
+    if "vendor" in workload:
+        vendor = workload["vendor"].lower()
+        constraints.append((f"vendor={vendor}", index.hosts_where(("vendor", vendor), lambda profile: profile["vendor"] == vendor)))
+    for mnemonic in workload.get("require", []):
+        constraints.append((mnemonic, index.feature(mnemonic)))
+    if "core_type" in workload:
+        core_type = workload["core_type"]
+        constraints.append((f"core_type={core_type}", index.hosts_where(("core_type", core_type), lambda profile: core_type in profile["core_types"])))
+    if "smt" in workload:
+        smt = bool(workload["smt"])
+        constraints.append((f"smt={str(smt).lower()}", index.hosts_where(("smt", smt), lambda profile: profile["smt"] == smt)))
+    for attribute in ("logical_cpus", "l2_kb", "l3_kb"):
+        minimum = workload.get(f"min_{attribute}")
+        if minimum is not None:
+            constraints.append((f"min_{attribute}={minimum}", index.hosts_where((attribute, minimum), lambda profile: profile[attribute] >= minimum)))
+
+    feasible = index.all_hosts
+    blocked_by = None
+    for label, bitmap in constraints:
+        feasible &= bitmap
+        if not feasible:
+            blocked_by = label
+            break
 
-    Returns:
-        str: The username of the currently active user.
+    candidates = feasible
+    preferred_met = []
+    for mnemonic in workload.get("prefer", []):
+        narrowed = candidates & index.feature(mnemonic)
+        if narrowed:
+            candidates = narrowed
+            preferred_met.append(mnemonic)
+
+    result = {"workload": name, "feasible": popcount(feasible)}
+    if blocked_by:
+        result["blocked_by"] = blocked_by
+    result["preferred_met"] = preferred_met
+    result["ranked_hosts"] = popcount(candidates) if feasible else 0
+    result["placement"] = index.host_names(candidates, top) if feasible else []
+    return result
+
+def solve_workload_placement(fleet_path, manifest_paths, output_stream, top=5):
     """
-    username = getpass.getuser()
-    return username
+    Places every workload of the manifests on the fleet and writes one JSON result per workload.
 
-def get_current_directory():
-    """Gets the current working directory and returns it"""
-    return os.getcwd()
+    A manifest is a JSON list of workloads, or an object with a "workloads" list. Each workload has a
+    name and optional require/prefer feature mnemonic lists, vendor, core_type, smt, min_logical_cpus,
+    min_l2_kb and min_l3_kb.
 
-def get_last_directory_name(path):
-    """
-    Get the last directory name from a given path.
-    
-    Parameters:
-        path (str): The path from which to extract the last directory name.
-    
     Returns:
-        str: The last directory name in the path.
+        tuple: The number of hosts, the number of workloads and the number of infeasible workloads.
     """
-    return os.path.basename(os.path.normpath(path))
+    index = build_fleet_index(fleet_path)
+    known_mnemonics = known_feature_mnemonics()
+
+    workloads = []
+    for manifest_path in manifest_paths:
+        with open(manifest_path) as f:
+            manifest = json.load(f)
+        workloads.extend(manifest["workloads"] if isinstance(manifest, dict) else manifest)
+
+    # Identical requirement sets are common across services, so results are cached by requirements
+    result_cache = {}
+    infeasible = 0
+    buffer = []
+    for workload in workloads:
+        requirements = json.dumps({key: value for key, value in workload.items() if key != "name"}, sort_keys=True)
+        result = result_cache.get(requirements)
+        if result is None:
+            result = result_cache[requirements] = place_workload(index, workload, known_mnemonics, top)
+        result = dict(result, workload=workload.get("name", ""))
+        if not result.get("feasible"):
+            infeasible += 1
+        buffer.append(json.dumps(result))
+        if len(buffer) >= 4096:
+            buffer.append('')
+            output_stream.write('\n'.join(buffer))
+            buffer.clear()
+    if buffer:
+        buffer.append('')
+        output_stream.write('\n'.join(buffer))
+    output_stream.flush()
+
+    return len(index.hosts), len(workloads), infeasible
+
+timer_probe_cdef = """
+    int timer_latency_probe(int ncpus, const int *cpus, int loops, int interval_us, int use_fifo, int buckets,
+                            uint64_t *histograms, int64_t *min_ns, int64_t *max_ns, double *avg_ns, int *fifo_granted);
+"""
+
+timer_probe_c_code = """
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __linux__
+#include <errno.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+struct probe_thread {
+    pthread_t thread;
+    int cpu, loops, interval_us, use_fifo, buckets;
+    uint64_t *histogram;
+    int64_t min_ns, max_ns;
+    double avg_ns;
+    int fifo_granted, status;
+};
+
+static int64_t timespec_ns(const struct timespec *ts) {
+    return (int64_t)ts->tv_sec * 1000000000LL + ts->tv_nsec;
+}
 
-def colored_binary_value(binary_string, bit_index):
-    """Returns a colored version of the binary string with specific bit highlighted."""
-    colored_binary = ""
-    for i, bit in enumerate(binary_string):
-        if i == bit_index:
-            # Highlight specific bit in red if it's '0', green if it's '1'
-            if bit == '0':
-                colored_binary += click.style(bit, fg='red')
-            else:
-                colored_binary += click.style(bit, fg='green', bold=True)
-        else:
-            # All other bits are white
-            colored_binary += click.style(bit, fg='bright_black')
-    return colored_binary
+static void *probe_main(void *arg) {
+    struct probe_thread *t = arg;
+    struct timespec next, now;
+    int64_t sum = 0;
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(t->cpu, &set);
+    if (pthread_setaffinity_np(pthread_self(), sizeof(set), &set) != 0) {
+        t->status = -1;
+        return NULL;
+    }
+
+    /* Real-time priority is best effort, unprivileged runs stay SCHED_OTHER */
+    if (t->use_fifo) {
+        struct sched_param param = { .sched_priority = sched_get_priority_max(SCHED_FIFO) - 1 };
+        t->fifo_granted = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+    }
+
+    t->min_ns = INT64_MAX;
+    t->max_ns = 0;
+    clock_gettime(CLOCK_MONOTONIC, &next);
+
+    for (int i = 0; i < t->loops; i++) {
+        int64_t latency, bucket;
+
+        next.tv_nsec += (long)t->interval_us * 1000L;
+        while (next.tv_nsec >= 1000000000L) {
+            next.tv_nsec -= 1000000000L;
+            next.tv_sec++;
+        }
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &next, NULL) == EINTR)
+            ;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+
+        latency = timespec_ns(&now) - timespec_ns(&next);
+        if (latency < 0)
+            latency = 0;
+
+        sum += latency;
+        if (latency < t->min_ns)
+            t->min_ns = latency;
+        if (latency > t->max_ns)
+            t->max_ns = latency;
+
+        bucket = latency / 1000;
+        if (bucket >= t->buckets)
+            bucket = t->buckets - 1;
+        t->histogram[bucket]++;
+
+        /* Resynchronise after an overrun instead of firing a burst of late wakeups */
+        if (latency > (int64_t)t->interval_us * 1000LL)
+            next = now;
+    }
+
+    t->avg_ns = t->loops ? (double)sum / t->loops : 0.0;
+    t->status = 0;
+    return NULL;
+}
 
-def clear_console_deeply():
-    """Clears the console deeply by using ANSI escape sequences."""
-    # ANSI escape sequence to clear the screen and move cursor to the top left
-    os.system('cls' if os.name == 'nt' else 'clear')
+int timer_latency_probe(int ncpus, const int *cpus, int loops, int interval_us, int use_fifo, int buckets,
+                        uint64_t *histograms, int64_t *min_ns, int64_t *max_ns, double *avg_ns, int *fifo_granted) {
+    struct probe_thread *threads = calloc(ncpus, sizeof(*threads));
+    int status = 0;
+
+    if (!threads)
+        return -1;
+
+    for (int i = 0; i < ncpus; i++) {
+        threads[i].cpu = cpus[i];
+        threads[i].loops = loops;
+        threads[i].interval_us = interval_us;
+        threads[i].use_fifo = use_fifo;
+        threads[i].buckets = buckets;
+        threads[i].histogram = histograms + (size_t)i * buckets;
+        threads[i].status = -1;
+        if (pthread_create(&threads[i].thread, NULL, probe_main, &threads[i]) != 0)
+            threads[i].thread = 0;
+    }
+
+    for (int i = 0; i < ncpus; i++) {
+        if (threads[i].thread)
+            pthread_join(threads[i].thread, NULL);
+        min_ns[i] = threads[i].status == 0 ? threads[i].min_ns : -1;
+        max_ns[i] = threads[i].status == 0 ? threads[i].max_ns : -1;
+        avg_ns[i] = threads[i].avg_ns;
+        fifo_granted[i] = threads[i].fifo_granted;
+        if (threads[i].status != 0)
+            status = -1;
+    }
+
+    free(threads);
+    return status;
+}
 
-@click.command()
-def main():
-    """Main entry point for ChipInspect."""
-    while True:
-        clear_console_deeply()
-        click.echo("Welcome to ChipInspect!")
-        click.echo("Copyright (c) 2024 RoyalGraphX")
-        click.echo(f"Python {get_system_architecture()} Pre-Release {CI_vers} for {host_os_pretty()}\n")
-        click.echo("What would you like to do?")
-        click.echo(" 1. Inspect a Leaf and Subleaf")
-        click.echo(" 2. Inspect a Register or 32 Bit Value")
-        click.echo(" 3. Inspect a Register based Leaf")
-        click.echo(" 4. Inspect a 32 Bit based Leaf")
-        click.echo(" 5. Dump CPU Registers")
-        click.echo(" 6. Dump CPU Leafs in Bits")
-        click.echo(" 7. Dump CPU Register Table")
-        click.echo(" 8. Dump CPU Leafs in ASCII")
-        click.echo(" 9. Dump CPU Bits in VMWare format")
-        click.echo("10. Dump Intel Leaf 1 Information")
-        click.echo("11. Dump Intel Leaf 7 Information")
-        click.echo("12. Dump Intel Leaf 80000001 Information")
-        click.echo("13. Dump AMD Leaf 1 Information")
-        click.echo("14. Dump AMD Leaf 7 Information")
-        click.echo("15. Dump AMD Leaf 80000001 Information")
-        click.echo("16. Exit")
+#else
 
-        choice = click.prompt("Enter your choice", type=int)
+int timer_latency_probe(int ncpus, const int *cpus, int loops, int interval_us, int use_fifo, int buckets,
+                        uint64_t *histograms, int64_t *min_ns, int64_t *max_ns, double *avg_ns, int *fifo_granted) {
+    return -1;
+}
 
-        if choice == 1:
-            inspect_leaf_subleaf()
-        elif choice == 2:
-            inspect_reg_bit_data()
-        elif choice == 3:
-            inspect_register_leaf()
-        elif choice == 4:
-            inspect_bit_leaf()
-        elif choice == 5:
-            dump_cpu_registers()
-        elif choice == 6:
-            dump_cpu_bits()
-        elif choice == 7:
-            dump_cpu_register_table()
-        elif choice == 8:
-            dump_cpu_ascii()
-        elif choice == 9:
-            dumpcpuid_vmware_format()
-        elif choice == 10:
-            inspect_leaf1_intel_support()
-        elif choice == 11:
-            inspect_leaf7_intel_support()
-        elif choice == 12:
-            inspect_leaf80000001_intel_support()
-        elif choice == 13:
-            inspect_leaf1_amd_support()
-        elif choice == 14:
-            inspect_leaf7_amd_support()
-        elif choice == 15:
-            inspect_leaf80000001_amd_support()
-        elif choice == 16:
-            exit_program()
-        else:
-            click.echo("Invalid choice. Please enter a valid option.")
+#endif
+"""
+
+uarch_probe_cdef = """
+    double uarch_add_latency(long iterations);
+    double uarch_add_throughput(long iterations);
+    double uarch_load_throughput(long iterations);
+    double uarch_pause_latency(long iterations);
+    double uarch_pointer_chase(size_t bytes, int page_walk, long loads);
+"""
+
+uarch_probe_c_code = """
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
 
-        # Pause to show the result before clearing the screen again
-        click.pause()
+#if defined(__x86_64__) && defined(__linux__)
+#include <sys/mman.h>
+#include <time.h>
 
-def inspect_leaf_subleaf():
-    click.clear()
+#define REPEAT4(x) x x x x
+#define REPEAT16(x) REPEAT4(REPEAT4(x))
+#define REPEAT64(x) REPEAT16(REPEAT4(x))
 
-    if DEBUG.upper() == "TRUE":
-        click.echo("If you see this message, you're in DEBUG mode...")
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
 
-    compile_and_load_cpuid()
+/*
+ * One dependent ADD per cycle on every x86 core, the other probes are divided by this. Register
+ * operands only, recent cores fold chains of small immediate adds at rename.
+ */
+double uarch_add_latency(long iterations) {
+    uint64_t value = 1;
+    double start = now_ns();
+
+    for (long i = 0; i < iterations; i++)
+        __asm__ volatile(REPEAT64("add %0, %0;") : "+r"(value));
+    return (now_ns() - start) / (iterations * 64.0);
+}
 
-    while True:
-        # Prompt the user for func and subfunc values
-        func_input = click.prompt("Enter the CPUID leaf (func)", default="0x0", type=str)
+/* Eight independent chains keep every integer ALU port busy */
+double uarch_add_throughput(long iterations) {
+    uint64_t a = 0, b = 0, c = 0, d = 0, e = 0, f = 0, g = 0, h = 0, one = 1;
+    double start = now_ns();
 
-        # Remove '0x' prefix if present and ensure it's a valid hex string
-        func_input = func_input.lstrip('0x')
-        if func_input == "":
-            func_input = "0"  # Handle empty input as '0'
+    for (long i = 0; i < iterations; i++)
+        __asm__ volatile(REPEAT16("add %8, %0; add %8, %1; add %8, %2; add %8, %3; add %8, %4; add %8, %5; add %8, %6; add %8, %7;")
+                         : "+r"(a), "+r"(b), "+r"(c), "+r"(d), "+r"(e), "+r"(f), "+r"(g), "+r"(h) : "r"(one));
+    return (now_ns() - start) / (iterations * 128.0);
+}
 
-        try:
-            func = int(func_input, 16)
-            break
-        except ValueError:
-            click.echo(f"Error: '{func_input}' is not a valid hexadecimal integer.")
+/* Independent loads hitting one L1D line measure the load ports */
+double uarch_load_throughput(long iterations) {
+    static uint64_t line[8] __attribute__((aligned(64)));
+    uint64_t a, b, c, d, e, f;
+    double start = now_ns();
 
-    while True:
-        # Prompt the user for subleaf value, accepting both integer and letter inputs
-        subfunc_input = click.prompt("Enter the sub-leaf (subfunc)", default="0", type=str)
+    for (long i = 0; i < iterations; i++)
+        __asm__ volatile(REPEAT16("mov (%6), %0; mov 8(%6), %1; mov 16(%6), %2; mov 24(%6), %3; mov 32(%6), %4; mov 40(%6), %5;")
+                         : "=&r"(a), "=&r"(b), "=&r"(c), "=&r"(d), "=&r"(e), "=&r"(f) : "r"(line) : "memory");
+    return (now_ns() - start) / (iterations * 96.0);
+}
 
-        if subfunc_input.isdigit():
-            subfunc = int(subfunc_input)
-        elif len(subfunc_input) == 1 and subfunc_input.isalpha():
-            subfunc = ord(subfunc_input.upper()) - ord('A') + 10
-        else:
-            click.echo(f"Error: '{subfunc_input}' is not a valid sub-leaf value.")
-            continue
-        
-        click.echo(f"Inspecting CPUID leaf 0x{func:08X}, sub-leaf {subfunc}...\n")
-        break
+double uarch_pause_latency(long iterations) {
+    double start = now_ns();
 
-    eax, ebx, ecx, edx = call_cpuid(func, subfunc)
-    if DEBUG.upper() == "TRUE":
-        click.echo("call_cpuid function returned:")
-        click.echo(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}")
-        click.echo()
+    for (long i = 0; i < iterations; i++)
+        __asm__ volatile(REPEAT16("pause;"));
+    return (now_ns() - start) / (iterations * 16.0);
+}
 
-    # Print registers in the requested format
-    click.echo(f"Leaf {func:X} Registers:")
-    click.echo(f"EAX: 0x{eax:08X}")
-    click.echo(f"EBX: 0x{ebx:08X}")
-    click.echo(f"ECX: 0x{ecx:08X}")
-    click.echo(f"EDX: 0x{edx:08X}\n")
+/*
+ * Chases a random cyclic list through a buffer and returns the time per load. Cache probes put one node
+ * in every line of a transparent huge page backed buffer. Page walk probes put one node in every 4 KB
+ * page, each at a different line offset so the nodes spread over the L1D sets instead of aliasing.
+ */
+double uarch_pointer_chase(size_t bytes, int page_walk, long loads) {
+    size_t stride = page_walk ? 4096 : 64;
+    size_t count = bytes / stride;
+    size_t mapped = (bytes + (2u << 20) - 1) & ~((size_t)(2u << 20) - 1);
+    size_t *order;
+    char *region, *buffer;
+    void **p;
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    double start, elapsed;
+
+    if (count < 2)
+        return -1.0;
+
+    /* Huge pages need a 2 MB aligned range, so map one extra huge page and align inside it */
+    region = mmap(NULL, mapped + (2u << 20), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (region == MAP_FAILED)
+        return -1.0;
+    buffer = (char *)(((uintptr_t)region + (2u << 20) - 1) & ~(uintptr_t)((2u << 20) - 1));
+    madvise(buffer, mapped, page_walk ? MADV_NOHUGEPAGE : MADV_HUGEPAGE);
+
+    order = malloc(count * sizeof(*order));
+    if (!order) {
+        munmap(region, mapped + (2u << 20));
+        return -1.0;
+    }
+
+    for (size_t i = 0; i < count; i++)
+        order[i] = i;
+    for (size_t i = count - 1; i > 0; i--) {
+        size_t j, swap;
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        j = seed % (i + 1);
+        swap = order[i];
+        order[i] = order[j];
+        order[j] = swap;
+    }
+
+#define NODE(index) ((void **)(buffer + order[index] * stride + (page_walk ? (order[index] % 64) * 64 : 0)))
+    for (size_t i = 0; i < count; i++)
+        *NODE(i) = NODE((i + 1) % count);
+    p = NODE(0);
+#undef NODE
+    free(order);
+
+    /* One lap warms the caches and TLBs */
+    for (size_t i = 0; i < count; i++)
+        p = *p;
+
+    start = now_ns();
+    for (long i = 0; i < loads / 16; i++) {
+        REPEAT16(p = *p;)
+    }
+    elapsed = now_ns() - start;
+
+    __asm__ volatile("" : : "r"(p));
+    munmap(region, mapped + (2u << 20));
+    return elapsed / (loads / 16 * 16);
+}
 
-    # Print raw CPUID chart
-    click.echo("Generated Leaf Table:")
-    click.echo("leaf     sub   eax       ebx       ecx       edx")
-    click.echo(f"{func:08X}.{subfunc:02X}    {eax:08X}  {ebx:08X}  {ecx:08X}  {edx:08X}\n")
+#else
 
-    # Capture bit representations as strings
-    bit_eax = print_bits(eax, 32)
-    bit_ebx = print_bits(ebx, 32)
-    bit_ecx = print_bits(ecx, 32)
-    bit_edx = print_bits(edx, 32)
+double uarch_add_latency(long iterations) { return -1.0; }
+double uarch_add_throughput(long iterations) { return -1.0; }
+double uarch_load_throughput(long iterations) { return -1.0; }
+double uarch_pause_latency(long iterations) { return -1.0; }
+double uarch_pointer_chase(size_t bytes, int page_walk, long loads) { return -1.0; }
 
-    # Print bit representations
-    click.echo("Bit representation:")
-    click.echo(f"EAX: {bit_eax}")
-    click.echo(f"EBX: {bit_ebx}")
-    click.echo(f"ECX: {bit_ecx}")
-    click.echo(f"EDX: {bit_edx}")
-    click.echo()
+#endif
+"""
 
-    # Format each register as a 16-byte Cpuid1Data style string
-    # Yes this is a def randomly in the middle of this func
-    # I needed spacing for each value pair lol
-    def occpuid_data_format(reg):
-        # Convert register to 4-byte (32-bit) integer parts in little-endian order
-        byte_str = ' '.join(f"{(reg >> (i * 8)) & 0xFF:02X}" for i in range(4))
-        return byte_str + " " + "00 " * 12
+false_sharing_cdef = """
+    double false_sharing_probe(int cpu_a, int cpu_b, int offset, long iterations);
+"""
 
-    occpuid_data_eax = occpuid_data_format(eax)
-    occpuid_data_ebx = occpuid_data_format(ebx)
-    occpuid_data_ecx = occpuid_data_format(ecx)
-    occpuid_data_edx = occpuid_data_format(edx)
+false_sharing_c_code = """
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+struct sharing_thread {
+    pthread_t thread;
+    int cpu;
+    long iterations;
+    volatile uint64_t *counter;
+    int shared;
+    volatile int *go;
+    volatile int *ready;
+    double elapsed_ns;
+    int status;
+};
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
 
-    # Print Cpuid1Data formatted values
-    click.echo("OpenCore CPUID Data Style Format:")
-    click.echo(f"EAX: {occpuid_data_eax}")
-    click.echo(f"EBX: {occpuid_data_ebx}")
-    click.echo(f"ECX: {occpuid_data_ecx}")
-    click.echo(f"EDX: {occpuid_data_edx}")
-    click.echo()
+static void *sharing_main(void *arg) {
+    struct sharing_thread *t = arg;
+    cpu_set_t set;
+    double start;
+
+    CPU_ZERO(&set);
+    CPU_SET(t->cpu, &set);
+    t->status = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? 0 : -1;
+    __sync_fetch_and_add(t->ready, 1);
+
+    while (!*t->go)
+        ;
+    start = now_ns();
+    if (t->shared) {
+        for (long i = 0; i < t->iterations; i++)
+            __atomic_fetch_add(t->counter, 1, __ATOMIC_RELAXED);
+    } else {
+        for (long i = 0; i < t->iterations; i++)
+            (*t->counter)++;
+    }
+    t->elapsed_ns = now_ns() - start;
+    return NULL;
+}
 
-    # Convert to 4-character strings using binary_to_char
-    char_eax = binary_to_char(eax)
-    char_ebx = binary_to_char(ebx)
-    char_ecx = binary_to_char(ecx)
-    char_edx = binary_to_char(edx)
+/*
+ * Two threads pinned to cpu_a and cpu_b each increment their own counter, offset bytes apart in one
+ * page aligned buffer. At offset 0 they share one counter and increment it atomically, true sharing
+ * for reference. Returns the slower thread's time per increment, or -1 if a thread could not run.
+ */
+double false_sharing_probe(int cpu_a, int cpu_b, int offset, long iterations) {
+    struct sharing_thread threads[2];
+    volatile int go = 0, ready = 0;
+    int started = 0;
+    char *buffer;
+    double slowest = 0.0;
+
+    if (posix_memalign((void **)&buffer, 4096, 8192) != 0)
+        return -1.0;
+    for (int i = 0; i < 8192; i++)
+        buffer[i] = 0;
+
+    for (int i = 0; i < 2; i++) {
+        threads[i].cpu = i ? cpu_b : cpu_a;
+        threads[i].iterations = iterations;
+        threads[i].counter = (volatile uint64_t *)(buffer + (i ? offset : 0));
+        threads[i].shared = offset == 0;
+        threads[i].go = &go;
+        threads[i].ready = &ready;
+        threads[i].status = -1;
+        if (pthread_create(&threads[i].thread, NULL, sharing_main, &threads[i]) == 0)
+            started++;
+        else
+            threads[i].thread = 0;
+    }
+
+    /* Release both threads only once each is pinned and spinning, so their increments overlap */
+    while (ready < started)
+        ;
+    go = 1;
+    for (int i = 0; i < 2; i++) {
+        if (threads[i].thread)
+            pthread_join(threads[i].thread, NULL);
+        if (threads[i].status != 0)
+            slowest = -1.0;
+        else if (slowest >= 0 && threads[i].elapsed_ns > slowest)
+            slowest = threads[i].elapsed_ns;
+    }
+    free(buffer);
+    return slowest < 0 ? -1.0 : slowest / iterations;
+}
 
-    # Print as 4-character strings
-    click.echo("ASCII Representation:")
-    click.echo(f"EAX: {char_eax if char_eax else '<empty>'}")
-    click.echo(f"EBX: {char_ebx if char_ebx else '<empty>'}")
-    click.echo(f"ECX: {char_ecx if char_ecx else '<empty>'}")
-    click.echo(f"EDX: {char_edx if char_edx else '<empty>'}")
-    click.echo()
+#else
 
-    if DEBUG.upper() == "TRUE":
-        # Generate all possible decoded strings from permutations of EAX, EBX, ECX, and EDX character parts
-        click.echo("Possible Decoded Strings:\n")
-        
-        for perm in set(permutations([char_eax, char_ebx, char_ecx, char_edx])):
-            decoded_string = ''.join(perm)
-            click.echo(decoded_string)
-            
-        click.echo()
+double false_sharing_probe(int cpu_a, int cpu_b, int offset, long iterations) {
+    return -1.0;
+}
 
-def inspect_reg_bit_data():
-    click.clear()
+#endif
+"""
 
-    if DEBUG.upper() == "TRUE":
-        click.echo("If you see this message, you're in DEBUG mode...")
+denormal_probe_cdef = """
+    unsigned int denormal_mxcsr_mask(void);
+    int denormal_isa_supported(int isa);
+    double denormal_probe(int isa, int op, float input, float factor, unsigned int mxcsr, long iterations);
+"""
 
-    # compile_and_load_cpuid()
+denormal_probe_c_code = """
+#include <stdint.h>
+#include <string.h>
 
-    while True:
-        input_value = input("Enter a register value or binary bit data: ").strip()
+#if defined(__x86_64__) && defined(__linux__)
+#include <immintrin.h>
+#include <time.h>
 
-        if not input_value:
-            print("No input entered. Please enter a valid value.")
-            continue
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
 
-        # Remove any leading "0x" if present
-        if input_value.startswith("0x") or input_value.startswith("0X"):
-            input_value = input_value[2:]
+/* MXCSR_MASK sits at byte 28 of the FXSAVE area, zero means the default mask without DAZ */
+unsigned int denormal_mxcsr_mask(void) {
+    static unsigned char area[512] __attribute__((aligned(16)));
+    uint32_t mask;
 
-        # Check if it's a register value (hexadecimal) or bit data (binary)
-        if len(input_value) <= 8 and all(char in "0123456789ABCDEFabcdef" for char in input_value):
-            # Assume it's a register value (hexadecimal)
-            # Convert hexadecimal values to acsii
-            register_value = int(input_value, 16)
-            print(f"Integer Value: {register_value}")
-            print(f"Register Value (Hex): 0x{register_value:X}")
-            print(f"ASCII Representation: {hex_to_char(input_value)}")
-            print(f"Binary Representation: {register_value:032b}")
-        elif len(input_value) == 32 and all(char in "01" for char in input_value):
-            # Assume it's bit data (binary)
-            bit_data = int(input_value, 2)
-            print(f"Integer Value: {bit_data}")
-            print(f"Hexadecimal Representation: 0x{bit_data:X}")
-            print(f"ASCII Representation: {binary_to_char(bit_data)}")
-            print(f"Binary Representation: {input_value}")
-        else:
-            print("Invalid input format. Please enter either a hexadecimal register value or binary bit data.")
-            continue
+    memset(area, 0, sizeof(area));
+    __asm__ volatile("fxsave %0" : "=m"(area));
+    memcpy(&mask, area + 28, sizeof(mask));
+    return mask;
+}
 
-        # Validate the user's response for another inspection
-        while True:
-            another_inspection = input("Do you want to perform another inspection? (yes/[no]): ").strip().lower()
-            if another_inspection in ('yes', 'y', ''):
-                break
-            elif another_inspection in ('no', 'n'):
-                return
-            else:
-                print("Invalid response. Please enter response.")
+int denormal_isa_supported(int isa) {
+    __builtin_cpu_init();
+    switch (isa) {
+    case 0:
+    case 1:
+        return __builtin_cpu_supports("sse2");
+    case 2:
+        return __builtin_cpu_supports("avx");
+    case 3:
+        return __builtin_cpu_supports("avx512f");
+    }
+    return 0;
+}
 
-def inspect_register_leaf():
-    click.clear()
+/*
+ * Six independent multiplies or adds per iteration. The empty asm statements hide the operands from the
+ * compiler so nothing is hoisted out of the loop, and keep every result alive.
+ */
+#define DENORMAL_KERNEL(name, isa_target, vector, set1, mul, add, reg)                                       \\
+    __attribute__((target(isa_target))) static double name(int op, float input, float factor, long iterations) { \\
+        vector a0 = set1(input), a1 = a0, a2 = a0, a3 = a0, a4 = a0, a5 = a0;                               \\
+        vector c = set1(factor), r0, r1, r2, r3, r4, r5;                                                      \\
+        double start = now_ns();                                                                              \\
+        for (long i = 0; i < iterations; i++) {                                                               \\
+            __asm__ volatile("" : "+" reg(a0), "+" reg(a1), "+" reg(a2), "+" reg(a3), "+" reg(a4), "+" reg(a5)); \\
+            if (op) {                                                                                         \\
+                r0 = add(a0, c); r1 = add(a1, c); r2 = add(a2, c); r3 = add(a3, c); r4 = add(a4, c); r5 = add(a5, c); \\
+            } else {                                                                                          \\
+                r0 = mul(a0, c); r1 = mul(a1, c); r2 = mul(a2, c); r3 = mul(a3, c); r4 = mul(a4, c); r5 = mul(a5, c); \\
+            }                                                                                                 \\
+            __asm__ volatile("" : : reg(r0), reg(r1), reg(r2), reg(r3), reg(r4), reg(r5));                    \\
+        }                                                                                                     \\
+        return (now_ns() - start) / (iterations * 6.0);                                                       \\
+    }
+
+DENORMAL_KERNEL(denormal_scalar, "sse2", __m128, _mm_set1_ps, _mm_mul_ss, _mm_add_ss, "x")
+DENORMAL_KERNEL(denormal_sse, "sse2", __m128, _mm_set1_ps, _mm_mul_ps, _mm_add_ps, "x")
+DENORMAL_KERNEL(denormal_avx, "avx", __m256, _mm256_set1_ps, _mm256_mul_ps, _mm256_add_ps, "x")
+DENORMAL_KERNEL(denormal_avx512, "avx512f", __m512, _mm512_set1_ps, _mm512_mul_ps, _mm512_add_ps, "v")
+
+/* Runs one kernel with MXCSR set to the given value, returns the time per instruction or -1 */
+double denormal_probe(int isa, int op, float input, float factor, unsigned int mxcsr, long iterations) {
+    unsigned int saved = _mm_getcsr();
+    double result = -1.0;
+
+    if (!denormal_isa_supported(isa))
+        return -1.0;
+
+    _mm_setcsr(mxcsr);
+    switch (isa) {
+    case 0:
+        result = denormal_scalar(op, input, factor, iterations);
+        break;
+    case 1:
+        result = denormal_sse(op, input, factor, iterations);
+        break;
+    case 2:
+        result = denormal_avx(op, input, factor, iterations);
+        break;
+    case 3:
+        result = denormal_avx512(op, input, factor, iterations);
+        break;
+    }
+    _mm_setcsr(saved);
+    return result;
+}
 
-    if DEBUG.upper() == "TRUE":
-        click.echo("If you see this message, you're in DEBUG mode...")
+#else
 
-    eax = input("Enter EAX (hexadecimal register format): ").strip()
-    if not is_valid_hex_input(eax):
-        click.echo(
-            "Invalid input for EAX. Please enter a valid hexadecimal register value."
-        )
-        return
-    if eax.startswith("0x"):
-        eax = eax[2:].upper()
+unsigned int denormal_mxcsr_mask(void) { return 0; }
+int denormal_isa_supported(int isa) { return 0; }
+double denormal_probe(int isa, int op, float input, float factor, unsigned int mxcsr, long iterations) { return -1.0; }
 
-    ebx = input("Enter EBX (hexadecimal register format): ").strip()
-    if not is_valid_hex_input(ebx):
-        click.echo(
-            "Invalid input for EBX. Please enter a valid hexadecimal register value."
-        )
-        return
-    if ebx.startswith("0x"):
-        ebx = ebx[2:].upper()
+#endif
+"""
 
-    ecx = input("Enter ECX (hexadecimal register format): ").strip()
-    if not is_valid_hex_input(ecx):
-        click.echo(
-            "Invalid input for ECX. Please enter a valid hexadecimal register value."
-        )
-        return
-    if ecx.startswith("0x"):
-        ecx = ecx[2:].upper()
+perf_probe_cdef = """
+    int perf_probe_open(uint32_t type, uint64_t config, uint64_t config1, uint64_t config2, uint64_t sample_type,
+                        uint64_t branch_sample_type, int exclude_kernel, int exclude_hv, int precise_ip);
+"""
 
-    edx = input("Enter EDX (hexadecimal register format): ").strip()
-    if not is_valid_hex_input(edx):
-        click.echo(
-            "Invalid input for EDX. Please enter a valid hexadecimal register value."
-        )
-        return
-    if edx.startswith("0x"):
-        edx = edx[2:].upper()
+perf_probe_c_code = """
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <string.h>
+
+#ifdef __linux__
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+/*
+ * Opens a disabled perf event on the calling thread and closes it straight away, returning 0 when the
+ * kernel accepted the attributes or the negative errno it refused them with.
+ */
+int perf_probe_open(uint32_t type, uint64_t config, uint64_t config1, uint64_t config2, uint64_t sample_type,
+                    uint64_t branch_sample_type, int exclude_kernel, int exclude_hv, int precise_ip) {
+    struct perf_event_attr attr;
+    long fd;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = type;
+    attr.config = config;
+    attr.config1 = config1;
+    attr.config2 = config2;
+    attr.sample_type = sample_type;
+    attr.branch_sample_type = branch_sample_type;
+    attr.sample_period = sample_type ? 100003 : 0;
+    attr.disabled = 1;
+    attr.exclude_kernel = exclude_kernel;
+    attr.exclude_hv = exclude_hv;
+    attr.precise_ip = precise_ip;
+
+    fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+    if (fd < 0)
+        return -errno;
+    close((int)fd);
+    return 0;
+}
 
-    # For debugging, print out the formatted inputs
-    if DEBUG.upper() == "TRUE":
-        print(f"\ninspect_register_leaf returned: - EAX: 0x{eax}, EBX: 0x{ebx}, ECX: 0x{ecx}, EDX: 0x{edx}")
+#else
 
-    # Print formatted output
-    click.echo("\nUser Defined Registers:")
-    click.echo(f"EAX: 0x{eax}")
-    click.echo(f"EBX: 0x{ebx}")
-    click.echo(f"ECX: 0x{ecx}")
+int perf_probe_open(uint32_t type, uint64_t config, uint64_t config1, uint64_t config2, uint64_t sample_type,
+                    uint64_t branch_sample_type, int exclude_kernel, int exclude_hv, int precise_ip) {
+    return -38;
+}
+
+#endif
+"""
+
+shootdown_probe_cdef = """
+    int shootdown_probe(int ncpus, const int *cpus, int op, int pages, long iterations, double *ns_per_op);
+"""
+
+shootdown_probe_c_code = """
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <time.h>
+
+struct spinner {
+    pthread_t thread;
+    int cpu;
+    volatile int *stop;
+    volatile int *ready;
+    int status;
+};
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Keeps the mm live on another CPU so every flush of it has to reach that CPU */
+static void *spinner_main(void *arg) {
+    struct spinner *s = arg;
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(s->cpu, &set);
+    s->status = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? 0 : -1;
+    __sync_fetch_and_add(s->ready, 1);
+    while (!*s->stop)
+        __asm__ volatile("" ::: "memory");
+    return NULL;
+}
+
+static void touch(char *region, int pages) {
+    for (int i = 0; i < pages; i++)
+        region[(size_t)i * 4096] = 1;
+}
+
+/*
+ * Times one memory map operation on cpus[0] while a thread spins on each other CPU of the list.
+ * op 0 is munmap of freshly touched pages, 1 is mprotect from read/write to read only, 2 is
+ * madvise(MADV_DONTNEED). Returns 0, or -1 when pinning or mapping failed.
+ */
+int shootdown_probe(int ncpus, const int *cpus, int op, int pages, long iterations, double *ns_per_op) {
+    struct spinner *spinners = calloc(ncpus, sizeof(*spinners));
+    volatile int stop = 0, ready = 0;
+    size_t bytes = (size_t)pages * 4096;
+    double total = 0.0;
+    int started = 0, status = 0;
+    char *region = NULL;
+    cpu_set_t set, original;
+
+    if (!spinners)
+        return -1;
+
+    sched_getaffinity(0, sizeof(original), &original);
+    CPU_ZERO(&set);
+    CPU_SET(cpus[0], &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        free(spinners);
+        return -1;
+    }
+
+    for (int i = 1; i < ncpus; i++) {
+        spinners[i].cpu = cpus[i];
+        spinners[i].stop = &stop;
+        spinners[i].ready = &ready;
+        spinners[i].status = -1;
+        if (pthread_create(&spinners[i].thread, NULL, spinner_main, &spinners[i]) == 0)
+            started++;
+    }
+    while (ready < started)
+        ;
+
+    if (op != 0) {
+        region = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (region == MAP_FAILED)
+            status = -1;
+    }
+
+    for (long i = 0; i < iterations && status == 0; i++) {
+        double start;
+
+        if (op == 0) {
+            region = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (region == MAP_FAILED) {
+                status = -1;
+                break;
+            }
+            touch(region, pages);
+            start = now_ns();
+            munmap(region, bytes);
+            total += now_ns() - start;
+        } else if (op == 1) {
+            touch(region, pages);
+            start = now_ns();
+            mprotect(region, bytes, PROT_READ);
+            total += now_ns() - start;
+            mprotect(region, bytes, PROT_READ | PROT_WRITE);
+        } else {
+            touch(region, pages);
+            start = now_ns();
+            madvise(region, bytes, MADV_DONTNEED);
+            total += now_ns() - start;
+        }
+    }
+    if (op != 0 && region != MAP_FAILED)
+        munmap(region, bytes);
+
+    stop = 1;
+    /* An unpinned spinner stays on the caller's CPU and the sample covers fewer remote CPUs */
+    for (int i = 1; i < ncpus; i++) {
+        if (spinners[i].thread)
+            pthread_join(spinners[i].thread, NULL);
+        if (spinners[i].status != 0)
+            status = -1;
+    }
+    free(spinners);
+    sched_setaffinity(0, sizeof(original), &original);
+
+    *ns_per_op = iterations ? total / iterations : 0.0;
+    return started == ncpus - 1 ? status : -1;
+}
+
+#else
+
+int shootdown_probe(int ncpus, const int *cpus, int op, int pages, long iterations, double *ns_per_op) {
+    return -1;
+}
+
+#endif
+"""
+
+atomic_probe_cdef = """
+    double atomic_probe(int op, int cpu_a, int cpu_b, long iterations);
+    int split_lock_probe(long iterations, double *ns_per_op);
+"""
+
+atomic_probe_c_code = """
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+struct atomic_thread {
+    pthread_t thread;
+    int cpu;
+    int op;
+    long iterations;
+    char *target;
+    volatile int *go;
+    volatile int *ready;
+    double elapsed_ns;
+    int status;
+};
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* Runs iterations successful operations on target, compare and exchange ones retrying until they succeed */
+static void atomic_run(int op, char *target, long iterations) {
+    if (op == 0 || op == 3) {
+        uint64_t *p = (uint64_t *)target;
+        for (long i = 0; i < iterations; i++) {
+            uint64_t v = 1;
+            __asm__ volatile("lock xaddq %0, %1" : "+r"(v), "+m"(*p) :: "memory");
+        }
+    } else if (op == 1) {
+        uint64_t *p = (uint64_t *)target;
+        for (long i = 0; i < iterations; i++) {
+            uint64_t expected = *(volatile uint64_t *)p;
+            unsigned char ok;
+            do {
+                __asm__ volatile("lock cmpxchgq %3, %1; sete %2"
+                                 : "+a"(expected), "+m"(*p), "=q"(ok)
+                                 : "r"(expected + 1) : "memory", "cc");
+            } while (!ok);
+        }
+    } else {
+        uint64_t *p = (uint64_t *)target;
+        for (long i = 0; i < iterations; i++) {
+            uint64_t lo = *(volatile uint64_t *)p, hi = *(volatile uint64_t *)(p + 1);
+            unsigned char ok;
+            do {
+                __asm__ volatile("lock cmpxchg16b %1; sete %2"
+                                 : "+a"(lo), "+m"(*(volatile __int128 *)p), "=q"(ok), "+d"(hi)
+                                 : "b"(lo + 1), "c"(hi) : "memory", "cc");
+            } while (!ok);
+        }
+    }
+}
+
+static void *atomic_main(void *arg) {
+    struct atomic_thread *t = arg;
+    cpu_set_t set;
+    double start;
+
+    CPU_ZERO(&set);
+    CPU_SET(t->cpu, &set);
+    t->status = pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? 0 : -1;
+    __sync_fetch_and_add(t->ready, 1);
+
+    while (!*t->go)
+        ;
+    start = now_ns();
+    atomic_run(t->op, t->target, t->iterations);
+    t->elapsed_ns = now_ns() - start;
+    return NULL;
+}
+
+/*
+ * Times op on one shared line: 0 is LOCK XADD, 1 a LOCK CMPXCHG increment loop, 2 a LOCK CMPXCHG16B
+ * increment loop. One thread runs on cpu_a, and a second one on cpu_b unless it is negative. Returns the
+ * slower thread's time per successful operation, or -1 if a thread could not run.
+ */
+double atomic_probe(int op, int cpu_a, int cpu_b, long iterations) {
+    struct atomic_thread threads[2];
+    int count = cpu_b < 0 ? 1 : 2, started = 0;
+    volatile int go = 0, ready = 0;
+    char *buffer;
+    double slowest = 0.0;
+
+    if (posix_memalign((void **)&buffer, 4096, 4096) != 0)
+        return -1.0;
+    for (int i = 0; i < 4096; i++)
+        buffer[i] = 0;
+
+    for (int i = 0; i < count; i++) {
+        threads[i].cpu = i ? cpu_b : cpu_a;
+        threads[i].op = op;
+        threads[i].iterations = iterations;
+        threads[i].target = buffer;
+        threads[i].go = &go;
+        threads[i].ready = &ready;
+        threads[i].status = -1;
+        if (pthread_create(&threads[i].thread, NULL, atomic_main, &threads[i]) == 0)
+            started++;
+        else
+            threads[i].thread = 0;
+    }
+
+    /* Contended numbers only mean something when every thread is pinned and spinning before the release */
+    while (ready < started)
+        ;
+    go = 1;
+    for (int i = 0; i < count; i++) {
+        if (threads[i].thread)
+            pthread_join(threads[i].thread, NULL);
+        if (threads[i].status != 0)
+            slowest = -1.0;
+        else if (slowest >= 0 && threads[i].elapsed_ns > slowest)
+            slowest = threads[i].elapsed_ns;
+    }
+    free(buffer);
+    return slowest < 0 ? -1.0 : slowest / iterations;
+}
+
+/*
+ * Times LOCK XADD on a quadword straddling two cache lines in a child process, so a kernel enforcing
+ * split-lock detection with SIGBUS only kills the child. Batches double until 50 ms have passed or
+ * iterations operations ran, bounding the run when the kernel throttles every split lock. Returns 0,
+ * the signal that killed the child, or -1 when the child could not run.
+ */
+int split_lock_probe(long iterations, double *ns_per_op) {
+    int fds[2], status;
+    pid_t child;
+    double result = -1.0;
+
+    if (pipe(fds) != 0)
+        return -1;
+    child = fork();
+    if (child < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        return -1;
+    }
+
+    if (child == 0) {
+        char *buffer;
+        double elapsed = 0.0, start;
+        long done = 0, batch = 1;
+
+        close(fds[0]);
+        if (posix_memalign((void **)&buffer, 128, 128) == 0) {
+            for (int i = 0; i < 128; i++)
+                buffer[i] = 0;
+            while (done < iterations && elapsed < 50e6) {
+                if (batch > iterations - done)
+                    batch = iterations - done;
+                start = now_ns();
+                atomic_run(3, buffer + 60, batch);
+                elapsed += now_ns() - start;
+                done += batch;
+                batch *= 2;
+            }
+            result = elapsed / done;
+        }
+        if (write(fds[1], &result, sizeof(result)) != sizeof(result))
+            _exit(1);
+        _exit(0);
+    }
+
+    close(fds[1]);
+    if (read(fds[0], &result, sizeof(result)) != sizeof(result))
+        result = -1.0;
+    close(fds[0]);
+    if (waitpid(child, &status, 0) < 0)
+        return -1;
+    if (WIFSIGNALED(status))
+        return WTERMSIG(status);
+    *ns_per_op = result;
+    return result < 0 ? -1 : 0;
+}
+
+#else
+
+double atomic_probe(int op, int cpu_a, int cpu_b, long iterations) {
+    return -1.0;
+}
+
+int split_lock_probe(long iterations, double *ns_per_op) {
+    return -1;
+}
+
+#endif
+"""
+
+flush_probe_cdef = """
+    double flush_probe(int op, int serialize, long bytes, int rounds);
+    int flush_handoff_probe(int op, int cpu_a, int cpu_b, int lines, int rounds, double *producer_ns, double *consumer_ns);
+"""
+
+flush_probe_c_code = """
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* op 0 is CLFLUSH, 1 CLFLUSHOPT, 2 CLWB, 3 CLDEMOTE and anything else no instruction at all */
+static inline void flush_line(int op, char *line) {
+    switch (op) {
+    case 0: __asm__ volatile("clflush %0" : "+m"(*line)); break;
+    case 1: __asm__ volatile("clflushopt %0" : "+m"(*line)); break;
+    case 2: __asm__ volatile("clwb %0" : "+m"(*line)); break;
+    case 3: __asm__ volatile("cldemote %0" : "+m"(*line)); break;
+    default: break;
+    }
+}
+
+/*
+ * Dirties every line of a bytes sized buffer, which leaves them in the smallest cache level holding it,
+ * then applies op to each line. With serialize set an MFENCE follows every line, giving the latency of
+ * one completed operation, otherwise one SFENCE ends the pass, giving the throughput. Returns the best
+ * time per line over rounds passes, or -1 when the buffer could not be allocated.
+ */
+double flush_probe(int op, int serialize, long bytes, int rounds) {
+    char *buffer;
+    double best = -1.0;
+
+    if (posix_memalign((void **)&buffer, 4096, bytes) != 0)
+        return -1.0;
+
+    for (int round = 0; round < rounds; round++) {
+        double start, elapsed;
+
+        for (long offset = 0; offset < bytes; offset += 64)
+            buffer[offset]++;
+        __asm__ volatile("mfence" ::: "memory");
+
+        start = now_ns();
+        if (serialize) {
+            for (long offset = 0; offset < bytes; offset += 64) {
+                flush_line(op, buffer + offset);
+                __asm__ volatile("mfence" ::: "memory");
+            }
+        } else {
+            for (long offset = 0; offset < bytes; offset += 64)
+                flush_line(op, buffer + offset);
+            __asm__ volatile("sfence" ::: "memory");
+        }
+        elapsed = (now_ns() - start) / (bytes / 64);
+        if (best < 0 || elapsed < best)
+            best = elapsed;
+    }
+    free(buffer);
+    return best;
+}
+
+struct handoff {
+    char *lines;
+    int count;
+    int rounds;
+    int op;
+    int cpu;
+    volatile long published;
+    char pad0[64];
+    volatile long consumed;
+    char pad1[64];
+    double producer_ns;
+    double consumer_ns;
+    int status;
+};
+
+static int pin_self(int cpu) {
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? 0 : -1;
+}
+
+/* Chases the list the producer wrote through the message lines, one dependent load per line */
+static void *consumer_main(void *arg) {
+    struct handoff *h = arg;
+    double total = 0.0;
+
+    h->status = pin_self(h->cpu);
+    for (long round = 1; round <= h->rounds; round++) {
+        uint64_t index = 0;
+        double start;
+
+        while (h->published != round)
+            ;
+        start = now_ns();
+        for (int i = 0; i < h->count; i++)
+            index = *(volatile uint64_t *)(h->lines + index * 64);
+        total += now_ns() - start;
+        h->consumed = round;
+    }
+    h->consumer_ns = total / ((double)h->rounds * h->count);
+    return NULL;
+}
+
+/*
+ * A producer on cpu_a writes lines message lines, each holding the index of the next one in a fixed
+ * random order, applies op to every line and publishes the message to a consumer on cpu_b that chases
+ * through it. Stores the producer's time per line (writes, op and fence) and the consumer's dependent
+ * load time per line, averaged over rounds handoffs. Returns 0, or -1 if a thread could not run.
+ */
+int flush_handoff_probe(int op, int cpu_a, int cpu_b, int lines, int rounds, double *producer_ns, double *consumer_ns) {
+    struct handoff h = {0};
+    pthread_t consumer;
+    uint64_t *order;
+    double total = 0.0;
+    cpu_set_t original;
+    int status;
+
+    if (posix_memalign((void **)&h.lines, 4096, (size_t)lines * 64) != 0)
+        return -1;
+    order = malloc(sizeof(*order) * lines);
+    if (!order) {
+        free(h.lines);
+        return -1;
+    }
+
+    /* Line 0 starts the chase, the others follow in a shuffled order ending back at line 0 */
+    for (int i = 0; i < lines; i++)
+        order[i] = i;
+    srand(1);
+    for (int i = lines - 1; i > 1; i--) {
+        int j = 1 + rand() % i;
+        uint64_t swap = order[i];
+        order[i] = order[j];
+        order[j] = swap;
+    }
+
+    h.count = lines;
+    h.rounds = rounds;
+    h.op = op;
+    h.cpu = cpu_b;
+    h.status = -1;
+    if (pthread_create(&consumer, NULL, consumer_main, &h) != 0) {
+        free(order);
+        free(h.lines);
+        return -1;
+    }
+    sched_getaffinity(0, sizeof(original), &original);
+    status = pin_self(cpu_a);
+
+    for (long round = 1; round <= rounds; round++) {
+        double start = now_ns();
+
+        for (int i = 0; i < lines; i++) {
+            uint64_t *line = (uint64_t *)(h.lines + order[i] * 64);
+            for (int word = 0; word < 8; word++)
+                line[word] = word ? (uint64_t)round : order[(i + 1) % lines];
+            flush_line(op, (char *)line);
+        }
+        __asm__ volatile("sfence" ::: "memory");
+        total += now_ns() - start;
+
+        h.published = round;
+        while (h.consumed != round)
+            ;
+    }
+    pthread_join(consumer, NULL);
+    pthread_setaffinity_np(pthread_self(), sizeof(original), &original);
+
+    *producer_ns = total / ((double)rounds * lines);
+    *consumer_ns = h.consumer_ns;
+    free(order);
+    free(h.lines);
+    return status == 0 && h.status == 0 ? 0 : -1;
+}
+
+#else
+
+double flush_probe(int op, int serialize, long bytes, int rounds) {
+    return -1.0;
+}
+
+int flush_handoff_probe(int op, int cpu_a, int cpu_b, int lines, int rounds, double *producer_ns, double *consumer_ns) {
+    return -1;
+}
+
+#endif
+"""
+
+prefetch_probe_cdef = """
+    int prefetch_setup(long bytes, long accesses);
+    double prefetch_probe(int kernel, int hint, int distance, long accesses);
+    void prefetch_teardown(void);
+"""
+
+prefetch_probe_c_code = """
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <time.h>
+
+#define MAX_DISTANCE 1024
+
+struct node {
+    struct node *next;
+    struct node *jump;
+    uint64_t payload;
+    uint64_t pad[5];
+};
+
+static struct node *nodes;
+static uint32_t *chain;
+static uint32_t *indices;
+static long node_count;
+static long index_count;
+static int jump_distance = -1;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t next_random(uint64_t *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+void prefetch_teardown(void) {
+    free(nodes);
+    free(chain);
+    free(indices);
+    nodes = NULL;
+    chain = NULL;
+    indices = NULL;
+}
+
+/*
+ * Allocates bytes of 64 byte nodes linked in one random cycle, plus accesses random node indices for
+ * the gather kernels. Returns 0, or -1 when the buffers could not be allocated.
+ */
+int prefetch_setup(long bytes, long accesses) {
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+
+    node_count = bytes / sizeof(struct node);
+    index_count = accesses + MAX_DISTANCE;
+    if (posix_memalign((void **)&nodes, 4096, node_count * sizeof(struct node)) != 0)
+        return -1;
+    chain = malloc(node_count * sizeof(*chain));
+    indices = malloc(index_count * sizeof(*indices));
+    if (!chain || !indices) {
+        prefetch_teardown();
+        return -1;
+    }
+
+    for (long i = 0; i < node_count; i++)
+        chain[i] = i;
+    for (long i = node_count - 1; i > 0; i--) {
+        long j = next_random(&state) % (i + 1);
+        uint32_t swap = chain[i];
+        chain[i] = chain[j];
+        chain[j] = swap;
+    }
+    for (long i = 0; i < node_count; i++) {
+        nodes[chain[i]].next = &nodes[chain[(i + 1) % node_count]];
+        nodes[chain[i]].payload = i;
+    }
+    for (long i = 0; i < index_count; i++)
+        indices[i] = next_random(&state) % node_count;
+    jump_distance = -1;
+    return 0;
+}
+
+/* Points every node at the node distance steps further along the cycle, the chase kernel prefetches it */
+static void set_jump_distance(int distance) {
+    if (distance == jump_distance)
+        return;
+    for (long i = 0; i < node_count; i++)
+        nodes[chain[i]].jump = &nodes[chain[(i + distance) % node_count]];
+    jump_distance = distance;
+}
+
+/*
+ * One set of kernels per hint. Streaming reads consecutive nodes, gather reads and update increment
+ * nodes at random indices like a hash probe, and chase follows the linked cycle, prefetching through
+ * the jump pointers. Each returns a sum so the loads are not optimized away.
+ */
+#define PREFETCH_KERNELS(name, instruction) \\
+    static uint64_t stream_##name(long accesses, int distance) { \\
+        uint64_t sum = 0; \\
+        for (long i = 0; i < accesses; i++) { \\
+            long ahead = i + distance; \\
+            if (ahead >= node_count) \\
+                ahead -= node_count; \\
+            __asm__ volatile(instruction :: "m"(nodes[ahead])); \\
+            sum += nodes[i].payload; \\
+        } \\
+        return sum; \\
+    } \\
+    static uint64_t gather_##name(long accesses, int distance) { \\
+        uint64_t sum = 0; \\
+        for (long i = 0; i < accesses; i++) { \\
+            __asm__ volatile(instruction :: "m"(nodes[indices[i + distance]])); \\
+            sum += nodes[indices[i]].payload; \\
+        } \\
+        return sum; \\
+    } \\
+    static uint64_t update_##name(long accesses, int distance) { \\
+        for (long i = 0; i < accesses; i++) { \\
+            __asm__ volatile(instruction :: "m"(nodes[indices[i + distance]])); \\
+            nodes[indices[i]].payload++; \\
+        } \\
+        return 0; \\
+    } \\
+    static uint64_t chase_##name(long accesses, int distance) { \\
+        struct node *p = nodes; \\
+        uint64_t sum = 0; \\
+        (void)distance; /* the jump pointers already sit a tuned distance ahead */ \\
+        for (long i = 0; i < accesses; i++) { \\
+            __asm__ volatile(instruction :: "m"(*p->jump)); \\
+            sum += p->payload; \\
+            p = p->next; \\
+        } \\
+        return sum; \\
+    }
+
+PREFETCH_KERNELS(none, "")
+PREFETCH_KERNELS(t0, "prefetcht0 %0")
+PREFETCH_KERNELS(t1, "prefetcht1 %0")
+PREFETCH_KERNELS(nta, "prefetchnta %0")
+PREFETCH_KERNELS(w, "prefetchw %0")
+
+typedef uint64_t (*prefetch_kernel)(long, int);
+
+static const prefetch_kernel kernels[4][5] = {
+    {stream_none, stream_t0, stream_t1, stream_nta, stream_w},
+    {gather_none, gather_t0, gather_t1, gather_nta, gather_w},
+    {update_none, update_t0, update_t1, update_nta, update_w},
+    {chase_none, chase_t0, chase_t1, chase_nta, chase_w},
+};
+
+static volatile uint64_t sink;
+
+/*
+ * Times accesses iterations of kernel 0 (stream), 1 (gather), 2 (update) or 3 (chase) with hint 0
+ * (none), 1 (PREFETCHT0), 2 (PREFETCHT1), 3 (PREFETCHNTA) or 4 (PREFETCHW) distance iterations ahead.
+ * Returns the time per iteration, or -1 for arguments outside the prepared buffers.
+ */
+double prefetch_probe(int kernel, int hint, int distance, long accesses) {
+    double start;
+
+    if (!nodes || kernel < 0 || kernel > 3 || hint < 0 || hint > 4 || distance < 0 || distance > MAX_DISTANCE)
+        return -1.0;
+    if (accesses > index_count - MAX_DISTANCE || (kernel == 0 && accesses > node_count))
+        return -1.0;
+    if (kernel == 3)
+        set_jump_distance(distance);
+
+    start = now_ns();
+    sink = kernels[kernel][hint](accesses, distance);
+    return (now_ns() - start) / accesses;
+}
+
+#else
+
+int prefetch_setup(long bytes, long accesses) {
+    return -1;
+}
+
+double prefetch_probe(int kernel, int hint, int distance, long accesses) {
+    return -1.0;
+}
+
+void prefetch_teardown(void) {
+}
+
+#endif
+"""
+
+pipeline_probe_cdef = """
+    double pipeline_branch(int random, long iterations);
+    int pipeline_setup(long bytes);
+    void pipeline_teardown(void);
+    double pipeline_window(int filler, int count, long iterations);
+    double pipeline_store_forward(int narrow_store, long iterations);
+    double pipeline_alias(int offset, long iterations);
+"""
+
+pipeline_probe_c_code = """
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <sys/mman.h>
+#include <time.h>
+
+#define REPEAT4(x) x x x x
+#define REPEAT16(x) REPEAT4(REPEAT4(x))
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t next_random(uint64_t *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+/*
+ * One conditional branch per iteration over 64 KB of outcomes, too long a pattern for the predictor
+ * to learn. With random set half the outcomes mispredict, otherwise the branch is always taken.
+ * Returns the time per branch.
+ */
+double pipeline_branch(int random, long iterations) {
+    static uint8_t outcomes[1 << 16];
+    uint64_t state = 0x2545F4914F6CDD1Dull, sum = 0;
+    double start;
+
+    for (int i = 0; i < (1 << 16); i++)
+        outcomes[i] = random ? next_random(&state) & 1 : 1;
+
+    start = now_ns();
+    for (long i = 0; i < iterations; i++)
+        __asm__ volatile("test %1, %1; jz 1f; add $1, %0; 1:" : "+r"(sum) : "r"((uint64_t)outcomes[i & 0xFFFF]) : "cc");
+    return (now_ns() - start) / iterations;
+}
+
+static uint64_t *chase_buffer;
+static size_t chase_bytes;
+static uint64_t chase_positions[2];
+
+void pipeline_teardown(void) {
+    if (chase_buffer)
+        munmap(chase_buffer, chase_bytes);
+    chase_buffer = NULL;
+}
+
+/*
+ * Links the lines of each half of a bytes sized buffer into its own random cycle, giving two
+ * independent chains that miss the caches on every load. Returns 0, or -1 if the mapping failed.
+ */
+int pipeline_setup(long bytes) {
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    size_t half = bytes / 2 / 64;
+    uint32_t *order;
+
+    chase_bytes = bytes;
+    chase_buffer = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (chase_buffer == MAP_FAILED) {
+        chase_buffer = NULL;
+        return -1;
+    }
+    order = malloc(half * sizeof(*order));
+    if (!order) {
+        pipeline_teardown();
+        return -1;
+    }
+
+    for (int chain = 0; chain < 2; chain++) {
+        uint64_t *base = chase_buffer + chain * half * 8;
+        for (size_t i = 0; i < half; i++)
+            order[i] = i;
+        for (size_t i = half - 1; i > 0; i--) {
+            size_t j = next_random(&state) % (i + 1);
+            uint32_t swap = order[i];
+            order[i] = order[j];
+            order[j] = swap;
+        }
+        for (size_t i = 0; i < half; i++)
+            base[order[i] * 8] = (uint64_t)&base[order[(i + 1) % half] * 8];
+    }
+    free(order);
+    chase_positions[0] = (uint64_t)chase_buffer;
+    chase_positions[1] = (uint64_t)(chase_buffer + half * 8);
+    return 0;
+}
+
+/*
+ * Generates and times a loop with two cache missing loads from independent chains, each followed by
+ * count filler instructions (Henry Wong's technique). While a load, the fillers and the other load fit
+ * in the structure the fillers occupy, both misses overlap; past its size every miss is serialized and
+ * the time per iteration doubles. filler 0 is NOP (reorder buffer), 1 a dependent LEA (scheduler),
+ * 2 an L1 hitting load (load buffer) and 3 a store (store buffer). Returns the time per iteration,
+ * or -1 when the code buffer could not be mapped.
+ */
+double pipeline_window(int filler, int count, long iterations) {
+    static const uint8_t fillers[4][4] = {
+        {0x90},                     /* nop */
+        {0x4C, 0x8D, 0x40, 0x01},   /* lea r8, [rax + 1] */
+        {0x4C, 0x8B, 0x47, 0x40},   /* mov r8, [rdi + 64] */
+        {0x4C, 0x89, 0x47, 0x40},   /* mov [rdi + 64], r8 */
+    };
+    static const int filler_bytes[4] = {1, 4, 4, 4};
+    uint64_t state[32] __attribute__((aligned(64))) = {0};
+    size_t size = 64 + (size_t)count * 2 * 4;
+    uint8_t *code, *p, *loop;
+    double start, elapsed;
+
+    if (!chase_buffer || filler < 0 || filler > 3 || count < 0)
+        return -1.0;
+    code = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (code == MAP_FAILED)
+        return -1.0;
+
+    /* void loop(uint64_t *state, long iterations), state[0] and state[1] hold the chain positions */
+    p = code;
+    memcpy(p, "\\x48\\x8B\\x07", 3); p += 3;              /* mov rax, [rdi] */
+    memcpy(p, "\\x48\\x8B\\x4F\\x08", 4); p += 4;         /* mov rcx, [rdi + 8] */
+    loop = p;
+    for (int half = 0; half < 2; half++) {
+        memcpy(p, half ? "\\x48\\x8B\\x09" : "\\x48\\x8B\\x00", 3); p += 3;   /* mov rcx, [rcx] / mov rax, [rax] */
+        for (int i = 0; i < count; i++) {
+            memcpy(p, fillers[filler], filler_bytes[filler]);
+            p += filler_bytes[filler];
+        }
+    }
+    memcpy(p, "\\x48\\xFF\\xCE", 3); p += 3;              /* dec rsi */
+    memcpy(p, "\\x0F\\x85", 2); p += 2;                   /* jnz loop */
+    int32_t displacement = (int32_t)(loop - (p + 4));
+    memcpy(p, &displacement, 4); p += 4;
+    memcpy(p, "\\x48\\x89\\x07", 3); p += 3;              /* mov [rdi], rax */
+    memcpy(p, "\\x48\\x89\\x4F\\x08", 4); p += 4;         /* mov [rdi + 8], rcx */
+    *p = 0xC3;                                          /* ret */
+
+    if (mprotect(code, size, PROT_READ | PROT_EXEC) != 0) {
+        munmap(code, size);
+        return -1.0;
+    }
+
+    /* The chains continue where the previous run stopped, so no run finds its lines still cached */
+    state[0] = chase_positions[0];
+    state[1] = chase_positions[1];
+    start = now_ns();
+    ((void (*)(uint64_t *, long))code)(state, iterations);
+    elapsed = now_ns() - start;
+    chase_positions[0] = state[0];
+    chase_positions[1] = state[1];
+    munmap(code, size);
+    return elapsed / iterations;
+}
+
+/*
+ * A chain of stores each reloaded by the next instruction, the store data being the value just
+ * loaded. Matching 8 byte stores and loads forward from the store buffer, a 4 byte store cannot
+ * forward to the 8 byte load covering it, which then waits for the store to commit. Returns the time
+ * per store and load pair.
+ */
+double pipeline_store_forward(int narrow_store, long iterations) {
+    static uint64_t slot __attribute__((aligned(64)));
+    uint64_t value = 0;
+    double start = now_ns();
+
+    if (narrow_store) {
+        for (long i = 0; i < iterations; i++)
+            __asm__ volatile(REPEAT16("movl %k0, (%1); mov (%1), %0;") : "+r"(value) : "r"(&slot) : "memory");
+    } else {
+        for (long i = 0; i < iterations; i++)
+            __asm__ volatile(REPEAT16("mov %0, (%1); mov (%1), %0;") : "+r"(value) : "r"(&slot) : "memory");
+    }
+    return (now_ns() - start) / (iterations * 16.0);
+}
+
+/*
+ * A dependent chain of a store, then a load from offset bytes past the next 4 KB page, whose value is
+ * added into the next addresses and store data. Loads whose low 12 address bits overlap the store's
+ * are falsely matched to it and wait before reissuing, which lengthens the chain. Returns the time
+ * per iteration.
+ */
+double pipeline_alias(int offset, long iterations) {
+    static uint8_t buffer[3 * 4096] __attribute__((aligned(4096)));
+    uint64_t value = 0, loaded;
+    double start = now_ns();
+
+    for (long i = 0; i < iterations; i++)
+        __asm__ volatile(REPEAT16("mov %0, (%2,%0); mov (%3,%0), %1; add %1, %0;")
+                         : "+r"(value), "=&r"(loaded) : "r"(buffer), "r"(buffer + 4096 + offset) : "memory");
+    return (now_ns() - start) / (iterations * 16.0);
+}
+
+#else
+
+double pipeline_branch(int random, long iterations) {
+    return -1.0;
+}
+
+int pipeline_setup(long bytes) {
+    return -1;
+}
+
+void pipeline_teardown(void) {
+}
+
+double pipeline_window(int filler, int count, long iterations) {
+    return -1.0;
+}
+
+double pipeline_store_forward(int narrow_store, long iterations) {
+    return -1.0;
+}
+
+double pipeline_alias(int offset, long iterations) {
+    return -1.0;
+}
+
+#endif
+"""
+
+smt_probe_cdef = """
+    int smt_setup(long bytes);
+    void smt_teardown(void);
+    double smt_probe(int kernel, int cpu_a, int kernel_b, int cpu_b, long iterations);
+"""
+
+smt_probe_c_code = """
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(__x86_64__) && defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+#define REPEAT4(x) x x x x
+#define REPEAT16(x) REPEAT4(REPEAT4(x))
+
+typedef double v2df __attribute__((vector_size(16)));
+
+static uint64_t *chase_buffers[2];
+static uint64_t *chase_positions[2];
+static uint8_t outcomes[1 << 16];
+static long chase_count;
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint64_t next_random(uint64_t *state) {
+    *state ^= *state << 13;
+    *state ^= *state >> 7;
+    *state ^= *state << 17;
+    return *state;
+}
+
+void smt_teardown(void) {
+    for (int i = 0; i < 2; i++) {
+        free(chase_buffers[i]);
+        chase_buffers[i] = NULL;
+    }
+}
+
+/*
+ * Links one random cycle through the lines of a bytes sized buffer per thread for the memory kernel
+ * and fills the random outcomes of the branch kernel. Returns 0, or -1 if allocation failed.
+ */
+int smt_setup(long bytes) {
+    uint64_t state = 0x9E3779B97F4A7C15ull;
+    uint32_t *order;
+
+    chase_count = bytes / 64;
+    order = malloc(chase_count * sizeof(*order));
+    if (!order)
+        return -1;
+    for (int buffer = 0; buffer < 2; buffer++) {
+        if (posix_memalign((void **)&chase_buffers[buffer], 4096, chase_count * 64) != 0) {
+            free(order);
+            smt_teardown();
+            return -1;
+        }
+        for (long i = 0; i < chase_count; i++)
+            order[i] = i;
+        for (long i = chase_count - 1; i > 0; i--) {
+            long j = next_random(&state) % (i + 1);
+            uint32_t swap = order[i];
+            order[i] = order[j];
+            order[j] = swap;
+        }
+        for (long i = 0; i < chase_count; i++)
+            chase_buffers[buffer][order[i] * 8] = (uint64_t)&chase_buffers[buffer][order[(i + 1) % chase_count] * 8];
+        chase_positions[buffer] = chase_buffers[buffer];
+    }
+    free(order);
+    for (int i = 0; i < (1 << 16); i++)
+        outcomes[i] = next_random(&state) & 1;
+    return 0;
+}
+
+/*
+ * Runs iterations units of a kernel and returns how many ran before stop was set, or iterations when
+ * stop is NULL. 0 is integer (8 ADD chains), 1 FP vector (8 ADDPD/MULPD chains), 2 memory (a chase
+ * missing the caches) and 3 branchy (unpredictable branches). Every unit is 16 repetitions.
+ */
+static long run_kernel(int kernel, int buffer, long iterations, volatile int *stop) {
+    long i;
+
+    if (kernel == 0) {
+        uint64_t a = 0, b = 0, c = 0, d = 0, e = 0, f = 0, g = 0, h = 0, one = 1;
+        for (i = 0; i < iterations && !(stop && *stop); i++)
+            __asm__ volatile(REPEAT16("add %8, %0; add %8, %1; add %8, %2; add %8, %3; add %8, %4; add %8, %5; add %8, %6; add %8, %7;")
+                             : "+r"(a), "+r"(b), "+r"(c), "+r"(d), "+r"(e), "+r"(f), "+r"(g), "+r"(h) : "r"(one));
+    } else if (kernel == 1) {
+        /* Accumulators and multiplier are operands, zero in and zero out, so no denormal ever needs an assist */
+        v2df a = {0}, b = {0}, c = {0}, d = {0}, e = {0}, f = {0}, g = {0}, h = {0}, m = {0};
+        for (i = 0; i < iterations && !(stop && *stop); i++)
+            __asm__ volatile(REPEAT16("addpd %8, %0; mulpd %8, %1; addpd %8, %2; mulpd %8, %3;"
+                                      "addpd %8, %4; mulpd %8, %5; addpd %8, %6; mulpd %8, %7;")
+                             : "+x"(a), "+x"(b), "+x"(c), "+x"(d), "+x"(e), "+x"(f), "+x"(g), "+x"(h) : "x"(m));
+    } else if (kernel == 2) {
+        /* The chase continues where the previous run stopped, so no run finds its lines still cached */
+        uint64_t *p = chase_positions[buffer];
+        for (i = 0; i < iterations && !(stop && *stop); i++)
+            __asm__ volatile(REPEAT16("mov (%0), %0;") : "+r"(p) :: "memory");
+        chase_positions[buffer] = p;
+    } else {
+        uint64_t sum = 0;
+        long index = buffer * 4096;
+        for (i = 0; i < iterations && !(stop && *stop); i++) {
+            for (int j = 0; j < 16; j++, index++)
+                __asm__ volatile("test %1, %1; jz 1f; add $1, %0; 1:" : "+r"(sum) : "r"((uint64_t)outcomes[index & 0xFFFF]) : "cc");
+        }
+    }
+    return i;
+}
+
+struct smt_thread {
+    pthread_t thread;
+    int kernel;
+    int cpu;
+    volatile int *go;
+    volatile int *ready;
+    volatile int *stop;
+    int status;
+};
+
+static int pin_self(int cpu) {
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? 0 : -1;
+}
+
+/* The co-runner keeps its kernel running for the whole measurement of the other thread */
+static void *corunner_main(void *arg) {
+    struct smt_thread *t = arg;
+
+    t->status = pin_self(t->cpu);
+    while (!*t->go)
+        ;
+    *t->ready = 1;
+    while (!*t->stop)
+        run_kernel(t->kernel, 1, 1L << 40, t->stop);
+    return NULL;
+}
+
+/*
+ * Times iterations units of kernel on cpu_a, alone when cpu_b is negative, otherwise while kernel_b
+ * runs without pause on cpu_b. Returns the time per unit, or -1 if a thread could not be pinned.
+ */
+double smt_probe(int kernel, int cpu_a, int kernel_b, int cpu_b, long iterations) {
+    struct smt_thread corunner = {0};
+    volatile int go = 0, ready = 0, stop = 0;
+    double start, elapsed;
+    cpu_set_t original;
+    int status;
+
+    if (kernel == 2 || kernel_b == 2) {
+        if (!chase_buffers[0])
+            return -1.0;
+    }
+    if (cpu_b >= 0) {
+        corunner.kernel = kernel_b;
+        corunner.cpu = cpu_b;
+        corunner.go = &go;
+        corunner.ready = &ready;
+        corunner.stop = &stop;
+        corunner.status = -1;
+        if (pthread_create(&corunner.thread, NULL, corunner_main, &corunner) != 0)
+            return -1.0;
+    }
+
+    sched_getaffinity(0, sizeof(original), &original);
+    status = pin_self(cpu_a);
+    go = 1;
+    /* Timing starts only once the co-runner is pinned and entering its kernel */
+    while (cpu_b >= 0 && !ready)
+        ;
+    run_kernel(kernel, 0, iterations / 8, NULL);
+    start = now_ns();
+    run_kernel(kernel, 0, iterations, NULL);
+    elapsed = now_ns() - start;
+    stop = 1;
+
+    if (cpu_b >= 0) {
+        pthread_join(corunner.thread, NULL);
+        if (corunner.status != 0)
+            status = -1;
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(original), &original);
+    return status == 0 ? elapsed / iterations : -1.0;
+}
+
+#else
+
+int smt_setup(long bytes) {
+    return -1;
+}
+
+void smt_teardown(void) {
+}
+
+double smt_probe(int kernel, int cpu_a, int kernel_b, int cpu_b, long iterations) {
+    return -1.0;
+}
+
+#endif
+"""
+
+idle_wake_cdef = """
+    int idle_wake_probe(int cpu_a, int cpu_b, int samples, int idle_us, double *latencies_ns);
+"""
+
+idle_wake_c_code = """
+#define _GNU_SOURCE
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+struct wake_pair {
+    int cpu;
+    int samples;
+    volatile int word;
+    volatile int acknowledged;
+    volatile double woken_ns;
+    int status;
+};
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int pin_self(int cpu) {
+    cpu_set_t set;
+
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0 ? 0 : -1;
+}
+
+/* Sleeps in FUTEX_WAIT until the word reaches the next sample number, its CPU idling meanwhile */
+static void *waiter_main(void *arg) {
+    struct wake_pair *p = arg;
+
+    p->status = pin_self(p->cpu);
+    for (int sample = 1; sample <= p->samples; sample++) {
+        int seen;
+        while ((seen = p->word) < sample)
+            syscall(SYS_futex, &p->word, FUTEX_WAIT_PRIVATE, seen, NULL, NULL, 0);
+        p->woken_ns = now_ns();
+        p->acknowledged = sample;
+    }
+    return NULL;
+}
+
+/*
+ * Measures how long a thread sleeping in FUTEX_WAIT on cpu_b takes to run after a FUTEX_WAKE from
+ * cpu_a. Before every wake cpu_a sleeps idle_us, which lets cpu_b settle into the deepest idle state
+ * allowed, so each sample includes its exit latency. Stores samples latencies in nanoseconds and
+ * returns 0, or -1 if a thread could not be pinned.
+ */
+int idle_wake_probe(int cpu_a, int cpu_b, int samples, int idle_us, double *latencies_ns) {
+    struct wake_pair pair = {0};
+    struct timespec idle = {idle_us / 1000000, (idle_us % 1000000) * 1000L};
+    pthread_t waiter;
+    cpu_set_t original;
+    int status;
+
+    pair.cpu = cpu_b;
+    pair.samples = samples;
+    pair.status = -1;
+    sched_getaffinity(0, sizeof(original), &original);
+    status = pin_self(cpu_a);
+    if (pthread_create(&waiter, NULL, waiter_main, &pair) != 0) {
+        pthread_setaffinity_np(pthread_self(), sizeof(original), &original);
+        return -1;
+    }
+
+    for (int sample = 1; sample <= samples; sample++) {
+        double woken_at;
+
+        nanosleep(&idle, NULL);
+        woken_at = now_ns();
+        __atomic_store_n(&pair.word, sample, __ATOMIC_SEQ_CST);
+        syscall(SYS_futex, &pair.word, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+        while (pair.acknowledged != sample)
+            sched_yield();
+        latencies_ns[sample - 1] = pair.woken_ns - woken_at;
+    }
+    pthread_join(waiter, NULL);
+    pthread_setaffinity_np(pthread_self(), sizeof(original), &original);
+    return status == 0 && pair.status == 0 ? 0 : -1;
+}
+
+#else
+
+int idle_wake_probe(int cpu_a, int cpu_b, int samples, int idle_us, double *latencies_ns) {
+    return -1;
+}
+
+#endif
+"""
+
+def read_sysfs_value(path, default="Unknown"):
+    """Reads a single value from sysfs or procfs, returns default if it cannot be read."""
+    try:
+        with open(path) as f:
+            return f.read().strip()
+    except OSError:
+        return default
+
+def parse_cpu_list(cpu_list):
+    """Parses a CPU list such as '0-3,8,10-11' into a sorted list of CPU numbers."""
+    cpus = set()
+    for part in cpu_list.split(','):
+        part = part.strip()
+        if not part:
+            continue
+        if '-' in part:
+            start, end = part.split('-', 1)
+            cpus.update(range(int(start), int(end) + 1))
+        else:
+            cpus.add(int(part))
+    return sorted(cpus)
+
+def read_cpu_topology(cpus):
+    """
+    Reads the Linux sysfs topology of the given CPUs.
+
+    Returns:
+        dict: CPU to {"package", "core", "siblings", "llc"}, siblings and llc being the frozensets of CPUs
+        sharing its core and its last level cache. CPUs without sysfs topology count as their own core.
+    """
+    topology = {}
+    for cpu in cpus:
+        base = f"/sys/devices/system/cpu/cpu{cpu}"
+        siblings = read_sysfs_value(f"{base}/topology/thread_siblings_list", str(cpu))
+        llc = None
+        for index in range(4, -1, -1):
+            shared = read_sysfs_value(f"{base}/cache/index{index}/shared_cpu_list", None)
+            if shared is not None:
+                llc = shared
+                break
+        topology[cpu] = {
+            "package": int(read_sysfs_value(f"{base}/topology/physical_package_id", "0")),
+            "core": int(read_sysfs_value(f"{base}/topology/core_id", str(cpu))),
+            "siblings": frozenset(parse_cpu_list(siblings)),
+            "llc": frozenset(parse_cpu_list(llc or siblings)),
+        }
+    return topology
+
+def pick_cpu_pairs(cpus):
+    """
+    Picks one pair of CPUs per topology distance from the CPUs this process may use.
+
+    Returns:
+        dict: "smt" (sibling threads), "core" (other core, same last level cache), "llc" (other last level
+        cache, same package) and "package" (other package) to a (cpu, cpu) pair, for the distances present.
+    """
+    topology = read_cpu_topology(cpus)
+    pairs = {}
+    for first in cpus:
+        for second in cpus:
+            if second <= first:
+                continue
+            a, b = topology[first], topology[second]
+            if a["package"] != b["package"]:
+                distance = "package"
+            elif second in a["siblings"]:
+                distance = "smt"
+            elif second in a["llc"]:
+                distance = "core"
+            else:
+                distance = "llc"
+            pairs.setdefault(distance, (first, second))
+        if len(pairs) == 4:
+            break
+    return pairs
+
+def lookup_leaf_schema(vendor, leaf, subleaf):
+    """Returns the feature database register handles for a leaf and subleaf, or an empty dictionary if none are defined."""
+    return feature_database.registers(vendor, leaf, subleaf)
+
+def compile_bit_schema(handle):
+    """Splits the fields of a register handle into single bit flags and multi-bit fields."""
+    flags = []
+    fields = []
+    for lsb, width, mnemonic, name in feature_database.fields(handle):
+        if width == 1:
+            flags.append((1 << lsb, name))
+        else:
+            fields.append((lsb, (1 << width) - 1, name))
+    return flags, fields
+
+compiled_bit_schemas = {}
+
+def decode_register(handle, value):
+    """Decodes a register value through a feature database register handle into set flag names and field values."""
+    schema = compiled_bit_schemas.get(handle)
+    if schema is None:
+        schema = compiled_bit_schemas[handle] = compile_bit_schema(handle)
+    flags, fields = schema
+    return {
+        "flags": [name for mask, name in flags if value & mask],
+        "fields": {name: (value >> shift) & mask for shift, mask, name in fields},
+    }
+
+def parse_register_value(text):
+    """Parses a hexadecimal (optionally 0x prefixed) or 32 digit binary (optionally 0b prefixed) register value."""
+    text = text.strip()
+    if text[:2] in ("0b", "0B"):
+        value = int(text[2:], 2)
+    elif len(text) == 32 and all(char in "01" for char in text):
+        value = int(text, 2)
+    else:
+        value = int(text, 16)
+    if not 0 <= value <= 0xFFFFFFFF:
+        raise ValueError(f"'{text}' does not fit in 32 bits")
+    return value
+
+def batch_decode_registers(input_stream, output_stream, vendor="intel"):
+    """
+    Decodes register records from a stream and writes one JSON object per record.
+
+    Each input line holds leaf, subleaf, eax, ebx, ecx and edx separated by commas or whitespace.
+    The leaf and subleaf may also be written as one leaf.subleaf token like the raw table output.
+    Blank lines, lines starting with '#' and a header line naming the columns are skipped. All numbers are hexadecimal,
+    registers may also be 32 digit binary. Invalid lines produce an object with an "error" key.
+
+    Returns:
+        tuple: The number of decoded records and the number of invalid lines.
+    """
+    splitter = re.compile(r"[\s,;]+")
+    # Captured logs repeat the same lines over and over, so the JSON for each distinct line is cached
+    line_cache = {}
+    decoded_cache = {}
+    buffer = []
+    records = 0
+    errors = 0
+
+    for line_number, line in enumerate(input_stream, 1):
+        line = line.strip()
+        output = line_cache.get(line)
+        if output is not None:
+            buffer.append(output)
+            records += 1
+            if len(buffer) >= 4096:
+                buffer.append('')
+                output_stream.write('\n'.join(buffer))
+                buffer.clear()
+            continue
+
+        if not line or line[0] == '#':
+            continue
+
+        tokens = splitter.split(line)
+        if '.' in tokens[0]:
+            tokens[0:1] = tokens[0].split('.', 1)
+
+        try:
+            if len(tokens) != 6:
+                raise ValueError(f"expected 6 values, found {len(tokens)}")
+            leaf = int(tokens[0], 16)
+            subleaf = int(tokens[1], 16)
+            registers = tuple(parse_register_value(token) for token in tokens[2:])
+        except ValueError as e:
+            # Header rows are only allowed before the first record and must name the columns,
+            # a leaf such as "A" is a hex value and still has to be reported
+            if records == 0 and tokens[0].lower() == "leaf" and all(
+                    token.lower() in ("subleaf", "eax", "ebx", "ecx", "edx") for token in tokens[1:]):
+                continue
+            buffer.append(json.dumps({"line": line_number, "error": str(e)}))
+            errors += 1
+            continue
+
+        key = (leaf, subleaf, registers)
+        decoded = decoded_cache.get(key)
+        if decoded is None:
+            schema = lookup_leaf_schema(vendor, leaf, subleaf)
+            decoded = decoded_cache[key] = json.dumps({
+                name: decode_register(schema[name], value)
+                for name, value in zip(("eax", "ebx", "ecx", "edx"), registers)
+                if name in schema
+            })
+
+        eax, ebx, ecx, edx = registers
+        output = (f'{{"leaf":"0x{leaf:08X}","subleaf":{subleaf},"eax":"0x{eax:08X}","ebx":"0x{ebx:08X}",'
+                  f'"ecx":"0x{ecx:08X}","edx":"0x{edx:08X}","decoded":{decoded}}}')
+        buffer.append(output)
+        records += 1
+
+        # Bound the caches so unique-heavy inputs do not grow memory without limit
+        if len(line_cache) >= 65536:
+            line_cache.clear()
+            decoded_cache.clear()
+        line_cache[line] = output
+
+        if len(buffer) >= 4096:
+            buffer.append('')
+            output_stream.write('\n'.join(buffer))
+            buffer.clear()
+
+    if buffer:
+        buffer.append('')
+        output_stream.write('\n'.join(buffer))
+    output_stream.flush()
+
+    return records, errors
+
+def get_host_os():
+    """
+    Determine the host operating system.
+
+    Returns:
+        str: The name of the host operating system ('Linux', 'Windows', 'Darwin' for macOS, etc.).
+    """
+    return platform.system()
+
+def host_os_pretty():
+    """
+    Get a pretty-printed version of the host OS with detailed information.
+
+    Returns:
+        str: A detailed string describing the host OS.
+    """
+    os_type = get_host_os()
+    
+    if os_type == "Linux":
+        # Read the os-release file to get distribution information
+        try:
+            with open('/etc/os-release') as f:
+                lines = f.readlines()
+                os_info = {}
+                for line in lines:
+                    key, value = line.strip().split('=', 1)
+                    os_info[key] = value.strip('"')
+                pretty_name = os_info.get('PRETTY_NAME', 'Linux')
+                return pretty_name
+        except Exception:
+            return "Linux"
+    
+    elif os_type == "Darwin":
+        try:
+            # Use sw_vers to get macOS version details
+            sw_vers_output = subprocess.check_output(["sw_vers"], text=True).strip().split("\n")
+            version_info = {line.split(":")[0].strip(): line.split(":")[1].strip() for line in sw_vers_output}
+            kernel_version = get_darwin_kernel_version()
+            kernel_type = get_darwin_kernel_type()
+            kernel_integrity = get_darwin_kernel_integrity_status()
+            kernel_build_string = get_darwin_build_string()
+            return f"Darwin {version_info.get('ProductVersion', '')} ({version_info.get('BuildVersion', '')})\n{kernel_integrity}\nDarwin Kernel {kernel_version} ({kernel_type}) - {kernel_build_string}"
+        except Exception:
+            return "Darwin"
+    
+    return os_type
+
+def get_darwin_kernel_version():
+    """
+    Get the kernel version and type for Darwin (macOS) systems.
+
+    Returns:
+        str: The kernel version and type.
+    """
+    try:
+        uname_output = subprocess.check_output(["uname", "-r"], text=True).strip()
+        return uname_output
+    except subprocess.CalledProcessError:
+        return "Unknown Kernel Version"
+
+def get_darwin_kernel_type():
+    """
+    Detect whether the Darwin (macOS) kernel in use is RELEASE or DEVELOPMENT.
+
+    Returns:
+        str: 'RELEASE' or 'DEVELOPMENT', or 'Unknown Kernel Type' if detection fails.
+    """
+    try:
+        uname_output = subprocess.check_output(["uname", "-v"], text=True).strip()
+        if "RELEASE" in uname_output:
+            return click.style("RELEASE", fg="green")
+        elif "DEVELOPMENT" in uname_output:
+            return click.style("DEVELOPMENT", fg="bright_red")
+        else:
+            return "Unknown Kernel Type"
+    except subprocess.CalledProcessError:
+        return "Unknown Kernel Type"
+
+def get_darwin_kernel_integrity_status():
+    """
+    Check the integrity status of the Darwin (macOS) kernel to determine its type.
+
+    Returns:
+        str: Integrity status message indicating the type of kernel.
+    """
+    try:
+        uname_output = subprocess.check_output(["uname", "-v"], text=True).strip()
+
+        if "RELEASE_ARM64" in uname_output or "RELEASE_X86_64" in uname_output:
+            if "root:xnu-" in uname_output:
+                return "Kernel integrity: Official RELEASE kernel."
+            else:
+                return "Kernel integrity: Non-official kernel (custom or modified)."
+        
+        elif "DEVELOPMENT_ARM64" in uname_output or "DEVELOPMENT_X86_64" in uname_output:
+            if "root:xnu-" in uname_output:
+                return "Kernel integrity: AppleInternal DEVELOPMENT kernel."
+            else:
+                return "Kernel integrity: Non-official kernel (custom or modified)."
+        
+        else:
+            return "Kernel integrity: Non-standard kernel version (not RELEASE or DEVELOPMENT)."
+
+    except subprocess.CalledProcessError:
+        return "Kernel integrity: Unknown"
+
+def get_darwin_build_string():
+    """
+    Extracts the build string from the uname output for Darwin (macOS) systems.
+
+    Returns:
+        str: The build string extracted from the uname output.
+    """
+    try:
+        uname_output = subprocess.check_output(["uname", "-v"], text=True).strip()
+        # Find the position of the first ';' after the date
+        semicolon_index = uname_output.find(';')
+        if semicolon_index != -1:
+            return uname_output[semicolon_index + 1:].strip()  # Skip ';' and trim any leading/trailing whitespace
+        else:
+            return uname_output  # Return the whole string if ';' is not found
+
+    except subprocess.CalledProcessError:
+        return "Error: Unable to retrieve build string"
+
+
+def get_system_architecture():
+    return platform.machine()
+
+def get_current_user():
+    """
+    Get the username of the currently active user running the Python script.
+
+    This function uses the getpass module to retrieve the login name of the user.
+    It checks the environment variables LOGNAME, USER, LNAME, and USERNAME in order,
+    and returns the value of the first non-empty string.
+
+    Returns:
+        str: The username of the currently active user.
+    """
+    username = getpass.getuser()
+    return username
+
+def get_current_directory():
+    """Gets the current working directory and returns it"""
+    return os.getcwd()
+
+def get_last_directory_name(path):
+    """
+    Get the last directory name from a given path.
+    
+    Parameters:
+        path (str): The path from which to extract the last directory name.
+    
+    Returns:
+        str: The last directory name in the path.
+    """
+    return os.path.basename(os.path.normpath(path))
+
+def colored_binary_value(binary_string, bit_index):
+    """Returns a colored version of the binary string with specific bit highlighted."""
+    colored_binary = ""
+    for i, bit in enumerate(binary_string):
+        if i == bit_index:
+            # Highlight specific bit in red if it's '0', green if it's '1'
+            if bit == '0':
+                colored_binary += click.style(bit, fg='red')
+            else:
+                colored_binary += click.style(bit, fg='green', bold=True)
+        else:
+            # All other bits are white
+            colored_binary += click.style(bit, fg='bright_black')
+    return colored_binary
+
+def clear_console_deeply():
+    """Clears the console deeply by using ANSI escape sequences."""
+    # ANSI escape sequence to clear the screen and move cursor to the top left
+    os.system('cls' if os.name == 'nt' else 'clear')
+
+@click.command()
+@click.option('--batch-decode', 'batch_input', type=click.File('r'), default=None,
+              help="Decode leaf, subleaf, eax, ebx, ecx, edx records from a CSV file (or - for stdin) to NDJSON on stdout.")
+@click.option('--vendor', type=click.Choice(['intel', 'amd']), default='intel', show_default=True,
+              help="Vendor whose leaf schemas are used by --batch-decode.")
+@click.option('--profile', 'profile', is_flag=True, default=False,
+              help="Record wall/CPU time per phase, CPUID instructions, FFI allocations and bytes written.")
+@click.option('--profile-trace', 'profile_trace', type=click.Path(dir_okay=False, writable=True), default=None,
+              help="Write the profile as Chrome trace JSON to this file (implies --profile).")
+@click.option('--tui', is_flag=True, default=False,
+              help="Open the full-screen CPUID browser instead of the menu.")
+@click.option('--snapshot', 'snapshot_path', type=click.Path(exists=True, dir_okay=False), default=None,
+              help="Snapshot file for --tui to browse instead of capturing every CPU.")
+@click.option('--archive', 'archive_path', type=click.Path(dir_okay=False), default=None,
+              help="Snapshot archive to summarize, add to with --archive-add or read with --archive-extract.")
+@click.option('--archive-add', 'archive_add', type=click.Path(exists=True), multiple=True,
+              help="Snapshot file, or directory of snapshot files, to add to --archive. May be repeated.")
+@click.option('--archive-extract', 'archive_extract', default=None, metavar='HOST',
+              help="Print the archived snapshot of HOST as JSON.")
+@click.option('--at', 'archive_at', default=None, metavar='TIME',
+              help="Time for --archive-extract as Unix seconds or ISO 8601, defaults to the latest snapshot.")
+@click.option('--place', 'place_manifests', type=click.Path(exists=True, dir_okay=False), multiple=True,
+              help="Workload requirement manifest to place on --fleet, writes one JSON result per workload. May be repeated.")
+@click.option('--fleet', 'fleet_path', type=click.Path(exists=True), default=None,
+              help="Snapshot archive or directory of snapshots that --place solves against.")
+@click.option('--top', type=int, default=5, show_default=True,
+              help="Number of ranked hosts --place lists per workload.")
+@click.option('--replay', 'replay_path', type=click.Path(exists=True, dir_okay=False), default=None,
+              help="Answer every CPUID query from this snapshot instead of the CPU.")
+@click.option('--corpus', 'corpus_dir', type=click.Path(exists=True, file_okay=False), default=None,
+              help="Replay every dump of a reference corpus directory through every renderer and time them.")
+@click.option('--corpus-baseline', 'corpus_baseline', type=click.Path(dir_okay=False), default=None,
+              help="Output hashes for --corpus to compare against, written when the file does not exist.")
+@click.option('--synthesize', 'synthesize_spec', default=None, metavar='SxDxCxT',
+              help="Replay a synthetic SOCKETSxDIESxCORESxTHREADS topology built from --replay or the current CPU.")
+@click.option('--synthesize-output', 'synthesize_output', type=click.Path(dir_okay=False, writable=True), default=None,
+              help="Write the --synthesize snapshot to this file and exit.")
+@click.option('--scale-check', 'scale_check', is_flag=True, default=False,
+              help="Time and measure the per-CPU paths against the replayed or synthesized CPUs and exit.")
+def main(batch_input, vendor, profile, profile_trace, tui, snapshot_path, archive_path, archive_add, archive_extract, archive_at,
+         place_manifests, fleet_path, top, replay_path, corpus_dir, corpus_baseline, synthesize_spec, synthesize_output,
+         scale_check):
+    """Main entry point for ChipInspect."""
+    output = contextlib.nullcontext()
+    if profile or profile_trace:
+        enable_profiling()
+        # Bytes written are counted for this run only, stdout is restored however it ends
+        output = contextlib.redirect_stdout(ProfiledWriter(sys.stdout))
+    with output:
+        run_chipinspect(batch_input, vendor, profile_trace, tui, snapshot_path, archive_path, archive_add, archive_extract,
+                        archive_at, place_manifests, fleet_path, top, replay_path, corpus_dir, corpus_baseline,
+                        synthesize_spec, synthesize_output, scale_check)
+
+def run_chipinspect(batch_input, vendor, profile_trace, tui, snapshot_path, archive_path, archive_add, archive_extract,
+                    archive_at, place_manifests, fleet_path, top, replay_path, corpus_dir, corpus_baseline,
+                    synthesize_spec, synthesize_output, scale_check):
+    """Runs the mode selected on the command line, or the interactive menu."""
+    def report_profile():
+        if profile_enabled:
+            print_profile_summary()
+            if profile_trace:
+                write_profile_trace(profile_trace)
+                click.echo(f"Profile trace written to {profile_trace}", err=True)
+
+    if batch_input is not None:
+        start = time.perf_counter()
+        records, errors = batch_decode_registers(batch_input, sys.stdout, vendor)
+        elapsed = time.perf_counter() - start
+        rate = records / elapsed if elapsed > 0 else 0
+        click.echo(f"Decoded {records} records ({errors} invalid) in {elapsed:.2f}s, {rate:,.0f} records/s", err=True)
+        report_profile()
+        return
+
+    if corpus_dir:
+        passed = run_corpus_suite(corpus_dir, corpus_baseline)
+        report_profile()
+        sys.exit(0 if passed else 1)
+
+    if replay_path:
+        with open(replay_path) as f:
+            start_replay(json.load(f))
+
+    if synthesize_spec:
+        try:
+            topology = parse_topology_spec(synthesize_spec)
+        except ValueError as e:
+            click.echo(f"Error: {e}", err=True)
+            sys.exit(1)
+        if replay_path:
+            with open(replay_path) as f:
+                template = json.load(f)
+        else:
+            compile_and_load_cpuid()
+            template = capture_cpuid_snapshot()
+        synthetic = synthesize_topology_snapshot(template, *topology)
+        if synthesize_output:
+            save_cpuid_snapshot(synthesize_output, synthetic)
+            click.echo(f"Synthetic snapshot of {len(synthetic['cpus'])} CPUs written to {synthesize_output}", err=True)
+            return
+        start_replay(synthetic)
+
+    if scale_check:
+        if synthesize_spec:
+            snapshot = synthetic
+        else:
+            compile_and_load_cpuid()
+            snapshot = capture_cpuid_snapshot(per_cpu=True)
+        passed = run_scale_check(snapshot)
+        report_profile()
+        sys.exit(0 if passed else 1)
+
+    if place_manifests:
+        if not fleet_path:
+            click.echo("Error: --place needs --fleet", err=True)
+            sys.exit(1)
+        start = time.perf_counter()
+        hosts, workloads, infeasible = solve_workload_placement(fleet_path, place_manifests, sys.stdout, top)
+        click.echo(f"Placed {workloads} workloads on {hosts} hosts ({infeasible} infeasible) in {time.perf_counter() - start:.2f}s", err=True)
+        report_profile()
+        return
+
+    if archive_path:
+        when = None
+        if archive_at:
+            try:
+                when = int(archive_at) if archive_at.isdigit() else int(datetime.datetime.fromisoformat(archive_at).timestamp())
+            except ValueError:
+                click.echo(f"Error: --at expects Unix seconds or an ISO 8601 time, got '{archive_at}'", err=True)
+                sys.exit(1)
+        try:
+            if archive_add:
+                paths = []
+                for path in archive_add:
+                    if os.path.isdir(path):
+                        paths.extend(os.path.join(path, name) for name in sorted(os.listdir(path)) if name.endswith('.json'))
+                    else:
+                        paths.append(path)
+                start = time.perf_counter()
+                added, new_blobs = add_snapshots_to_archive(archive_path, paths)
+                click.echo(f"Added {added} snapshots ({new_blobs} new unique) in {time.perf_counter() - start:.2f}s", err=True)
+            if archive_extract:
+                snapshot = SnapshotArchive(archive_path).snapshot(archive_extract, when)
+                if snapshot is None:
+                    click.echo(f"Error: No snapshot of {archive_extract} in {archive_path}", err=True)
+                    sys.exit(1)
+                click.echo(json.dumps(snapshot, indent=1))
+            elif not archive_add:
+                print_archive_summary(archive_path)
+        except (OSError, ValueError) as e:
+            click.echo(f"Error: unable to use archive '{archive_path}': {e}", err=True)
+            sys.exit(1)
+        report_profile()
+        return
+
+    if tui:
+        if snapshot_path:
+            with open(snapshot_path) as f:
+                snapshot = json.load(f)
+        else:
+            compile_and_load_cpuid()
+            snapshot = capture_cpuid_snapshot(per_cpu=True)
+        run_cpuid_tui(snapshot)
+        report_profile()
+        return
+
+    while True:
+        clear_console_deeply()
+        click.echo("Welcome to ChipInspect!")
+        click.echo("Copyright (c) 2024 RoyalGraphX")
+        click.echo(f"Python {get_system_architecture()} Pre-Release {CI_vers} for {host_os_pretty()}\n")
+        click.echo("What would you like to do?")
+        click.echo(" 1. Inspect a Leaf and Subleaf")
+        click.echo(" 2. Inspect a Register or 32 Bit Value")
+        click.echo(" 3. Inspect a Register based Leaf")
+        click.echo(" 4. Inspect a 32 Bit based Leaf")
+        click.echo(" 5. Dump CPU Registers")
+        click.echo(" 6. Dump CPU Leafs in Bits")
+        click.echo(" 7. Dump CPU Register Table")
+        click.echo(" 8. Dump CPU Leafs in ASCII")
+        click.echo(" 9. Dump CPU Bits in VMWare format")
+        click.echo("10. Dump Intel Leaf 1 Information")
+        click.echo("11. Dump Intel Leaf 7 Information")
+        click.echo("12. Dump Intel Leaf 80000001 Information")
+        click.echo("13. Dump AMD Leaf 1 Information")
+        click.echo("14. Dump AMD Leaf 7 Information")
+        click.echo("15. Dump AMD Leaf 80000001 Information")
+        click.echo("16. Dump Virtualization Acceleration Report")
+        click.echo("17. Save CPUID Snapshot to File")
+        click.echo("18. Compare Guest Against Host Snapshot")
+        click.echo("19. Timer and Interrupt Latency Check")
+        click.echo("20. Browse CPUID in Full-Screen TUI")
+        click.echo("21. Fingerprint Microarchitecture by Timing")
+        click.echo("22. Interference Size and False Sharing Check")
+        click.echo("23. Denormal Handling Cost and DAZ Check")
+        click.echo("24. Intel Processor Trace Readiness")
+        click.echo("25. Branch Record (LBR/BRS) PGO Readiness")
+        click.echo("26. TLB Shootdown and PCID/INVLPGB Cost")
+        click.echo("27. Atomic Operation and Split Lock Cost")
+        click.echo("28. Cache Line Flush and Demote Cost")
+        click.echo("29. Software Prefetch Distance Tuner")
+        click.echo("30. Pipeline Characterization Suite")
+        click.echo("31. SMT Sibling Contention Benchmark")
+        click.echo("32. Power Reporting and Energy Counters")
+        click.echo("33. Idle State Exit Latency Profiler")
+        click.echo("34. Exit")
+
+        choice = click.prompt("Enter your choice", type=int)
+
+        # Each menu action is profiled on its own, excluding the time spent at the prompt
+        if profile_enabled:
+            reset_profile()
+
+        if choice == 1:
+            inspect_leaf_subleaf()
+        elif choice == 2:
+            inspect_reg_bit_data()
+        elif choice == 3:
+            inspect_register_leaf()
+        elif choice == 4:
+            inspect_bit_leaf()
+        elif choice == 5:
+            dump_cpu_registers()
+        elif choice == 6:
+            dump_cpu_bits()
+        elif choice == 7:
+            dump_cpu_register_table()
+        elif choice == 8:
+            dump_cpu_ascii()
+        elif choice == 9:
+            dumpcpuid_vmware_format()
+        elif choice == 10:
+            inspect_leaf1_intel_support()
+        elif choice == 11:
+            inspect_leaf7_intel_support()
+        elif choice == 12:
+            inspect_leaf80000001_intel_support()
+        elif choice == 13:
+            inspect_leaf1_amd_support()
+        elif choice == 14:
+            inspect_leaf7_amd_support()
+        elif choice == 15:
+            inspect_leaf80000001_amd_support()
+        elif choice == 16:
+            inspect_virtualization_support()
+        elif choice == 17:
+            save_snapshot_to_file()
+        elif choice == 18:
+            inspect_hypervisor_feature_gap()
+        elif choice == 19:
+            inspect_timer_latency()
+        elif choice == 20:
+            browse_cpuid_tui()
+        elif choice == 21:
+            inspect_uarch_fingerprint()
+        elif choice == 22:
+            inspect_interference_size()
+        elif choice == 23:
+            inspect_denormal_cost()
+        elif choice == 24:
+            inspect_processor_trace()
+        elif choice == 25:
+            inspect_branch_records()
+        elif choice == 26:
+            inspect_tlb_shootdown()
+        elif choice == 27:
+            inspect_atomic_cost()
+        elif choice == 28:
+            inspect_cache_flush_cost()
+        elif choice == 29:
+            inspect_prefetch_tuning()
+        elif choice == 30:
+            inspect_pipeline()
+        elif choice == 31:
+            inspect_smt_contention()
+        elif choice == 32:
+            inspect_power_reporting()
+        elif choice == 33:
+            inspect_idle_latency()
+        elif choice == 34:
+            exit_program()
+        else:
+            click.echo("Invalid choice. Please enter a valid option.")
+
+        report_profile()
+
+        # Pause to show the result before clearing the screen again
+        click.pause()
+
+def inspect_leaf_subleaf():
+    click.clear()
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    while True:
+        # Prompt the user for func and subfunc values
+        func_input = click.prompt("Enter the CPUID leaf (func)", default="0x0", type=str)
+
+        # Remove '0x' prefix if present and ensure it's a valid hex string
+        func_input = func_input.lstrip('0x')
+        if func_input == "":
+            func_input = "0"  # Handle empty input as '0'
+
+        try:
+            func = int(func_input, 16)
+            break
+        except ValueError:
+            click.echo(f"Error: '{func_input}' is not a valid hexadecimal integer.")
+
+    while True:
+        # Prompt the user for subleaf value, accepting both integer and letter inputs
+        subfunc_input = click.prompt("Enter the sub-leaf (subfunc)", default="0", type=str)
+
+        if subfunc_input.isdigit():
+            subfunc = int(subfunc_input)
+        elif len(subfunc_input) == 1 and subfunc_input.isalpha():
+            subfunc = ord(subfunc_input.upper()) - ord('A') + 10
+        else:
+            click.echo(f"Error: '{subfunc_input}' is not a valid sub-leaf value.")
+            continue
+        
+        click.echo(f"Inspecting CPUID leaf 0x{func:08X}, sub-leaf {subfunc}...\n")
+        break
+
+    eax, ebx, ecx, edx = call_cpuid(func, subfunc)
+    if DEBUG.upper() == "TRUE":
+        click.echo("call_cpuid function returned:")
+        click.echo(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}")
+        click.echo()
+
+    # Print registers in the requested format
+    click.echo(f"Leaf {func:X} Registers:")
+    click.echo(f"EAX: 0x{eax:08X}")
+    click.echo(f"EBX: 0x{ebx:08X}")
+    click.echo(f"ECX: 0x{ecx:08X}")
+    click.echo(f"EDX: 0x{edx:08X}\n")
+
+    # Print raw CPUID chart
+    click.echo("Generated Leaf Table:")
+    click.echo("leaf     sub   eax       ebx       ecx       edx")
+    click.echo(f"{func:08X}.{subfunc:02X}    {eax:08X}  {ebx:08X}  {ecx:08X}  {edx:08X}\n")
+
+    # Capture bit representations as strings
+    bit_eax = print_bits(eax, 32)
+    bit_ebx = print_bits(ebx, 32)
+    bit_ecx = print_bits(ecx, 32)
+    bit_edx = print_bits(edx, 32)
+
+    # Print bit representations
+    click.echo("Bit representation:")
+    click.echo(f"EAX: {bit_eax}")
+    click.echo(f"EBX: {bit_ebx}")
+    click.echo(f"ECX: {bit_ecx}")
+    click.echo(f"EDX: {bit_edx}")
+    click.echo()
+
+    # Format each register as a 16-byte Cpuid1Data style string
+    # Yes this is a def randomly in the middle of this func
+    # I needed spacing for each value pair lol
+    def occpuid_data_format(reg):
+        # Convert register to 4-byte (32-bit) integer parts in little-endian order
+        byte_str = ' '.join(f"{(reg >> (i * 8)) & 0xFF:02X}" for i in range(4))
+        return byte_str + " " + "00 " * 12
+
+    occpuid_data_eax = occpuid_data_format(eax)
+    occpuid_data_ebx = occpuid_data_format(ebx)
+    occpuid_data_ecx = occpuid_data_format(ecx)
+    occpuid_data_edx = occpuid_data_format(edx)
+
+    # Print Cpuid1Data formatted values
+    click.echo("OpenCore CPUID Data Style Format:")
+    click.echo(f"EAX: {occpuid_data_eax}")
+    click.echo(f"EBX: {occpuid_data_ebx}")
+    click.echo(f"ECX: {occpuid_data_ecx}")
+    click.echo(f"EDX: {occpuid_data_edx}")
+    click.echo()
+
+    # Convert to 4-character strings using binary_to_char
+    char_eax = binary_to_char(eax)
+    char_ebx = binary_to_char(ebx)
+    char_ecx = binary_to_char(ecx)
+    char_edx = binary_to_char(edx)
+
+    # Print as 4-character strings
+    click.echo("ASCII Representation:")
+    click.echo(f"EAX: {char_eax if char_eax else '<empty>'}")
+    click.echo(f"EBX: {char_ebx if char_ebx else '<empty>'}")
+    click.echo(f"ECX: {char_ecx if char_ecx else '<empty>'}")
+    click.echo(f"EDX: {char_edx if char_edx else '<empty>'}")
+    click.echo()
+
+    if DEBUG.upper() == "TRUE":
+        # Generate all possible decoded strings from permutations of EAX, EBX, ECX, and EDX character parts
+        click.echo("Possible Decoded Strings:\n")
+        
+        for perm in set(permutations([char_eax, char_ebx, char_ecx, char_edx])):
+            decoded_string = ''.join(perm)
+            click.echo(decoded_string)
+            
+        click.echo()
+
+def inspect_reg_bit_data():
+    click.clear()
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    # compile_and_load_cpuid()
+
+    while True:
+        input_value = input("Enter a register value or binary bit data: ").strip()
+
+        if not input_value:
+            print("No input entered. Please enter a valid value.")
+            continue
+
+        # Remove any leading "0x" if present
+        if input_value.startswith("0x") or input_value.startswith("0X"):
+            input_value = input_value[2:]
+
+        # Check if it's a register value (hexadecimal) or bit data (binary)
+        if len(input_value) <= 8 and all(char in "0123456789ABCDEFabcdef" for char in input_value):
+            # Assume it's a register value (hexadecimal)
+            # Convert hexadecimal values to acsii
+            register_value = int(input_value, 16)
+            print(f"Integer Value: {register_value}")
+            print(f"Register Value (Hex): 0x{register_value:X}")
+            print(f"ASCII Representation: {hex_to_char(input_value)}")
+            print(f"Binary Representation: {register_value:032b}")
+        elif len(input_value) == 32 and all(char in "01" for char in input_value):
+            # Assume it's bit data (binary)
+            bit_data = int(input_value, 2)
+            print(f"Integer Value: {bit_data}")
+            print(f"Hexadecimal Representation: 0x{bit_data:X}")
+            print(f"ASCII Representation: {binary_to_char(bit_data)}")
+            print(f"Binary Representation: {input_value}")
+        else:
+            print("Invalid input format. Please enter either a hexadecimal register value or binary bit data.")
+            continue
+
+        # Validate the user's response for another inspection
+        while True:
+            another_inspection = input("Do you want to perform another inspection? (yes/[no]): ").strip().lower()
+            if another_inspection in ('yes', 'y', ''):
+                break
+            elif another_inspection in ('no', 'n'):
+                return
+            else:
+                print("Invalid response. Please enter response.")
+
+def inspect_register_leaf():
+    click.clear()
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    eax = input("Enter EAX (hexadecimal register format): ").strip()
+    if not is_valid_hex_input(eax):
+        click.echo(
+            "Invalid input for EAX. Please enter a valid hexadecimal register value."
+        )
+        return
+    if eax.startswith("0x"):
+        eax = eax[2:].upper()
+
+    ebx = input("Enter EBX (hexadecimal register format): ").strip()
+    if not is_valid_hex_input(ebx):
+        click.echo(
+            "Invalid input for EBX. Please enter a valid hexadecimal register value."
+        )
+        return
+    if ebx.startswith("0x"):
+        ebx = ebx[2:].upper()
+
+    ecx = input("Enter ECX (hexadecimal register format): ").strip()
+    if not is_valid_hex_input(ecx):
+        click.echo(
+            "Invalid input for ECX. Please enter a valid hexadecimal register value."
+        )
+        return
+    if ecx.startswith("0x"):
+        ecx = ecx[2:].upper()
+
+    edx = input("Enter EDX (hexadecimal register format): ").strip()
+    if not is_valid_hex_input(edx):
+        click.echo(
+            "Invalid input for EDX. Please enter a valid hexadecimal register value."
+        )
+        return
+    if edx.startswith("0x"):
+        edx = edx[2:].upper()
+
+    # For debugging, print out the formatted inputs
+    if DEBUG.upper() == "TRUE":
+        print(f"\ninspect_register_leaf returned: - EAX: 0x{eax}, EBX: 0x{ebx}, ECX: 0x{ecx}, EDX: 0x{edx}")
+
+    # Print formatted output
+    click.echo("\nUser Defined Registers:")
+    click.echo(f"EAX: 0x{eax}")
+    click.echo(f"EBX: 0x{ebx}")
+    click.echo(f"ECX: 0x{ecx}")
     click.echo(f"EDX: 0x{edx}")
     print()
 
-    # Generate and print dummy leaf table for user defined registers
-    click.echo("Generated Leaf Table:")
-    click.echo(f"leaf     sub   eax       ebx       ecx       edx")
-    click.echo(f"00000000.00    {eax}  {ebx}  {ecx}  {edx}")
-    print()
+    # Generate and print dummy leaf table for user defined registers
+    click.echo("Generated Leaf Table:")
+    click.echo(f"leaf     sub   eax       ebx       ecx       edx")
+    click.echo(f"00000000.00    {eax}  {ebx}  {ecx}  {edx}")
+    print()
+
+    # Convert hexadecimal values to binary
+    eax_binary = hex_to_binary(eax)
+    ebx_binary = hex_to_binary(ebx)
+    ecx_binary = hex_to_binary(ecx)
+    edx_binary = hex_to_binary(edx)
+
+    # Print bit representations
+    print("Bit representation:")
+    print(f"EAX: {print_hex_bits(eax)}")
+    print(f"EBX: {print_hex_bits(ebx)}")
+    print(f"ECX: {print_hex_bits(ecx)}")
+    print(f"EDX: {print_hex_bits(edx)}")
+    print()
+
+    # Convert hexadecimal values to acsii
+    char_eax = hex_to_char(eax)
+    char_ebx = hex_to_char(ebx)
+    char_ecx = hex_to_char(ecx)
+    char_edx = hex_to_char(edx)
+
+    print("ASCII Representation:")
+    print(f"EAX: {char_eax if char_eax else '<empty>'}")
+    print(f"EBX: {char_ebx if char_ebx else '<empty>'}")
+    print(f"ECX: {char_ecx if char_ecx else '<empty>'}")
+    print(f"EDX: {char_edx if char_edx else '<empty>'}")
+    print()
+
+def inspect_bit_leaf():
+    click.clear()
+
+    def print_bits(value):
+        """Prints the bit representation of a value."""
+        return ''.join(str((value >> i) & 1) for i in range(31, -1, -1))
+
+    def print_bits_colored(value):
+        """Prints the bit representation of a value with colored output."""
+        colored_bits = []
+        for bit in value:
+            if bit == '0':
+                colored_bits.append(click.style(bit, fg='white'))
+            else:
+                colored_bits.append(click.style(bit, fg='green'))
+        
+        return ''.join(colored_bits)
+
+    def binary_to_hex(binary_value):
+        """Converts a 32-bit binary string to hexadecimal."""
+        hex_value = hex(int(binary_value, 2))
+        return hex_value[2:].upper().zfill(8)  # Remove '0x' prefix and zero-pad to 8 characters
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    eax_bits = input("Enter EAX (32-bit binary format): ").strip()
+    if len(eax_bits) != 32 or not all(bit in '01' for bit in eax_bits):
+        click.echo("Invalid input for EAX. Please enter a valid 32-bit binary value.")
+        return
+
+    ebx_bits = input("Enter EBX (32-bit binary format): ").strip()
+    if len(ebx_bits) != 32 or not all(bit in '01' for bit in ebx_bits):
+        click.echo("Invalid input for EBX. Please enter a valid 32-bit binary value.")
+        return
+
+    ecx_bits = input("Enter ECX (32-bit binary format): ").strip()
+    if len(ecx_bits) != 32 or not all(bit in '01' for bit in ecx_bits):
+        click.echo("Invalid input for ECX. Please enter a valid 32-bit binary value.")
+        return
+
+    edx_bits = input("Enter EDX (32-bit binary format): ").strip()
+    if len(edx_bits) != 32 or not all(bit in '01' for bit in edx_bits):
+        click.echo("Invalid input for EDX. Please enter a valid 32-bit binary value.")
+        return
+
+    # Convert binary values to hexadecimal
+    eax_hex = binary_to_hex(eax_bits)
+    ebx_hex = binary_to_hex(ebx_bits)
+    ecx_hex = binary_to_hex(ecx_bits)
+    edx_hex = binary_to_hex(edx_bits)
+
+    # For debugging, print out the formatted hexadecimal registers
+    if DEBUG.upper() == "TRUE":
+        print("\nbinary_to_hex returned registers:")
+        print(f"EAX: 0x{eax_hex}")
+        print(f"EBX: 0x{ebx_hex}")
+        print(f"ECX: 0x{ecx_hex}")
+        print(f"EDX: 0x{edx_hex}")
+
+    # Print formatted output
+    click.echo("\nUser Defined Registers:")
+    click.echo(f"EAX: 0x{eax_hex}")
+    click.echo(f"EBX: 0x{ebx_hex}")
+    click.echo(f"ECX: 0x{ecx_hex}")
+    click.echo(f"EDX: 0x{edx_hex}")
+    print()
+
+    # Generate and print dummy leaf table for user defined registers
+    click.echo("Generated Leaf Table:")
+    click.echo("leaf     sub   eax       ebx       ecx       edx")
+    click.echo(f"00000000.00    0x{eax_hex}  0x{ebx_hex}  0x{ecx_hex}  0x{edx_hex}")
+    print()
+
+    # Print bit representations
+    print("Bit representation:")
+    print(f"EAX: {print_bits_colored(eax_bits)}")
+    print(f"EBX: {print_bits_colored(ebx_bits)}")
+    print(f"ECX: {print_bits_colored(ecx_bits)}")
+    print(f"EDX: {print_bits_colored(edx_bits)}")
+    print()
+
+    # Convert hexadecimal values to ASCII characters
+    char_eax = hex_to_char(eax_hex)
+    char_ebx = hex_to_char(ebx_hex)
+    char_ecx = hex_to_char(ecx_hex)
+    char_edx = hex_to_char(edx_hex)
+
+    print("ASCII Representation:")
+    print(f"EAX: {char_eax if char_eax else '<empty>'}")
+    print(f"EBX: {char_ebx if char_ebx else '<empty>'}")
+    print(f"ECX: {char_ecx if char_ecx else '<empty>'}")
+    print(f"EDX: {char_edx if char_edx else '<empty>'}")
+    print()
+
+def dump_cpu_registers():
+    click.clear()
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    process_leaves_registers()
+
+def dump_cpu_bits():
+    click.clear()
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    process_leaves_bits()
+
+def dump_cpu_register_table():
+    click.clear()
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    generate_raw_table()
+
+def dump_cpu_register_table():
+    click.clear()
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    generate_raw_table()
+
+def dump_cpu_ascii():
+    click.clear()
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    process_leaves_ascii()
+
+def check_avx2_support():
+    click.clear()
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    click.echo("This is a proof of concept entry.")
+    print()
+
+    # Query CPUID leaf 7, subleaf 0 to check AVX2 support
+    eax, ebx, ecx, edx = call_cpuid(7, 0)
+    if DEBUG.upper() == "TRUE":
+        print("call_cpuid function returned:")
+        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+
+    # Print EBX in hexadecimal format
+    if DEBUG.upper() == "TRUE":
+        print(f"Leaf 7 sub-leaf 0 Registers...")
+        print(f"EAX: 0x{eax:08X}")
+        print(f"EBX: 0x{ebx:08X}")
+        print(f"ECX: 0x{ecx:08X}")
+        print(f"EDX: 0x{edx:08X}")
+        print()
+        
+    avx2_bit = ebx & (1 << 5)  # AVX2 bit is 5th bit in EBX (zero-indexed)
+
+    # Print EBX in 32-bit binary format with AVX2 bit highlighted
+    ebx_binary = f"{ebx:032b}"
+    avx2_bit_index = 31 - 5  # AVX2 bit is 5th from the right (zero-indexed)
+    colored_ebx_binary = (
+        ebx_binary[:avx2_bit_index]
+        + click.style(ebx_binary[avx2_bit_index], fg='green', bold=True)
+        + ebx_binary[avx2_bit_index + 1:]
+    )
+    click.echo(f"EBX in binary: {colored_ebx_binary}")
+    print()
+
+    if avx2_bit:
+        click.echo("AVX2 is supported on this CPU.")
+    else:
+        click.echo("AVX2 is not supported on this CPU.")
+    
+    print()
+
+def inspect_leaf1_intel_support():
+    click.clear()
+
+    def color_bits(binary_string):
+        """Returns a colored version of the binary string with specific bits highlighted."""
+        colored_bits = ""
+        for i, bit in enumerate(binary_string):
+            # Highlight specific bit in red if it's '0', green if it's '1'
+            if bit == '0':
+                colored_bits += click.style(bit, fg='red')
+            else:
+                colored_bits += click.style(bit, fg='green', bold=True)
+        return colored_bits
+
+    def colored_description(description, bit_value):
+        """Returns a colored version of the description based on the bit value."""
+        if bit_value == '0':
+            return click.style(description, fg='red')
+        else:
+            return click.style(description, fg='green', bold=True)
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    # Query CPUID leaf 1, subleaf 0
+    eax, ebx, ecx, edx = call_cpuid(1, 0)
+    if DEBUG.upper() == "TRUE":
+        print("call_cpuid function returned:")
+        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+
+    # Print in hexadecimal format
+    if DEBUG.upper() == "TRUE":
+        click.echo("Leaf 1 sub-leaf 0 Registers:")
+        click.echo(f"EAX: 0x{eax:08X}")
+        click.echo(f"EBX: 0x{ebx:08X}")
+        click.echo(f"ECX: 0x{ecx:08X}")
+        click.echo(f"EDX: 0x{edx:08X}\n")
+
+    # Convert ECX and EDX to binary strings
+    eax_binary = f"{eax:032b}"
+    ebx_binary = f"{ebx:032b}"
+    ecx_binary = f"{ecx:032b}"
+    edx_binary = f"{edx:032b}"
+
+    colored_eax_bits = color_bits(eax_binary)
+    colored_ebx_bits = color_bits(ebx_binary)
+    colored_ecx_bits = color_bits(ecx_binary)
+    colored_edx_bits = color_bits(edx_binary)
+
+    # Print EAX in binary format and parse it
+    colored_eax_bits = color_bits(eax_binary)
+    if DEBUG.upper() == "TRUE":
+        click.echo("EAX in binary:")
+        print(colored_eax_bits)
+        print()
+
+    # Step through each bit in eax_binary and list its meaning
+    click.echo("Intel CPUID Leaf 1, Sub-leaf 0 EAX Bits:")
+    for bit_index, description in feature_bits("intel", 0x00000001, 0, "eax"):
+        bit_value = eax_binary[31 - bit_index]
+        colored_value = colored_binary_value(eax_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    # Bit Breakdown for Leaf 1 EAX Data
+    click.echo("\nIntel CPUID Leaf 1, Sub-leaf 0 EAX Breakdown:")
+    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Field", "Bit Position", "Value", "Hex"))
+    click.echo("-" * 55)  # Separator line
+
+    # Extract each field's value and its corresponding hex
+    stepping_id = eax_binary[28:32]
+    model_number = eax_binary[24:28]
+    family_id = eax_binary[20:24]
+    processor_type = eax_binary[18:20]
+    reserved_secondary = eax_binary[16:18]
+    extended_model_id = eax_binary[12:16]
+    extended_family_id = eax_binary[4:12]
+    reserved = eax_binary[0:4]
+
+    # Display each field's breakdown
+    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Stepping ID", "0-3", f"{int(stepping_id, 2):04b}", f"{int(stepping_id, 2):X}"))
+    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Model Number", "4-7", f"{int(model_number, 2):04b}", f"{int(model_number, 2):X}"))
+    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Family ID", "8-11", f"{int(family_id, 2):04b}", f"{int(family_id, 2):X}"))
+    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Processor Type", "12-13", f"{int(processor_type, 2):02b}", f"{int(processor_type, 2):X}"))
+    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Reserved", "14-15", f"{int(reserved_secondary, 2):02b}", f"{int(reserved_secondary, 2):X}"))
+    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Extended Model ID", "16-19", f"{int(extended_model_id, 2):04b}", f"{int(extended_model_id, 2):X}"))
+    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Extended Family ID", "20-27", f"{int(extended_family_id, 2):08b}", f"{int(extended_family_id, 2):X}"))
+    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Reserved", "28-31", f"{int(reserved, 2):04b}", f"{int(reserved, 2):X}"))
+
+    # Function to highlight the bits in green for visualization
+    def highlight_bits(eax_binary, start, end):
+        return (
+            eax_binary[:start] + 
+            click.style(eax_binary[start:end], fg='green') + 
+            eax_binary[end:]
+        )
+
+    # New section for debugging visualization
+    if DEBUG.upper() == "TRUE":
+        click.echo()
+        click.echo("Bit Range:")
+        click.echo(highlight_bits(eax_binary, 28, 32))  # Stepping ID
+        click.echo(highlight_bits(eax_binary, 24, 28))  # Model Number
+        click.echo(highlight_bits(eax_binary, 20, 24))  # Family ID
+        click.echo(highlight_bits(eax_binary, 18, 20))  # Processor Type
+        click.echo(highlight_bits(eax_binary, 16, 18))  # Reserved Secondary
+        click.echo(highlight_bits(eax_binary, 12, 16))  # Extended Model ID
+        click.echo(highlight_bits(eax_binary, 4, 12))   # Extended Family ID
+        click.echo(highlight_bits(eax_binary, 0, 4))    # Reserved
+
+    click.echo()  # Add a newline for cleaner output
+
+# Print EBX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("EBX in binary:")
+        print(colored_ebx_bits)
+        print()
+
+    # Step through each bit in ecx_binary and list its meaning
+    click.echo("Intel CPUID Leaf 1, Sub-leaf 0 EBX Bits:")
+    for bit_index, description in feature_bits("intel", 0x00000001, 0, "ebx"):
+        bit_value = ebx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        #click.echo(f"Value: {colored_value} - {description}")
+        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+    
+    # Print ECX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("ECX in binary:")
+        print(colored_ecx_bits)
+        print()
+
+    # Step through each bit in ecx_binary and list its meaning
+    click.echo("Intel CPUID Leaf 1, Sub-leaf 0 ECX Bits:")
+    for bit_index, description in feature_bits("intel", 0x00000001, 0, "ecx"):
+        bit_value = ecx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        #click.echo(f"Value: {colored_value} - {description}")
+        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+
+    # Print EDX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("EDX in binary:")
+        print(colored_edx_bits)
+        print()
+
+    # Step through each bit in edx_binary and list its meaning
+    click.echo("Intel CPUID Leaf 1, Sub-leaf 0 EDX Bits:")
+    for bit_index, description in feature_bits("intel", 0x00000001, 0, "edx"):
+        bit_value = edx_binary[31 - bit_index]
+        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        #click.echo(f"Value: {colored_value} - {description}")
+        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
+        click.echo(f"{colored_value} - {colored_desc}")
+
+def inspect_leaf7_intel_support():
+    click.clear()
+
+    def color_bits(binary_string):
+        """Returns a colored version of the binary string with specific bits highlighted."""
+        colored_bits = ""
+        for i, bit in enumerate(binary_string):
+            # Highlight specific bit in red if it's '0', green if it's '1'
+            if bit == '0':
+                colored_bits += click.style(bit, fg='red')
+            else:
+                colored_bits += click.style(bit, fg='green', bold=True)
+        return colored_bits
+
+    def colored_description(description, bit_value):
+        """Returns a colored version of the description based on the bit value."""
+        if bit_value == '0':
+            return click.style(description, fg='red')
+        else:
+            return click.style(description, fg='green', bold=True)
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    # Query CPUID leaf 7, subleaf 0
+    eax, ebx, ecx, edx = call_cpuid(7, 0)
+    if DEBUG.upper() == "TRUE":
+        print("call_cpuid function returned:")
+        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+
+    # Print EBX in hexadecimal format
+    if DEBUG.upper() == "TRUE":
+        click.echo("Leaf 7 sub-leaf 0 Registers:")
+        click.echo(f"EAX: 0x{eax:08X}")
+        click.echo(f"EBX: 0x{ebx:08X}")
+        click.echo(f"ECX: 0x{ecx:08X}")
+        click.echo(f"EDX: 0x{edx:08X}\n")
+
+    # Convert EBX to binary string
+    ebx_binary = f"{ebx:032b}"
+    ecx_binary = f"{ecx:032b}"
+    edx_binary = f"{edx:032b}"
+
+    colored_ebx_bits = color_bits(ebx_binary)
+    colored_ecx_bits = color_bits(ecx_binary)
+    colored_edx_bits = color_bits(edx_binary)
+    
+    # Print EBX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("EBX in binary:")
+        print(colored_ebx_bits)
+        print()
+
+    # Step through each bit in ebx_binary and list its meaning
+    click.echo("Intel CPUID Leaf 7, Sub-leaf 0 EBX Bits:")
+    for bit_index, description in feature_bits("intel", 0x00000007, 0, "ebx"):
+        bit_value = ebx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        #click.echo(f"Value: {colored_value} - {description}")
+        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+
+    # Print ECX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("ECX in binary:")
+        print(colored_ecx_bits)
+        print()
+
+    # Step through each bit in ecx_binary and list its meaning
+    click.echo("Intel CPUID Leaf 7, Sub-leaf 0 ECX Bits:")
+    for bit_index, description in feature_bits("intel", 0x00000007, 0, "ecx"):
+        bit_value = ecx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        #click.echo(f"Value: {colored_value} - {description}")
+        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+
+    # Print EDX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("EDX in binary:")
+        print(colored_edx_bits)
+        print()
+
+    # Step through each bit in edx_binary and list its meaning
+    click.echo("Intel CPUID Leaf 7, Sub-leaf 0 EDX Bits:")
+    for bit_index, description in feature_bits("intel", 0x00000007, 0, "edx"):
+        bit_value = edx_binary[31 - bit_index]
+        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        #click.echo(f"Value: {colored_value} - {description}")
+        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+
+def inspect_leaf80000001_intel_support():
+    click.clear()
+
+    def color_bits(binary_string):
+        """Returns a colored version of the binary string with specific bits highlighted."""
+        colored_bits = ""
+        for i, bit in enumerate(binary_string):
+            # Highlight specific bit in red if it's '0', green if it's '1'
+            if bit == '0':
+                colored_bits += click.style(bit, fg='red')
+            else:
+                colored_bits += click.style(bit, fg='green', bold=True)
+        return colored_bits
+
+    def colored_description(description, bit_value):
+        """Returns a colored version of the description based on the bit value."""
+        if bit_value == '0':
+            return click.style(description, fg='red')
+        else:
+            return click.style(description, fg='green', bold=True)
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    # Query CPUID leaf 0x80000001, subleaf H
+    eax, ebx, ecx, edx = call_cpuid(0x80000001, 17)
+    if DEBUG.upper() == "TRUE":
+        print("call_cpuid function returned:")
+        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+
+    # Print EBX in hexadecimal format
+    if DEBUG.upper() == "TRUE":
+        click.echo("Leaf 0x80000001 sub-leaf H Registers:")
+        click.echo(f"EAX: 0x{eax:08X}")
+        click.echo(f"EBX: 0x{ebx:08X}")
+        click.echo(f"ECX: 0x{ecx:08X}")
+        click.echo(f"EDX: 0x{edx:08X}\n")
+
+    # Convert EBX to binary string
+    ebx_binary = f"{ebx:032b}"
+    ecx_binary = f"{ecx:032b}"
+    edx_binary = f"{edx:032b}"
+
+    colored_ebx_bits = color_bits(ebx_binary)
+    colored_ecx_bits = color_bits(ecx_binary)
+    colored_edx_bits = color_bits(edx_binary)
+    
+    # Print EBX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("EBX in binary:")
+        print(colored_ebx_bits)
+        print()
+
+    # Step through each bit in ebx_binary and list its meaning
+    click.echo("Intel CPUID Leaf 0x80000001, Sub-leaf H EBX Bits:")
+    for bit_index, description in feature_bits("intel", 0x80000001, 0, "ebx"):
+        bit_value = ebx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        #click.echo(f"Value: {colored_value} - {description}")
+        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
+        click.echo(f"{colored_value} - {colored_desc}")
 
-    # Convert hexadecimal values to binary
-    eax_binary = hex_to_binary(eax)
-    ebx_binary = hex_to_binary(ebx)
-    ecx_binary = hex_to_binary(ecx)
-    edx_binary = hex_to_binary(edx)
+    click.echo()  # Add a newline for cleaner output
 
-    # Print bit representations
-    print("Bit representation:")
-    print(f"EAX: {print_hex_bits(eax)}")
-    print(f"EBX: {print_hex_bits(ebx)}")
-    print(f"ECX: {print_hex_bits(ecx)}")
-    print(f"EDX: {print_hex_bits(edx)}")
-    print()
+    # Print ECX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("ECX in binary:")
+        print(colored_ecx_bits)
+        print()
 
-    # Convert hexadecimal values to acsii
-    char_eax = hex_to_char(eax)
-    char_ebx = hex_to_char(ebx)
-    char_ecx = hex_to_char(ecx)
-    char_edx = hex_to_char(edx)
+    # Step through each bit in ecx_binary and list its meaning
+    click.echo("Intel CPUID Leaf 0x80000001, Sub-leaf H ECX Bits:")
+    for bit_index, description in feature_bits("intel", 0x80000001, 0, "ecx"):
+        bit_value = ecx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        #click.echo(f"Value: {colored_value} - {description}")
+        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
+        click.echo(f"{colored_value} - {colored_desc}")
 
-    print("ASCII Representation:")
-    print(f"EAX: {char_eax if char_eax else '<empty>'}")
-    print(f"EBX: {char_ebx if char_ebx else '<empty>'}")
-    print(f"ECX: {char_ecx if char_ecx else '<empty>'}")
-    print(f"EDX: {char_edx if char_edx else '<empty>'}")
-    print()
+    click.echo()  # Add a newline for cleaner output
+
+    # Print EDX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("EDX in binary:")
+        print(colored_edx_bits)
+        print()
+
+    # Step through each bit in edx_binary and list its meaning
+    click.echo("Intel CPUID Leaf 0x80000001, Sub-leaf H EDX Bits:")
+    for bit_index, description in feature_bits("intel", 0x80000001, 0, "edx"):
+        bit_value = edx_binary[31 - bit_index]
+        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        #click.echo(f"Value: {colored_value} - {description}")
+        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+
+def inspect_leaf1_amd_support():
+    click.clear()
+
+    def color_bits(binary_string):
+        """Returns a colored version of the binary string with specific bits highlighted."""
+        colored_bits = ""
+        for i, bit in enumerate(binary_string):
+            # Highlight specific bit in red if it's '0', green if it's '1'
+            if bit == '0':
+                colored_bits += click.style(bit, fg='red')
+            else:
+                colored_bits += click.style(bit, fg='green', bold=True)
+        return colored_bits
+
+    def colored_description(description, bit_value):
+        """Returns a colored version of the description based on the bit value."""
+        if bit_value == '0':
+            return click.style(description, fg='red')
+        else:
+            return click.style(description, fg='green', bold=True)
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    # Query CPUID leaf 1, subleaf 0
+    eax, ebx, ecx, edx = call_cpuid(1, 0)
+    if DEBUG.upper() == "TRUE":
+        print("call_cpuid function returned:")
+        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+
+    # Print Registers in hexadecimal format
+    if DEBUG.upper() == "TRUE":
+        click.echo("Leaf 1 sub-leaf 0 Registers:")
+        click.echo(f"EAX: 0x{eax:08X}")
+        click.echo(f"EBX: 0x{ebx:08X}")
+        click.echo(f"ECX: 0x{ecx:08X}")
+        click.echo(f"EDX: 0x{edx:08X}\n")
+
+    # Convert Registers to binary strings
+    ebx_binary = f"{ebx:032b}"
+    ecx_binary = f"{ecx:032b}"
+    edx_binary = f"{edx:032b}"
+
+    colored_ebx_bits = color_bits(ebx_binary)
+    colored_ecx_bits = color_bits(ecx_binary)
+    colored_edx_bits = color_bits(edx_binary)
+    
+    # Print EBX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("EBX in binary:")
+        print(colored_ebx_bits)
+        click.echo()
+
+    # Step through each bit in ebx_binary and list its meaning
+    click.echo("AMD CPUID Leaf 1, Sub-leaf 0 EBX Bits:")
+    for bit_index, description in feature_bits("amd", 0x00000001, 0, "ebx"):
+        bit_value = ebx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+
+    # Print ECX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("ECX in binary:")
+        print(colored_ecx_bits)
+        click.echo()
+
+    # Step through each bit in ecx_binary and list its meaning
+    click.echo("AMD CPUID Leaf 1, Sub-leaf 0 ECX Bits:")
+    for bit_index, description in feature_bits("amd", 0x00000001, 0, "ecx"):
+        bit_value = ecx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+
+    # Print EDX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("EDX in binary:")
+        print(colored_edx_bits)
+        click.echo()
+
+    # Step through each bit in edx_binary and list its meaning
+    click.echo("AMD CPUID Leaf 1, Sub-leaf 0 EDX Bits:")
+    for bit_index, description in feature_bits("amd", 0x00000001, 0, "edx"):
+        bit_value = edx_binary[31 - bit_index]
+        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+
+def inspect_leaf7_amd_support():
+    click.clear()
+
+    def color_bits(binary_string):
+        """Returns a colored version of the binary string with specific bits highlighted."""
+        colored_bits = ""
+        for i, bit in enumerate(binary_string):
+            # Highlight specific bit in red if it's '0', green if it's '1'
+            if bit == '0':
+                colored_bits += click.style(bit, fg='red')
+            else:
+                colored_bits += click.style(bit, fg='green', bold=True)
+        return colored_bits
+
+    def colored_description(description, bit_value):
+        """Returns a colored version of the description based on the bit value."""
+        if bit_value == '0':
+            return click.style(description, fg='red')
+        else:
+            return click.style(description, fg='green', bold=True)
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
+
+    # Query CPUID leaf 7, subleaf 0
+    eax, ebx, ecx, edx = call_cpuid(7, 0)
+    if DEBUG.upper() == "TRUE":
+        print("call_cpuid function returned:")
+        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+
+    # Print Registers in hexadecimal format
+    if DEBUG.upper() == "TRUE":
+        click.echo("Leaf 7 sub-leaf 0 Registers:")
+        click.echo(f"EAX: 0x{eax:08X}")
+        click.echo(f"EBX: 0x{ebx:08X}")
+        click.echo(f"ECX: 0x{ecx:08X}")
+        click.echo(f"EDX: 0x{edx:08X}\n")
+
+    # Convert Registers to binary strings
+    ebx_binary = f"{ebx:032b}"
+    ecx_binary = f"{ecx:032b}"
+    edx_binary = f"{edx:032b}"
+
+    colored_ebx_bits = color_bits(ebx_binary)
+    colored_ecx_bits = color_bits(ecx_binary)
+    colored_edx_bits = color_bits(edx_binary)
+    
+    # Print EBX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("EBX in binary:")
+        print(colored_ebx_bits)
+        click.echo()
+
+    # Step through each bit in ebx_binary and list its meaning
+    click.echo("AMD CPUID Leaf 7, Sub-leaf 0 EBX Bits:")
+    for bit_index, description in feature_bits("amd", 0x00000007, 0, "ebx"):
+        bit_value = ebx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+
+    # Print ECX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("ECX in binary:")
+        print(colored_ecx_bits)
+        click.echo()
+
+    # Step through each bit in ecx_binary and list its meaning
+    click.echo("AMD CPUID Leaf 7, Sub-leaf 0 ECX Bits:")
+    for bit_index, description in feature_bits("amd", 0x00000007, 0, "ecx"):
+        bit_value = ecx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+
+    # Print EDX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("EDX in binary:")
+        print(colored_edx_bits)
+        click.echo()
+
+    # Step through each bit in edx_binary and list its meaning
+    click.echo("AMD CPUID Leaf 7, Sub-leaf 0 EDX Bits:")
+    for bit_index, description in feature_bits("amd", 0x00000007, 0, "edx"):
+        bit_value = edx_binary[31 - bit_index]
+        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        click.echo(f"{colored_value} - {colored_desc}")
 
-def inspect_bit_leaf():
-    click.clear()
+    click.echo()  # Add a newline for cleaner output
 
-    def print_bits(value):
-        """Prints the bit representation of a value."""
-        return ''.join(str((value >> i) & 1) for i in range(31, -1, -1))
+def inspect_leaf80000001_amd_support():
+    click.clear()
 
-    def print_bits_colored(value):
-        """Prints the bit representation of a value with colored output."""
-        colored_bits = []
-        for bit in value:
+    def color_bits(binary_string):
+        """Returns a colored version of the binary string with specific bits highlighted."""
+        colored_bits = ""
+        for i, bit in enumerate(binary_string):
+            # Highlight specific bit in red if it's '0', green if it's '1'
             if bit == '0':
-                colored_bits.append(click.style(bit, fg='white'))
+                colored_bits += click.style(bit, fg='red')
             else:
-                colored_bits.append(click.style(bit, fg='green'))
-        
-        return ''.join(colored_bits)
+                colored_bits += click.style(bit, fg='green', bold=True)
+        return colored_bits
 
-    def binary_to_hex(binary_value):
-        """Converts a 32-bit binary string to hexadecimal."""
-        hex_value = hex(int(binary_value, 2))
-        return hex_value[2:].upper().zfill(8)  # Remove '0x' prefix and zero-pad to 8 characters
+    def colored_description(description, bit_value):
+        """Returns a colored version of the description based on the bit value."""
+        if bit_value == '0':
+            return click.style(description, fg='red')
+        else:
+            return click.style(description, fg='green', bold=True)
 
     if DEBUG.upper() == "TRUE":
         click.echo("If you see this message, you're in DEBUG mode...")
 
-    eax_bits = input("Enter EAX (32-bit binary format): ").strip()
-    if len(eax_bits) != 32 or not all(bit in '01' for bit in eax_bits):
-        click.echo("Invalid input for EAX. Please enter a valid 32-bit binary value.")
-        return
+    compile_and_load_cpuid()
 
-    ebx_bits = input("Enter EBX (32-bit binary format): ").strip()
-    if len(ebx_bits) != 32 or not all(bit in '01' for bit in ebx_bits):
-        click.echo("Invalid input for EBX. Please enter a valid 32-bit binary value.")
-        return
+    # Query CPUID leaf 0x80000001, subleaf H
+    eax, ebx, ecx, edx = call_cpuid(0x80000001, 17)
+    if DEBUG.upper() == "TRUE":
+        print("call_cpuid function returned:")
+        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
 
-    ecx_bits = input("Enter ECX (32-bit binary format): ").strip()
-    if len(ecx_bits) != 32 or not all(bit in '01' for bit in ecx_bits):
-        click.echo("Invalid input for ECX. Please enter a valid 32-bit binary value.")
-        return
+    # Print Registers in hexadecimal format
+    if DEBUG.upper() == "TRUE":
+        click.echo("Leaf 0x80000001 sub-leaf H Registers:")
+        click.echo(f"EAX: 0x{eax:08X}")
+        click.echo(f"EBX: 0x{ebx:08X}")
+        click.echo(f"ECX: 0x{ecx:08X}")
+        click.echo(f"EDX: 0x{edx:08X}\n")
 
-    edx_bits = input("Enter EDX (32-bit binary format): ").strip()
-    if len(edx_bits) != 32 or not all(bit in '01' for bit in edx_bits):
-        click.echo("Invalid input for EDX. Please enter a valid 32-bit binary value.")
-        return
+    # Convert Registers to binary strings
+    ebx_binary = f"{ebx:032b}"
+    ecx_binary = f"{ecx:032b}"
+    edx_binary = f"{edx:032b}"
 
-    # Convert binary values to hexadecimal
-    eax_hex = binary_to_hex(eax_bits)
-    ebx_hex = binary_to_hex(ebx_bits)
-    ecx_hex = binary_to_hex(ecx_bits)
-    edx_hex = binary_to_hex(edx_bits)
+    colored_ebx_bits = color_bits(ebx_binary)
+    colored_ecx_bits = color_bits(ecx_binary)
+    colored_edx_bits = color_bits(edx_binary)
 
-    # For debugging, print out the formatted hexadecimal registers
+    # Print EBX in binary format
     if DEBUG.upper() == "TRUE":
-        print("\nbinary_to_hex returned registers:")
-        print(f"EAX: 0x{eax_hex}")
-        print(f"EBX: 0x{ebx_hex}")
-        print(f"ECX: 0x{ecx_hex}")
-        print(f"EDX: 0x{edx_hex}")
+        click.echo("EBX in binary:")
+        print(colored_ebx_bits)
+        click.echo()
 
-    # Print formatted output
-    click.echo("\nUser Defined Registers:")
-    click.echo(f"EAX: 0x{eax_hex}")
-    click.echo(f"EBX: 0x{ebx_hex}")
-    click.echo(f"ECX: 0x{ecx_hex}")
-    click.echo(f"EDX: 0x{edx_hex}")
-    print()
+    # Step through each bit in ebx_binary and list its meaning
+    click.echo("AMD CPUID Leaf 0x80000001, Sub-leaf H EBX Bits:")
+    for bit_index, description in feature_bits("amd", 0x80000001, 0, "ebx"):
+        bit_value = ebx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        click.echo(f"{colored_value} - {colored_desc}")
 
-    # Generate and print dummy leaf table for user defined registers
-    click.echo("Generated Leaf Table:")
-    click.echo("leaf     sub   eax       ebx       ecx       edx")
-    click.echo(f"00000000.00    0x{eax_hex}  0x{ebx_hex}  0x{ecx_hex}  0x{edx_hex}")
-    print()
+    click.echo()  # Add a newline for cleaner output
+    
+    # Print ECX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("ECX in binary:")
+        print(colored_ecx_bits)
+        click.echo()
 
-    # Print bit representations
-    print("Bit representation:")
-    print(f"EAX: {print_bits_colored(eax_bits)}")
-    print(f"EBX: {print_bits_colored(ebx_bits)}")
-    print(f"ECX: {print_bits_colored(ecx_bits)}")
-    print(f"EDX: {print_bits_colored(edx_bits)}")
-    print()
+    # Step through each bit in ecx_binary and list its meaning
+    click.echo("AMD CPUID Leaf 0x80000001, Sub-leaf H ECX Bits:")
+    for bit_index, description in feature_bits("amd", 0x80000001, 0, "ecx"):
+        bit_value = ecx_binary[31 - bit_index]
+        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        click.echo(f"{colored_value} - {colored_desc}")
 
-    # Convert hexadecimal values to ASCII characters
-    char_eax = hex_to_char(eax_hex)
-    char_ebx = hex_to_char(ebx_hex)
-    char_ecx = hex_to_char(ecx_hex)
-    char_edx = hex_to_char(edx_hex)
+    click.echo()  # Add a newline for cleaner output
 
-    print("ASCII Representation:")
-    print(f"EAX: {char_eax if char_eax else '<empty>'}")
-    print(f"EBX: {char_ebx if char_ebx else '<empty>'}")
-    print(f"ECX: {char_ecx if char_ecx else '<empty>'}")
-    print(f"EDX: {char_edx if char_edx else '<empty>'}")
-    print()
+    # Print EDX in binary format
+    if DEBUG.upper() == "TRUE":
+        click.echo("EDX in binary:")
+        print(colored_edx_bits)
+        click.echo()
 
-def dump_cpu_registers():
+    # Step through each bit in ecx_binary and list its meaning
+    click.echo("AMD CPUID Leaf 0x80000001, Sub-leaf H EDX Bits:")
+    for bit_index, description in feature_bits("amd", 0x80000001, 0, "edx"):
+        bit_value = edx_binary[31 - bit_index]
+        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
+        colored_desc = colored_description(description, bit_value)
+        click.echo(f"{colored_value} - {colored_desc}")
+
+    click.echo()  # Add a newline for cleaner output
+
+def dumpcpuid_vmware_format():
     click.clear()
 
     if DEBUG.upper() == "TRUE":
@@ -1792,9 +5578,9 @@ def dump_cpu_registers():
 
     compile_and_load_cpuid()
 
-    process_leaves_registers()
+    process_leaves_bits_vmware()
 
-def dump_cpu_bits():
+def inspect_virtualization_support():
     click.clear()
 
     if DEBUG.upper() == "TRUE":
@@ -1802,9 +5588,138 @@ def dump_cpu_bits():
 
     compile_and_load_cpuid()
 
-    process_leaves_bits()
+    # MSRs come from the msr module unless the user replays a captured file.
+    # The replay table only lives for this report so later options read real MSRs.
+    global msr_replay_table
+    msr_replay_table = None
+    msr_file = click.prompt("Enter an MSR replay file (leave blank to read /dev/cpu/0/msr)", default="", show_default=False).strip()
+    if msr_file:
+        try:
+            load_msr_replay_file(msr_file)
+        except (OSError, ValueError) as e:
+            msr_replay_table = None
+            click.echo(f"Error: unable to load MSR replay file '{msr_file}': {e}")
+            return
+    click.echo()
 
-def dump_cpu_register_table():
+    try:
+        report_virtualization_support()
+    finally:
+        msr_replay_table = None
+
+def report_virtualization_support():
+    vendor = get_cpu_vendor()
+    _, _, leaf1_ecx, _ = call_cpuid(1, 0)
+    max_extended_leaf, _, _, _ = call_cpuid(0x80000000, 0)
+
+    vmx_supported = bool(leaf1_ecx & (1 << 5))
+    hypervisor_present = bool(leaf1_ecx & (1 << 31))
+    svm_supported = False
+    if max_extended_leaf >= 0x80000001:
+        _, _, ext_ecx, _ = call_cpuid(0x80000001, 0)
+        svm_supported = bool(ext_ecx & (1 << 2))
+
+    click.echo(f"CPU Vendor: {vendor}")
+    click.echo(f"VMX (Leaf 1 ECX Bit 5): {'Supported' if vmx_supported else 'Not supported'}")
+    click.echo(f"SVM (Leaf 0x80000001 ECX Bit 2): {'Supported' if svm_supported else 'Not supported'}")
+    if hypervisor_present:
+        click.echo("Hypervisor present: the capabilities below are what it exposes for nested virtualization.")
+    click.echo()
+
+    # Each entry is (feature, available) and feeds the summary at the end
+    acceleration = []
+
+    if svm_supported and max_extended_leaf >= 0x8000000A:
+        eax, ebx, ecx, edx = call_cpuid(0x8000000A, 0)
+        if DEBUG.upper() == "TRUE":
+            print("call_cpuid function returned:")
+            print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+
+        click.echo(f"SVM Revision: {eax & 0xFF}")
+        click.echo(f"Number of ASIDs (NASID): {ebx}\n")
+        print_bit_list("AMD CPUID Leaf 0x8000000A, Sub-leaf 0 EDX Bits:", edx, feature_bits("amd", 0x8000000A, 0, "edx"))
+
+        for bit, feature in [
+            (0,  "Nested paging (NPT)"),
+            (6,  "Flush by ASID"),
+            (5,  "VMCB clean bits"),
+            (7,  "Decode assists"),
+            (3,  "NRIP save"),
+            (10, "PAUSE intercept filter"),
+            (12, "PAUSE filter threshold"),
+            (13, "AVIC"),
+            (18, "x2AVIC"),
+            (15, "Virtualized VMSAVE/VMLOAD"),
+            (16, "Virtualized GIF"),
+            (25, "Virtual NMI"),
+            (4,  "TSC rate control"),
+        ]:
+            acceleration.append((feature, bool(edx & (1 << bit))))
+
+    if vmx_supported:
+        basic = read_msr(0x480)
+        if basic is None:
+            click.echo("VMX capability MSRs are unavailable. Load the msr module (modprobe msr) and run as root, or provide an MSR replay file.\n")
+        else:
+            feature_control = read_msr(0x3A)
+            if feature_control is not None and feature_control & 1 and not feature_control & (1 << 2):
+                click.echo(click.style("IA32_FEATURE_CONTROL is locked with VMX outside SMX disabled by firmware.", fg='red'))
+
+            click.echo(f"IA32_VMX_BASIC: 0x{basic:016X}")
+            click.echo(f"VMCS Revision ID: 0x{basic & 0x7FFFFFFF:X}")
+            click.echo(f"VMCS Region Size: {(basic >> 32) & 0x1FFF} bytes\n")
+
+            # The TRUE_* control MSRs replace the legacy ones when IA32_VMX_BASIC bit 55 is set
+            true_controls = bool(basic & (1 << 55))
+            pinbased = read_msr(0x48D if true_controls else 0x481) or 0
+            procbased = read_msr(0x48E if true_controls else 0x482) or 0
+            procbased2 = 0
+            ept_vpid_cap = 0
+
+            print_bit_list("IA32_VMX_PINBASED_CTLS Allowed-1 Bits:", pinbased >> 32, intel_vmx_pinbased_ctls_bits)
+            print_bit_list("IA32_VMX_PROCBASED_CTLS Allowed-1 Bits:", procbased >> 32, intel_vmx_procbased_ctls_bits)
+
+            if (procbased >> 32) & (1 << 31):
+                procbased2 = read_msr(0x48B) or 0
+                print_bit_list("IA32_VMX_PROCBASED_CTLS2 Allowed-1 Bits:", procbased2 >> 32, intel_vmx_procbased_ctls2_bits)
+
+            if (procbased2 >> 32) & ((1 << 1) | (1 << 5)):
+                ept_vpid_cap = read_msr(0x48C) or 0
+                print_bit_list("IA32_VMX_EPT_VPID_CAP Bits:", ept_vpid_cap, intel_vmx_ept_vpid_cap_bits, num_bits=64)
+
+            pinbased_allowed = pinbased >> 32
+            procbased2_allowed = procbased2 >> 32
+            for feature, available in [
+                ("Extended page tables (EPT)", procbased2_allowed & (1 << 1)),
+                ("EPT 2MB pages", ept_vpid_cap & (1 << 16)),
+                ("EPT 1GB pages", ept_vpid_cap & (1 << 17)),
+                ("EPT accessed/dirty flags", ept_vpid_cap & (1 << 21)),
+                ("VPID", procbased2_allowed & (1 << 5)),
+                ("Unrestricted guest", procbased2_allowed & (1 << 7)),
+                ("APIC-register virtualization", procbased2_allowed & (1 << 8)),
+                ("Virtual-interrupt delivery", procbased2_allowed & (1 << 9)),
+                ("Posted interrupts", pinbased_allowed & (1 << 7)),
+                ("PAUSE-loop exiting", procbased2_allowed & (1 << 10)),
+                ("Page-modification logging", procbased2_allowed & (1 << 17)),
+                ("VMCS shadowing", procbased2_allowed & (1 << 14)),
+                ("TSC scaling", procbased2_allowed & (1 << 25)),
+            ]:
+                acceleration.append((feature, bool(available)))
+
+    if not vmx_supported and not svm_supported:
+        click.echo("Hardware virtualization (VMX/SVM) is not exposed on this CPU.")
+        return
+
+    if acceleration:
+        click.echo("Acceleration features available to a hypervisor on this host:")
+        for feature, available in acceleration:
+            if available:
+                click.echo(click.style(f"  [+] {feature}", fg='green', bold=True))
+            else:
+                click.echo(click.style(f"  [-] {feature}", fg='red'))
+        click.echo()
+
+def save_snapshot_to_file():
     click.clear()
 
     if DEBUG.upper() == "TRUE":
@@ -1812,19 +5727,97 @@ def dump_cpu_register_table():
 
     compile_and_load_cpuid()
 
-    generate_raw_table()
+    default_path = f"{platform.node() or 'host'}.cpuid.json"
+    path = click.prompt("Enter the snapshot file to write", default=default_path, type=str)
+    per_cpu = click.confirm("Capture every CPU as well", default=False)
 
-def dump_cpu_register_table():
+    snapshot = capture_cpuid_snapshot(per_cpu)
+    try:
+        save_cpuid_snapshot(path, snapshot)
+    except OSError as e:
+        click.echo(f"Error: unable to write snapshot '{path}': {e}")
+        return
+
+    click.echo(f"Saved {len(snapshot['leaves'])} leaves from {snapshot['vendor']} to {path}")
+    if "cpus" in snapshot:
+        click.echo(f"Included per-CPU leaves for {len(snapshot['cpus'])} CPU(s)")
+
+def inspect_hypervisor_feature_gap():
     click.clear()
 
     if DEBUG.upper() == "TRUE":
         click.echo("If you see this message, you're in DEBUG mode...")
 
-    compile_and_load_cpuid()
+    host_path = click.prompt("Enter the host snapshot file", type=str).strip()
+    guest_path = click.prompt("Enter the guest snapshot file (leave blank to use this machine)", default="", show_default=False).strip()
 
-    generate_raw_table()
+    try:
+        host = load_cpuid_snapshot(host_path)
+        if guest_path:
+            guest = load_cpuid_snapshot(guest_path)
+        else:
+            compile_and_load_cpuid()
+            guest = snapshot_registers(capture_cpuid_snapshot())
+    except (OSError, ValueError, KeyError) as e:
+        click.echo(f"Error: unable to load snapshot: {e}")
+        return
+    click.echo()
 
-def dump_cpu_ascii():
+    masked = []
+    unexpected = []
+    for feature, leaf, subleaf, register, bit, impact, qemu_name in passthrough_feature_list:
+        on_host = snapshot_feature_bit(host, leaf, subleaf, register, bit)
+        in_guest = snapshot_feature_bit(guest, leaf, subleaf, register, bit)
+        if on_host and not in_guest:
+            masked.append((impact, feature, leaf, subleaf, register, bit, qemu_name))
+        elif in_guest and not on_host:
+            unexpected.append(feature)
+
+    if unexpected:
+        click.echo(click.style("Warning: the guest reports features the host lacks, the snapshots may come from different machines:", fg='yellow'))
+        for feature in unexpected:
+            click.echo(f"  {feature}")
+        click.echo()
+
+    if not masked:
+        click.echo(click.style("No performance relevant host features are masked by the hypervisor.", fg='green', bold=True))
+        return
+
+    masked.sort(key=lambda entry: (-entry[0], entry[1]))
+
+    click.echo(f"Features masked by the hypervisor ({len(masked)}), ranked by likely performance impact:")
+    click.echo("{:<8} {:<46} {:<22}".format("Impact", "Feature", "Location"))
+    click.echo("-" * 76)
+    for impact, feature, leaf, subleaf, register, bit, qemu_name in masked:
+        color = 'red' if impact >= 8 else 'yellow' if impact >= 5 else 'white'
+        location = f"{leaf:08X}.{subleaf:02X} {register.upper()}[{bit}]"
+        click.echo(click.style("{:<8} {:<46} {:<22}".format(impact, feature, location), fg=color))
+    click.echo()
+
+    # QEMU command line and libvirt domain XML
+    click.echo("QEMU configuration (append to the guest CPU model, or use -cpu host to pass the whole host CPU through):")
+    click.echo("  -cpu <model>," + ",".join(f"+{entry[6]}" for entry in masked))
+    click.echo()
+    click.echo("libvirt domain XML:")
+    click.echo("  <cpu mode='host-model' check='partial'>")
+    for entry in masked:
+        click.echo(f"    <feature policy='require' name='{entry[6]}'/>")
+    click.echo("  </cpu>")
+    click.echo()
+
+    # VMware .vmx masks use one character per bit from bit 31 down to bit 0, H passes the host value through
+    click.echo("VMware .vmx configuration:")
+    vmware_masks = {}
+    for impact, feature, leaf, subleaf, register, bit, qemu_name in masked:
+        mask = vmware_masks.setdefault((leaf, subleaf, register), ['-'] * 32)
+        mask[31 - bit] = 'H'
+    for (leaf, subleaf, register), mask in sorted(vmware_masks.items()):
+        suffix = f".{subleaf}" if subleaf else ""
+        mask_str = ":".join("".join(mask[i:i + 4]) for i in range(0, 32, 4))
+        click.echo(f'  cpuid.{leaf:X}{suffix}.{register} = "{mask_str}"')
+    click.echo()
+
+def inspect_timer_latency():
     click.clear()
 
     if DEBUG.upper() == "TRUE":
@@ -1832,9 +5825,249 @@ def dump_cpu_ascii():
 
     compile_and_load_cpuid()
 
-    process_leaves_ascii()
+    vendor = get_cpu_vendor()
+    max_basic_leaf, _, _, _ = call_cpuid(0, 0)
+    max_extended_leaf, _, _, _ = call_cpuid(0x80000000, 0)
+    _, _, leaf1_ecx, leaf1_edx = call_cpuid(1, 0)
+    leaf6_eax = call_cpuid(6, 0)[0] if max_basic_leaf >= 6 else 0
+    leaf7_ebx = call_cpuid(7, 0)[1] if max_basic_leaf >= 7 else 0
+    ext1_edx = call_cpuid(0x80000001, 0)[3] if max_extended_leaf >= 0x80000001 else 0
+    ext7_edx = call_cpuid(0x80000007, 0)[3] if max_extended_leaf >= 0x80000007 else 0
+
+    capabilities = [
+        ("Time stamp counter (TSC)",            "Leaf 1 EDX[4]",           leaf1_edx & (1 << 4)),
+        ("APIC on chip",                        "Leaf 1 EDX[9]",           leaf1_edx & (1 << 9)),
+        ("x2APIC",                              "Leaf 1 ECX[21]",          leaf1_ecx & (1 << 21)),
+        ("TSC deadline timer (TSC-DEADLINE)",   "Leaf 1 ECX[24]",          leaf1_ecx & (1 << 24)),
+        ("Always running APIC timer (ARAT)",    "Leaf 6 EAX[2]",           leaf6_eax & (1 << 2)),
+        ("Invariant TSC",                       "Leaf 0x80000007 EDX[8]",  ext7_edx & (1 << 8)),
+        ("IA32_TSC_ADJUST MSR",                 "Leaf 7 EBX[1]",           leaf7_ebx & (1 << 1)),
+        ("RDTSCP",                              "Leaf 0x80000001 EDX[27]", ext1_edx & (1 << 27)),
+        ("Hypervisor present",                  "Leaf 1 ECX[31]",          leaf1_ecx & (1 << 31)),
+    ]
+
+    click.echo("Timer and Interrupt Capabilities:")
+    click.echo("{:<38} {:<26} {:<10}".format("Feature", "Location", "Status"))
+    click.echo("-" * 74)
+    for feature, location, supported in capabilities:
+        status = click.style("Yes", fg='green', bold=True) if supported else click.style("No", fg='red')
+        click.echo("{:<38} {:<26} {}".format(feature, location, status))
+    click.echo()
 
-def check_avx2_support():
+    if max_basic_leaf >= 0x15:
+        denominator, numerator, crystal_hz, _ = call_cpuid(0x15, 0)
+        if denominator and numerator:
+            click.echo(f"TSC/Crystal Ratio (Leaf 0x15): {numerator}/{denominator}")
+            if crystal_hz:
+                click.echo(f"Nominal TSC Frequency: {crystal_hz * numerator / denominator / 1e6:.2f} MHz")
+            click.echo()
+
+    if vendor == "GenuineIntel" and max_basic_leaf >= 6:
+        print_bit_list("Intel CPUID Leaf 6, Sub-leaf 0 EAX Bits:", leaf6_eax, feature_bits("intel", 0x00000006, 0, "eax"))
+
+    if get_host_os() != "Linux":
+        click.echo("The wake-up latency probe requires Linux (clock_nanosleep and CPU affinity).")
+        return
+
+    click.echo(f"Kernel clocksource: {read_sysfs_value('/sys/devices/system/clocksource/clocksource0/current_clocksource')}")
+    click.echo(f"Kernel clockevent device: {read_sysfs_value('/sys/devices/system/clockevents/clockevent0/current_device')}")
+    click.echo()
+
+    allowed_cpus = sorted(os.sched_getaffinity(0))
+    cpu_input = click.prompt("Enter the CPUs to probe (e.g. 0-3,8, leave blank for all allowed CPUs)", default="", show_default=False).strip()
+    try:
+        cpus = [cpu for cpu in parse_cpu_list(cpu_input) if cpu in allowed_cpus] if cpu_input else allowed_cpus
+    except ValueError:
+        click.echo(f"Error: '{cpu_input}' is not a valid CPU list.")
+        return
+    if not cpus:
+        click.echo("Error: none of the requested CPUs are available to this process.")
+        return
+
+    loops = click.prompt("Enter the number of wake-ups per CPU", default=1000, type=int)
+    interval_us = click.prompt("Enter the wake-up interval in microseconds", default=1000, type=int)
+    if loops <= 0 or interval_us <= 0:
+        click.echo("Error: the number of wake-ups and the interval must be positive.")
+        return
+
+    timer_lib = compile_and_load_native("timer_probe", timer_probe_cdef, timer_probe_c_code)
+    if timer_lib is None:
+        click.echo("Error: unable to compile the timer latency probe.")
+        return
+
+    buckets = 1000
+    ncpus = len(cpus)
+    histograms = ffi_new("uint64_t[]", ncpus * buckets)
+    min_ns = ffi_new("int64_t[]", ncpus)
+    max_ns = ffi_new("int64_t[]", ncpus)
+    avg_ns = ffi_new("double[]", ncpus)
+    fifo_granted = ffi_new("int[]", ncpus)
+
+    click.echo(f"\nProbing {ncpus} CPU(s), {loops} wake-ups every {interval_us} us, this takes about {loops * interval_us / 1e6:.1f} seconds...\n")
+    with EnergyMeter() as meter:
+        timer_lib.timer_latency_probe(ncpus, ffi_new("int[]", cpus), loops, interval_us, 1, buckets,
+                                      histograms, min_ns, max_ns, avg_ns, fifo_granted)
+        count_benchmark_ops(ncpus * loops, "timer wake-ups")
+
+    # Collapse the 1 us histogram into power of two bins so each CPU fits on one row
+    bin_edges = [1, 2, 4, 8, 16, 32, 64, 128, 256, 512]
+    bin_labels = [f"<{edge}" for edge in bin_edges] + [">=512"]
+
+    click.echo("Wake-up latency per CPU (us), histogram columns count wake-ups per latency bin:")
+    header = "{:<5} {:>8} {:>8} {:>8} {:>8}  ".format("CPU", "Min", "Avg", "P99", "Max")
+    click.echo(header + " ".join(f"{label:>6}" for label in bin_labels))
+    click.echo("-" * (len(header) + 7 * len(bin_labels)))
+
+    worst_cpu = None
+    for i, cpu in enumerate(cpus):
+        if min_ns[i] < 0:
+            click.echo("{:<5} {}".format(cpu, click.style("probe failed (unable to pin thread)", fg='red')))
+            continue
+
+        counts = [histograms[i * buckets + b] for b in range(buckets)]
+        total = sum(counts)
+        p99_target = total * 0.99
+        running = 0
+        p99 = buckets
+        for bucket, count in enumerate(counts):
+            running += count
+            if running >= p99_target:
+                p99 = bucket + 1
+                break
+
+        bins = [0] * len(bin_labels)
+        for bucket, count in enumerate(counts):
+            if count:
+                index = next((n for n, edge in enumerate(bin_edges) if bucket < edge), len(bin_edges))
+                bins[index] += count
+
+        max_us = max_ns[i] / 1000
+        color = 'red' if max_us >= 100 else 'yellow' if max_us >= 20 else 'green'
+        row = "{:<5} {:>8.1f} {:>8.1f} {:>8} {:>8.1f}  ".format(cpu, min_ns[i] / 1000, avg_ns[i] / 1000, f"<{p99}", max_us)
+        click.echo(click.style(row, fg=color) + " ".join(f"{count:>6}" for count in bins))
+
+        if worst_cpu is None or max_ns[i] > worst_cpu[1]:
+            worst_cpu = (cpu, max_ns[i])
+    click.echo()
+
+    if worst_cpu is not None:
+        click.echo(f"Worst wake-up latency: {worst_cpu[1] / 1000:.1f} us on CPU {worst_cpu[0]}")
+    if not all(fifo_granted[i] for i in range(ncpus)):
+        click.echo(click.style("SCHED_FIFO was not permitted, results include normal scheduler noise. Run as root for real-time priority.", fg='yellow'))
+    if not leaf1_ecx & (1 << 24):
+        click.echo("No TSC-deadline timer: the kernel programs the APIC count-down timer, expect extra jitter per timer arm.")
+    if not leaf6_eax & (1 << 2):
+        click.echo("No ARAT: the APIC timer stops in deep C-states and wake-ups go through a broadcast timer.")
+    if not ext7_edx & (1 << 8):
+        click.echo("No invariant TSC: the kernel may avoid the TSC clocksource, making timestamps slower to read.")
+    click.echo()
+    meter.report()
+
+def cpu_signature():
+    """Returns (vendor key, display family, display model, stepping) decoded from leaf 0 and leaf 1 EAX."""
+    eax = call_cpuid(1, 0)[0]
+    family = (eax >> 8) & 0xF
+    model = (eax >> 4) & 0xF
+    if family == 0xF:
+        family += (eax >> 20) & 0xFF
+    if family in (0x6, 0xF) or family > 0xF:
+        model |= ((eax >> 16) & 0xF) << 4
+    return schema_vendor(get_cpu_vendor()), family, model, eax & 0xF
+
+def identify_uarch(vendor, family, model):
+    """Returns (microarchitecture, timing reference) for a family/model, or None when the model is unknown."""
+    for entry_vendor, entry_family, first_model, last_model, name, reference in uarch_model_list:
+        if entry_vendor == vendor and entry_family == family and first_model <= model <= last_model:
+            return name, reference
+    return None
+
+def measure_uarch_fingerprint(lib, repeats=9):
+    """
+    Runs the timing probes and returns the measured core parameters keyed like uarch_timing_list.
+
+    Every probe run is paired with a dependent ADD chain run right before it, one core cycle per ADD, so
+    results are in core cycles whatever the turbo, TSC or host frequency at the time. Probes are short and
+    repeated, the median pair is kept so runs interrupted by the scheduler or the hypervisor drop out.
+    """
+    def cycles(probe, *args):
+        ratios = sorted(probe(*args) / lib.uarch_add_latency(20000) for _ in range(repeats))
+        return ratios[len(ratios) // 2]
+
+    cycle_ns = min(lib.uarch_add_latency(20000) for _ in range(repeats))
+    if cycle_ns <= 0:
+        return None
+
+    cache_sizes_kb = [8, 16, 24, 32, 40, 48, 64, 80, 96, 128, 192, 256, 384, 512, 640, 768, 1024, 1280, 1536, 2048, 2560, 3072, 4096, 8192]
+    cache_latency = {size_kb: cycles(lib.uarch_pointer_chase, size_kb * 1024, 0, 200000) for size_kb in cache_sizes_kb}
+    tlb_pages = [16, 32, 48, 64, 72, 80, 96, 128, 192, 256]
+    tlb_latency = {pages: cycles(lib.uarch_pointer_chase, pages * 4096, 1, 200000) for pages in tlb_pages}
+
+    # A cyclic chase misses on every load once it outgrows a level, so a level ends at the size before the step
+    def last_before_step(latencies, limit):
+        sizes = list(latencies)
+        step = next((index for index, size in enumerate(sizes) if index and latencies[size] > limit), len(sizes))
+        return sizes[step - 1]
+
+    l1_latency = min(cache_latency[8], cache_latency[16])
+    l1_kb = last_before_step({size_kb: value for size_kb, value in cache_latency.items() if size_kb <= 128}, l1_latency * 2)
+    l2_latency = min(value for size_kb, value in cache_latency.items() if l1_kb * 2 <= size_kb <= l1_kb * 4)
+    l2_kb = last_before_step({size_kb: value for size_kb, value in cache_latency.items() if size_kb > l1_kb}, l2_latency * 2)
+    dtlb_entries = last_before_step(tlb_latency, tlb_latency[16] * 1.5)
+
+    return {
+        "cycle_ns": cycle_ns,
+        "l1d_kb": l1_kb,
+        "l1_latency": l1_latency,
+        "l2_kb": l2_kb,
+        "l2_latency": l2_latency,
+        "pause": cycles(lib.uarch_pause_latency, 1000),
+        "loads_per_cycle": 1 / cycles(lib.uarch_load_throughput, 20000),
+        "alus_per_cycle": 1 / cycles(lib.uarch_add_throughput, 20000),
+        "dtlb_entries": dtlb_entries,
+        "cache_latency": cache_latency,
+        "tlb_latency": tlb_latency,
+    }
+
+# Metrics compared by match_uarch_fingerprint as (key, tolerance, compare on a log2 scale)
+uarch_fingerprint_metrics = [
+    ("l1d_kb",          0.3, True),
+    ("l1_latency",      0.6, False),
+    ("l2_kb",           0.4, True),
+    ("l2_latency",      2.0, False),
+    ("pause",           1.0, True),
+    ("loads_per_cycle", 0.4, False),
+    ("alus_per_cycle",  0.5, False),
+    ("dtlb_entries",    0.35, True),
+]
+
+def match_uarch_fingerprint(measured):
+    """
+    Scores every timing reference against the measured parameters.
+
+    Each metric contributes its distance in tolerances, squared. References without a figure for some
+    metric are scored on the mean of the others, scaled back to the full metric count. The fit of a
+    reference is exp(-distance / 2), and the confidence of a match is its share of the total fit.
+
+    Returns:
+        list: (reference, fit, confidence) tuples, best match first.
+    """
+    fits = []
+    for reference, *values in uarch_timing_list:
+        distance = 0.0
+        compared = 0
+        for (key, tolerance, logarithmic), expected in zip(uarch_fingerprint_metrics, values):
+            if expected is None or measured.get(key) is None or measured[key] <= 0:
+                continue
+            actual = measured[key]
+            delta = math.log2(actual / expected) if logarithmic else actual - expected
+            distance += (delta / tolerance) ** 2
+            compared += 1
+        fits.append((reference, math.exp(-distance / compared * len(uarch_fingerprint_metrics) / 2) if compared else 0.0))
+
+    total = sum(fit for _, fit in fits) or 1.0
+    return sorted(((reference, fit, fit / total) for reference, fit in fits), key=lambda match: -match[1])
+
+def inspect_uarch_fingerprint():
     click.clear()
 
     if DEBUG.upper() == "TRUE":
@@ -1842,716 +6075,2027 @@ def check_avx2_support():
 
     compile_and_load_cpuid()
 
-    click.echo("This is a proof of concept entry.")
-    print()
+    vendor, family, model, stepping = cpu_signature()
+    reported = identify_uarch(vendor, family, model)
+    hypervisor = bool(call_cpuid(1, 0)[2] & (1 << 31))
 
-    # Query CPUID leaf 7, subleaf 0 to check AVX2 support
-    eax, ebx, ecx, edx = call_cpuid(7, 0)
-    if DEBUG.upper() == "TRUE":
-        print("call_cpuid function returned:")
-        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+    click.echo("Microarchitecture Fingerprint:")
+    click.echo(f"CPUID signature: {get_cpu_vendor()} family 0x{family:X} model 0x{model:X} stepping 0x{stepping:X}")
+    click.echo(f"CPUID reports: {reported[0] if reported else 'unknown model'}{' (under a hypervisor)' if hypervisor else ''}")
+    click.echo()
 
-    # Print EBX in hexadecimal format
-    if DEBUG.upper() == "TRUE":
-        print(f"Leaf 7 sub-leaf 0 Registers...")
-        print(f"EAX: 0x{eax:08X}")
-        print(f"EBX: 0x{ebx:08X}")
-        print(f"ECX: 0x{ecx:08X}")
-        print(f"EDX: 0x{edx:08X}")
-        print()
-        
-    avx2_bit = ebx & (1 << 5)  # AVX2 bit is 5th bit in EBX (zero-indexed)
+    if platform.machine().lower() not in ("x86_64", "amd64") or get_host_os() != "Linux":
+        click.echo("The timing probes require Linux on x86-64.")
+        return
+
+    uarch_lib = compile_and_load_native("uarch_probe", uarch_probe_cdef, uarch_probe_c_code)
+    if uarch_lib is None:
+        click.echo("Error: unable to compile the timing probes.")
+        return
+
+    # Pin to one CPU so every probe runs on the same core, hybrid parts mix core types otherwise
+    original_affinity = os.sched_getaffinity(0)
+    os.sched_setaffinity(0, {min(original_affinity)})
+    click.echo("Running timing probes, this takes a few seconds...\n")
+    try:
+        with EnergyMeter() as meter:
+            measured = measure_uarch_fingerprint(uarch_lib)
+    finally:
+        os.sched_setaffinity(0, original_affinity)
+    if measured is None:
+        click.echo("Error: the timing probes did not run.")
+        return
 
-    # Print EBX in 32-bit binary format with AVX2 bit highlighted
-    ebx_binary = f"{ebx:032b}"
-    avx2_bit_index = 31 - 5  # AVX2 bit is 5th from the right (zero-indexed)
-    colored_ebx_binary = (
-        ebx_binary[:avx2_bit_index]
-        + click.style(ebx_binary[avx2_bit_index], fg='green', bold=True)
-        + ebx_binary[avx2_bit_index + 1:]
-    )
-    click.echo(f"EBX in binary: {colored_ebx_binary}")
-    print()
+    click.echo(f"Core clock (from a dependent ADD chain): {1 / measured['cycle_ns']:.2f} GHz")
+    click.echo("{:<26} {:>12}".format("Parameter", "Measured"))
+    click.echo("-" * 39)
+    click.echo("{:<26} {:>9} KB".format("L1D size", measured["l1d_kb"]))
+    click.echo("{:<26} {:>9.1f} cy".format("L1D load-to-use latency", measured["l1_latency"]))
+    click.echo("{:<26} {:>9} KB".format("L2 size", measured["l2_kb"]))
+    click.echo("{:<26} {:>9.1f} cy".format("L2 load-to-use latency", measured["l2_latency"]))
+    click.echo("{:<26} {:>9.1f} cy".format("PAUSE latency", measured["pause"]))
+    click.echo("{:<26} {:>12.2f}".format("Loads per cycle", measured["loads_per_cycle"]))
+    click.echo("{:<26} {:>12.2f}".format("Integer ALU ops per cycle", measured["alus_per_cycle"]))
+    click.echo("{:<26} {:>12}".format("L1 DTLB entries (4 KB)", measured["dtlb_entries"]))
+    click.echo()
 
-    if avx2_bit:
-        click.echo("AVX2 is supported on this CPU.")
+    click.echo("Closest timing references:")
+    click.echo("{:<40} {:>6} {:>11}".format("Reference", "Fit", "Confidence"))
+    click.echo("-" * 59)
+    matches = match_uarch_fingerprint(measured)
+    for reference, fit, confidence in matches[:5]:
+        click.echo("{:<40} {:>6.2f} {:>10.0f}%".format(reference, fit, confidence * 100))
+    click.echo()
+
+    best, best_fit, best_confidence = matches[0]
+    reported_fit = next((fit for reference, fit, _ in matches if reported and reference == reported[1]), 0.0)
+    if best_fit < 0.05:
+        click.echo(click.style("No reference fits well, this core is likely missing from the timing table.", fg='yellow'))
+    elif reported and reported[1] == best:
+        click.echo(click.style(f"Timing agrees with CPUID: {reported[0]} ({best}), {best_confidence * 100:.0f}% confidence.", fg='green'))
+    elif reported and reported_fit >= best_fit / 2:
+        click.echo(click.style(f"Timing is consistent with CPUID ({reported[0]}), the closest reference is {best}.", fg='green'))
+    elif reported:
+        click.echo(click.style(f"Timing suggests {best} ({best_confidence * 100:.0f}% confidence), but CPUID reports {reported[0]}.", fg='yellow'))
+        click.echo("The family/model may be masked or replaced by the hypervisor.")
     else:
-        click.echo("AVX2 is not supported on this CPU.")
-    
-    print()
+        click.echo(f"Inferred microarchitecture: {best}, {best_confidence * 100:.0f}% confidence.")
+    if hypervisor:
+        click.echo("Timings under a hypervisor include steal time and nested paging, rerun if the host is busy.")
+    click.echo()
+    meter.report()
 
-def inspect_leaf1_intel_support():
+def inspect_interference_size():
     click.clear()
 
-    def color_bits(binary_string):
-        """Returns a colored version of the binary string with specific bits highlighted."""
-        colored_bits = ""
-        for i, bit in enumerate(binary_string):
-            # Highlight specific bit in red if it's '0', green if it's '1'
-            if bit == '0':
-                colored_bits += click.style(bit, fg='red')
-            else:
-                colored_bits += click.style(bit, fg='green', bold=True)
-        return colored_bits
-
-    def colored_description(description, bit_value):
-        """Returns a colored version of the description based on the bit value."""
-        if bit_value == '0':
-            return click.style(description, fg='red')
-        else:
-            return click.style(description, fg='green', bold=True)
-
     if DEBUG.upper() == "TRUE":
         click.echo("If you see this message, you're in DEBUG mode...")
 
     compile_and_load_cpuid()
 
-    # Query CPUID leaf 1, subleaf 0
-    eax, ebx, ecx, edx = call_cpuid(1, 0)
-    if DEBUG.upper() == "TRUE":
-        print("call_cpuid function returned:")
-        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+    vendor = schema_vendor(get_cpu_vendor())
+    max_basic_leaf, _, _, _ = call_cpuid(0, 0)
+    max_extended_leaf, _, _, _ = call_cpuid(0x80000000, 0)
+    _, leaf1_ebx, _, leaf1_edx = call_cpuid(1, 0)
+
+    click.echo("Cache Line Sizes:")
+    click.echo("{:<34} {:<24} {:>8}".format("Source", "Location", "Bytes"))
+    click.echo("-" * 68)
+    clflush_bytes = ((leaf1_ebx >> 8) & 0xFF) * 8 if leaf1_edx & (1 << 19) else 0
+    click.echo("{:<34} {:<24} {:>8}".format("CLFLUSH line size", "Leaf 1 EBX[15:8] x 8", clflush_bytes or "n/a"))
+
+    # Deterministic cache parameters, EBX[11:0] is the line size minus 1
+    line_sizes = {}
+    cache_leaf = 0x8000001D if vendor == "amd" else 0x00000004
+    if (cache_leaf == 0x00000004 and max_basic_leaf >= 4) or (cache_leaf == 0x8000001D and max_extended_leaf >= 0x8000001D):
+        for subleaf in range(16):
+            eax, ebx, _, _ = call_cpuid(cache_leaf, subleaf)
+            cache_type = eax & 0x1F
+            if cache_type == 0:
+                break
+            level = (eax >> 5) & 0x7
+            name = f"L{level} {('Data', 'Instruction', 'Unified')[cache_type - 1] if cache_type <= 3 else 'Unknown'}"
+            line_sizes[name] = (ebx & 0xFFF) + 1
+            click.echo("{:<34} {:<24} {:>8}".format(name, f"Leaf 0x{cache_leaf:X}.{subleaf} EBX[11:0]", line_sizes[name]))
+    click.echo()
 
-    # Print in hexadecimal format
-    if DEBUG.upper() == "TRUE":
-        click.echo("Leaf 1 sub-leaf 0 Registers:")
-        click.echo(f"EAX: 0x{eax:08X}")
-        click.echo(f"EBX: 0x{ebx:08X}")
-        click.echo(f"ECX: 0x{ecx:08X}")
-        click.echo(f"EDX: 0x{edx:08X}\n")
+    line_bytes = line_sizes.get("L1 Data") or clflush_bytes or 64
 
-    # Convert ECX and EDX to binary strings
-    eax_binary = f"{eax:032b}"
-    ebx_binary = f"{ebx:032b}"
-    ecx_binary = f"{ecx:032b}"
-    edx_binary = f"{edx:032b}"
+    if get_host_os() != "Linux":
+        click.echo("The false-sharing benchmark requires Linux (CPU affinity).")
+        return
 
-    colored_eax_bits = color_bits(eax_binary)
-    colored_ebx_bits = color_bits(ebx_binary)
-    colored_ecx_bits = color_bits(ecx_binary)
-    colored_edx_bits = color_bits(edx_binary)
+    pairs = pick_cpu_pairs(sorted(os.sched_getaffinity(0)))
+    if not pairs:
+        click.echo("The false-sharing benchmark needs at least two CPUs, reporting the CPUID line size only.")
+        click.echo(f"hardware_destructive_interference_size = {line_bytes}")
+        click.echo(f"hardware_constructive_interference_size = {line_bytes}")
+        return
 
-    # Print EAX in binary format and parse it
-    colored_eax_bits = color_bits(eax_binary)
-    if DEBUG.upper() == "TRUE":
-        click.echo("EAX in binary:")
-        print(colored_eax_bits)
-        print()
+    sharing_lib = compile_and_load_native("false_sharing", false_sharing_cdef, false_sharing_c_code)
+    if sharing_lib is None:
+        click.echo("Error: unable to compile the false-sharing benchmark.")
+        return
 
-    # Step through each bit in eax_binary and list its meaning
-    click.echo("Intel CPUID Leaf 1, Sub-leaf 0 EAX Bits:")
-    for bit_index, description in intel_leaf1_eax_bits:
-        bit_value = eax_binary[31 - bit_index]
-        colored_value = colored_binary_value(eax_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        click.echo(f"{colored_value} - {colored_desc}")
+    # Offsets past the last probed one sit on another page, giving the uncontended rate
+    offsets = list(range(0, 257, 8))
+    baseline_offset = 4096
+    iterations = 2000000
 
-    # Bit Breakdown for Leaf 1 EAX Data
-    click.echo("\nIntel CPUID Leaf 1, Sub-leaf 0 EAX Breakdown:")
-    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Field", "Bit Position", "Value", "Hex"))
-    click.echo("-" * 55)  # Separator line
+    def cost(cpu_a, cpu_b, offset):
+        count_benchmark_ops(2 * 3 * iterations, "counter increments")
+        return min(sharing_lib.false_sharing_probe(cpu_a, cpu_b, offset, iterations) for _ in range(3))
 
-    # Extract each field's value and its corresponding hex
-    stepping_id = eax_binary[28:32]
-    model_number = eax_binary[24:28]
-    family_id = eax_binary[20:24]
-    processor_type = eax_binary[18:20]
-    reserved_secondary = eax_binary[16:18]
-    extended_model_id = eax_binary[12:16]
-    extended_family_id = eax_binary[4:12]
-    reserved = eax_binary[0:4]
+    click.echo("Running the two-thread false-sharing benchmark, one counter per thread...")
+    results = {}
+    meter = EnergyMeter()
+    for distance in ("smt", "core", "llc", "package"):
+        if distance not in pairs:
+            continue
+        cpu_a, cpu_b = pairs[distance]
+        with meter:
+            baseline = cost(cpu_a, cpu_b, baseline_offset)
+            slowdowns = [(offset, cost(cpu_a, cpu_b, offset) / baseline) for offset in offsets] if baseline > 0 else None
+        if slowdowns is None:
+            click.echo(f"Unable to pin the benchmark threads to CPUs {cpu_a} and {cpu_b}.")
+            continue
+        results[distance] = (cpu_a, cpu_b, baseline, slowdowns)
+    click.echo()
 
-    # Display each field's breakdown
-    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Stepping ID", "0-3", f"{int(stepping_id, 2):04b}", f"{int(stepping_id, 2):X}"))
-    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Model Number", "4-7", f"{int(model_number, 2):04b}", f"{int(model_number, 2):X}"))
-    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Family ID", "8-11", f"{int(family_id, 2):04b}", f"{int(family_id, 2):X}"))
-    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Processor Type", "12-13", f"{int(processor_type, 2):02b}", f"{int(processor_type, 2):X}"))
-    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Reserved", "14-15", f"{int(reserved_secondary, 2):02b}", f"{int(reserved_secondary, 2):X}"))
-    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Extended Model ID", "16-19", f"{int(extended_model_id, 2):04b}", f"{int(extended_model_id, 2):X}"))
-    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Extended Family ID", "20-27", f"{int(extended_family_id, 2):08b}", f"{int(extended_family_id, 2):X}"))
-    click.echo("{:<20} {:<15} {:<10} {:<5}".format("Reserved", "28-31", f"{int(reserved, 2):04b}", f"{int(reserved, 2):X}"))
+    labels = {"smt": "SMT siblings", "core": "Same LLC", "llc": "Other LLC", "package": "Other package"}
+    click.echo("Slowdown against counters a page apart, per byte offset between the two counters:")
+    click.echo("{:>12}  ".format("Offset") + " ".join("{:>14}".format(labels[distance]) for distance in results))
+    click.echo("-" * (14 + 15 * len(results)))
+    for index, offset in enumerate(offsets):
+        cells = []
+        for distance, (_, _, _, slowdowns) in results.items():
+            slowdown = slowdowns[index][1]
+            color = 'red' if slowdown >= 2 else 'yellow' if slowdown >= 1.2 else None
+            cells.append(click.style("{:>13.2f}x".format(slowdown), fg=color) if color else "{:>13.2f}x".format(slowdown))
+        click.echo("{:>12}  ".format(offset if offset else "same counter") + " ".join(cells))
+    click.echo("The same counter row is true sharing, both threads increment one counter atomically.")
+    click.echo()
 
-    # Function to highlight the bits in green for visualization
-    def highlight_bits(eax_binary, start, end):
-        return (
-            eax_binary[:start] + 
-            click.style(eax_binary[start:end], fg='green') + 
-            eax_binary[end:]
-        )
+    # Destructive size: the smallest offset from which every larger offset runs at the uncontended rate,
+    # the same counter row is true sharing and says nothing about it
+    destructive = line_bytes
+    for distance, (cpu_a, cpu_b, _, slowdowns) in results.items():
+        contended = [offset for offset, slowdown in slowdowns if offset and slowdown >= 1.2]
+        if contended:
+            needed = contended[-1] + 8
+            needed = 1 << (needed - 1).bit_length()
+            click.echo(f"{labels[distance]} (CPUs {cpu_a}, {cpu_b}): counters interfere up to {contended[-1]} bytes apart")
+            destructive = max(destructive, needed)
+        else:
+            click.echo(f"{labels[distance]} (CPUs {cpu_a}, {cpu_b}): no measurable interference")
+    click.echo()
 
-    # New section for debugging visualization
-    if DEBUG.upper() == "TRUE":
-        click.echo()
-        click.echo("Bit Range:")
-        click.echo(highlight_bits(eax_binary, 28, 32))  # Stepping ID
-        click.echo(highlight_bits(eax_binary, 24, 28))  # Model Number
-        click.echo(highlight_bits(eax_binary, 20, 24))  # Family ID
-        click.echo(highlight_bits(eax_binary, 18, 20))  # Processor Type
-        click.echo(highlight_bits(eax_binary, 16, 18))  # Reserved Secondary
-        click.echo(highlight_bits(eax_binary, 12, 16))  # Extended Model ID
-        click.echo(highlight_bits(eax_binary, 4, 12))   # Extended Family ID
-        click.echo(highlight_bits(eax_binary, 0, 4))    # Reserved
+    click.echo(f"hardware_destructive_interference_size = {destructive}")
+    click.echo(f"hardware_constructive_interference_size = {line_bytes}")
+    if destructive > line_bytes:
+        click.echo(click.style(f"Pad independently written data to {destructive} bytes, the adjacent line prefetcher pulls "
+                               f"{destructive // line_bytes} lines at a time.", fg='yellow'))
+    else:
+        click.echo(f"Padding to one {line_bytes} byte line is enough on this host.")
+    click.echo("Keep data read together within one constructive size so a single line fill brings all of it.")
+    click.echo()
+    meter.report()
 
-    click.echo()  # Add a newline for cleaner output
+def inspect_denormal_cost():
+    click.clear()
 
-# Print EBX in binary format
     if DEBUG.upper() == "TRUE":
-        click.echo("EBX in binary:")
-        print(colored_ebx_bits)
-        print()
+        click.echo("If you see this message, you're in DEBUG mode...")
 
-    # Step through each bit in ecx_binary and list its meaning
-    click.echo("Intel CPUID Leaf 1, Sub-leaf 0 EBX Bits:")
-    for bit_index, description in intel_leaf1_ebx_bits:
-        bit_value = ebx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        #click.echo(f"Value: {colored_value} - {description}")
-        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
-        click.echo(f"{colored_value} - {colored_desc}")
+    compile_and_load_cpuid()
 
-    click.echo()  # Add a newline for cleaner output
-    
-    # Print ECX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("ECX in binary:")
-        print(colored_ecx_bits)
-        print()
+    _, _, leaf1_ecx, leaf1_edx = call_cpuid(1, 0)
+    click.echo("Floating Point Control Capabilities:")
+    click.echo("{:<38} {:<26} {:<10}".format("Feature", "Location", "Status"))
+    click.echo("-" * 74)
+    for feature, location, supported in (
+        ("FXSAVE/FXRSTOR (FXSR)", "Leaf 1 EDX[24]", leaf1_edx & (1 << 24)),
+        ("SSE (MXCSR, FTZ)",      "Leaf 1 EDX[25]", leaf1_edx & (1 << 25)),
+        ("SSE2",                  "Leaf 1 EDX[26]", leaf1_edx & (1 << 26)),
+        ("AVX",                   "Leaf 1 ECX[28]", leaf1_ecx & (1 << 28)),
+    ):
+        status = click.style("Yes", fg='green', bold=True) if supported else click.style("No", fg='red')
+        click.echo("{:<38} {:<26} {}".format(feature, location, status))
+    click.echo()
 
-    # Step through each bit in ecx_binary and list its meaning
-    click.echo("Intel CPUID Leaf 1, Sub-leaf 0 ECX Bits:")
-    for bit_index, description in intel_leaf1_ecx_bits:
-        bit_value = ecx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        #click.echo(f"Value: {colored_value} - {description}")
-        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
-        click.echo(f"{colored_value} - {colored_desc}")
+    if platform.machine().lower() not in ("x86_64", "amd64") or get_host_os() != "Linux":
+        click.echo("The MXCSR_MASK check and the denormal benchmark require Linux on x86-64.")
+        return
 
-    click.echo()  # Add a newline for cleaner output
+    denormal_lib = compile_and_load_native("denormal_probe", denormal_probe_cdef, denormal_probe_c_code)
+    if denormal_lib is None:
+        click.echo("Error: unable to compile the denormal benchmark.")
+        return
 
-    # Print EDX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("EDX in binary:")
-        print(colored_edx_bits)
-        print()
+    # CPUID has no DAZ bit, MXCSR_MASK[6] from FXSAVE is the only way to tell, a zero mask means 0xFFBF
+    raw_mask = denormal_lib.denormal_mxcsr_mask()
+    mxcsr_mask = raw_mask or 0xFFBF
+    daz_supported = bool(mxcsr_mask & (1 << 6))
+    click.echo(f"MXCSR_MASK (FXSAVE byte 28): 0x{mxcsr_mask:08X}{' (zero, default mask)' if not raw_mask else ''}")
+    click.echo("Denormals-are-zero (DAZ, MXCSR[6]): " + (click.style("Supported", fg='green', bold=True) if daz_supported else click.style("Not supported", fg='red')))
+    click.echo("Flush-to-zero (FTZ, MXCSR[15]): " + (click.style("Supported", fg='green', bold=True) if leaf1_edx & (1 << 25) else click.style("Not supported", fg='red')))
+    click.echo()
 
-    # Step through each bit in edx_binary and list its meaning
-    click.echo("Intel CPUID Leaf 1, Sub-leaf 0 EDX Bits:")
-    for bit_index, description in intel_leaf1_edx_bits:
-        bit_value = edx_binary[31 - bit_index]
-        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        #click.echo(f"Value: {colored_value} - {description}")
-        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
-        click.echo(f"{colored_value} - {colored_desc}")
+    # MXCSR with every exception masked, plus FTZ and DAZ as requested
+    modes = [("IEEE", 0x1F80), ("FTZ", 0x1F80 | 0x8000)]
+    if daz_supported:
+        modes += [("DAZ", 0x1F80 | 0x40), ("FTZ+DAZ", 0x1F80 | 0x8040)]
+
+    # (case, input, factor): inputs below 1.17549435e-38 are single precision denormals
+    cases = [
+        ("normal",          1.5,     1.25),
+        ("denormal input",  1.0e-39, 1.0e20),
+        ("denormal output", 1.0e-20, 1.0e-20),
+        ("denormal both",   1.0e-39, 0.5),
+    ]
+    add_cases = [
+        ("normal",          1.5,     1.25),
+        ("denormal input",  1.0e-39, 1.0),
+        ("denormal output", 2.0e-38, -1.5e-38),
+        ("denormal both",   1.0e-39, 1.0e-39),
+    ]
+    classes = [(0, "Scalar SSE"), (1, "SSE 128-bit"), (2, "AVX 256-bit"), (3, "AVX-512")]
+    iterations = 200000
+
+    click.echo("Running the denormal benchmark, nanoseconds per instruction (penalty against normal operands)...\n")
+    header = "{:<14} {:<4} {:<16}".format("Class", "Op", "Operands") + "".join("{:>18}".format(name) for name, _ in modes)
+    click.echo(header)
+    click.echo("-" * len(header))
+
+    worst = {}
+    with EnergyMeter() as meter:
+        for isa, class_name in classes:
+            if not denormal_lib.denormal_isa_supported(isa):
+                click.echo("{:<14} {}".format(class_name, "not supported on this CPU or OS"))
+                continue
+            for op, op_name, op_cases in ((0, "mul", cases), (1, "add", add_cases)):
+                baseline = {}
+                for case, value, factor in op_cases:
+                    cells = []
+                    for mode, mxcsr in modes:
+                        ns = min(denormal_lib.denormal_probe(isa, op, value, factor, mxcsr, iterations) for _ in range(3))
+                        count_benchmark_ops(3 * iterations, "FP kernel iterations")
+                        if case == "normal":
+                            baseline[mode] = ns
+                        penalty = ns / baseline[mode] if baseline.get(mode) else 0
+                        if mode == "IEEE" and case != "normal" and penalty > worst.get(class_name, (0, ""))[0]:
+                            worst[class_name] = (penalty, f"{op_name} {case}")
+                        text = "{:>8.2f} ({:>5.1f}x)".format(ns, penalty)
+                        color = 'red' if penalty >= 10 else 'yellow' if penalty >= 2 else None
+                        cells.append(click.style("{:>18}".format(text), fg=color) if color else "{:>18}".format(text))
+                    click.echo("{:<14} {:<4} {:<16}".format(class_name, op_name, case) + "".join(cells))
+    click.echo()
 
-def inspect_leaf7_intel_support():
-    click.clear()
+    for class_name, (penalty, operation) in worst.items():
+        if penalty >= 2:
+            click.echo(click.style(f"{class_name}: up to {penalty:.0f}x slower with denormals ({operation}), set FTZ{'+DAZ' if daz_supported else ''} in hot loops.", fg='yellow'))
+        else:
+            click.echo(f"{class_name}: no significant denormal penalty.")
+    if daz_supported:
+        click.echo("FTZ flushes denormal results, DAZ also treats denormal inputs as zero. Both are per-thread MXCSR bits.")
+    click.echo()
+    meter.report()
 
-    def color_bits(binary_string):
-        """Returns a colored version of the binary string with specific bits highlighted."""
-        colored_bits = ""
-        for i, bit in enumerate(binary_string):
-            # Highlight specific bit in red if it's '0', green if it's '1'
-            if bit == '0':
-                colored_bits += click.style(bit, fg='red')
-            else:
-                colored_bits += click.style(bit, fg='green', bold=True)
-        return colored_bits
+def read_perf_pmu(name):
+    """
+    Reads a perf PMU from /sys/bus/event_source/devices.
 
-    def colored_description(description, bit_value):
-        """Returns a colored version of the description based on the bit value."""
-        if bit_value == '0':
-            return click.style(description, fg='red')
-        else:
-            return click.style(description, fg='green', bold=True)
+    Returns:
+        dict: {"type", "format", "caps"} where format maps each field to (config word, low bit, high bit)
+        and caps maps each capability file to its text, or None when the kernel has no such PMU.
+    """
+    base = f"/sys/bus/event_source/devices/{name}"
+    pmu_type = read_sysfs_value(f"{base}/type", None)
+    if pmu_type is None:
+        return None
+
+    formats = {}
+    caps = {}
+    for directory, target in (("format", formats), ("caps", caps)):
+        try:
+            names = sorted(os.listdir(f"{base}/{directory}"))
+        except OSError:
+            continue
+        for entry in names:
+            target[entry] = read_sysfs_value(f"{base}/{directory}/{entry}", "")
+
+    # Format files read like "config:24-27" or "config:10"
+    for field, text in list(formats.items()):
+        word, _, bits = text.partition(':')
+        low, _, high = bits.partition('-')
+        try:
+            formats[field] = (word, int(low), int(high or low))
+        except ValueError:
+            del formats[field]
+
+    return {"type": int(pmu_type), "format": formats, "caps": caps}
+
+def encode_perf_config(pmu, values):
+    """Packs named format fields into the (config, config1, config2) words, fields the PMU lacks are skipped."""
+    words = {"config": 0, "config1": 0, "config2": 0}
+    for field, value in values.items():
+        if field in pmu["format"]:
+            word, low, high = pmu["format"][field]
+            words[word] |= (value & ((1 << (high - low + 1)) - 1)) << low
+    return words["config"], words["config1"], words["config2"]
+
+def perf_open_error(errno_value):
+    """Explains the errno perf_event_open refused an event with."""
+    reasons = {
+        1:  "EPERM, blocked by perf_event_paranoid, a seccomp filter or missing CAP_PERFMON",
+        2:  "ENOENT, the PMU does not know this event",
+        13: "EACCES, blocked by perf_event_paranoid or missing CAP_PERFMON",
+        16: "EBUSY, the PMU is used by another tracer (or the hypervisor)",
+        19: "ENODEV, the PMU is not available on this CPU",
+        22: "EINVAL, the PMU rejected the configuration",
+        38: "ENOSYS, perf_event_open is not available",
+        95: "EOPNOTSUPP, the PMU does not support this mode",
+    }
+    return reasons.get(errno_value, f"errno {errno_value}")
+
+def print_register_fields(title, vendor, leaf, subleaf, register, value):
+    """Prints the multi-bit fields of a register from the feature database with their values."""
+    handle = feature_database.registers(vendor, leaf, subleaf).get(register)
+    if handle is None:
+        return
+    click.echo(title)
+    for lsb, width, mnemonic, name in feature_database.fields(handle):
+        if width > 1:
+            field = (value >> lsb) & ((1 << width) - 1)
+            click.echo(f"  {name}: {field} (0x{field:X})")
+    click.echo()
+
+def inspect_processor_trace():
+    click.clear()
 
     if DEBUG.upper() == "TRUE":
         click.echo("If you see this message, you're in DEBUG mode...")
 
     compile_and_load_cpuid()
 
-    # Query CPUID leaf 7, subleaf 0
-    eax, ebx, ecx, edx = call_cpuid(7, 0)
-    if DEBUG.upper() == "TRUE":
-        print("call_cpuid function returned:")
-        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+    max_basic_leaf, _, _, _ = call_cpuid(0, 0)
+    leaf7_ebx = call_cpuid(7, 0)[1] if max_basic_leaf >= 7 else 0
+    hypervisor = bool(call_cpuid(1, 0)[2] & (1 << 31))
 
-    # Print EBX in hexadecimal format
-    if DEBUG.upper() == "TRUE":
-        click.echo("Leaf 7 sub-leaf 0 Registers:")
-        click.echo(f"EAX: 0x{eax:08X}")
-        click.echo(f"EBX: 0x{ebx:08X}")
-        click.echo(f"ECX: 0x{ecx:08X}")
-        click.echo(f"EDX: 0x{edx:08X}\n")
+    click.echo("Intel Processor Trace (Leaf 7 EBX[25]): " + (click.style("Supported", fg='green', bold=True) if leaf7_ebx & (1 << 25) else click.style("Not supported", fg='red')))
+    click.echo()
 
-    # Convert EBX to binary string
-    ebx_binary = f"{ebx:032b}"
-    ecx_binary = f"{ecx:032b}"
-    edx_binary = f"{edx:032b}"
+    caps = {}
+    if leaf7_ebx & (1 << 25) and max_basic_leaf >= 0x14:
+        max_subleaf, ebx, ecx, _ = call_cpuid(0x14, 0)
+        print_bit_list("Intel CPUID Leaf 14, Sub-leaf 0 EBX Bits:", ebx, feature_bits("intel", 0x00000014, 0, "ebx"))
+        print_bit_list("Intel CPUID Leaf 14, Sub-leaf 0 ECX Bits:", ecx, feature_bits("intel", 0x00000014, 0, "ecx"))
+
+        sub1_eax, sub1_ebx = call_cpuid(0x14, 1)[:2] if max_subleaf >= 1 else (0, 0)
+        if max_subleaf >= 1:
+            print_register_fields("Intel CPUID Leaf 14, Sub-leaf 1 EAX:", "intel", 0x00000014, 1, "eax", sub1_eax)
+            print_register_fields("Intel CPUID Leaf 14, Sub-leaf 1 EBX:", "intel", 0x00000014, 1, "ebx", sub1_ebx)
+
+        def encodings(bitmap):
+            return ", ".join(str(bit) for bit in range(16) if bitmap & (1 << bit)) or "none"
+
+        caps = {
+            "cr3_filter": bool(ebx & (1 << 0)),
+            "psb_cyc": bool(ebx & (1 << 1)),
+            "ip_filter": bool(ebx & (1 << 2)),
+            "mtc": bool(ebx & (1 << 3)),
+            "ptwrite": bool(ebx & (1 << 4)),
+            "power_event": bool(ebx & (1 << 5)),
+            "topa": bool(ecx & (1 << 0)),
+            "topa_multi": bool(ecx & (1 << 1)),
+            "single_range": bool(ecx & (1 << 2)),
+            "address_ranges": sub1_eax & 0x7,
+            "psb_periods": sub1_ebx >> 16,
+        }
+        click.echo("Processor Trace Summary:")
+        click.echo(f"  Address ranges for IP filtering and TraceStop: {caps['address_ranges']}")
+        click.echo(f"  MTC period encodings: {encodings(sub1_eax >> 16) if caps['mtc'] else 'n/a'}")
+        click.echo(f"  Cycle threshold encodings: {encodings(sub1_ebx & 0xFFFF) if caps['psb_cyc'] else 'n/a'}")
+        click.echo(f"  PSB frequency encodings (2K << n bytes): {encodings(caps['psb_periods']) if caps['psb_cyc'] else 'n/a'}")
+        output = [name for name, present in (("ToPA (multi-entry)" if caps["topa_multi"] else "ToPA", caps["topa"]),
+                                             ("single range", caps["single_range"])) if present]
+        click.echo(f"  Output schemes: {', '.join(output) or 'none'}")
+        click.echo()
+    elif hypervisor:
+        click.echo("Leaf 7 does not report Processor Trace, the hypervisor hides it from this guest.")
+        click.echo()
 
-    colored_ebx_bits = color_bits(ebx_binary)
-    colored_ecx_bits = color_bits(ecx_binary)
-    colored_edx_bits = color_bits(edx_binary)
-    
-    # Print EBX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("EBX in binary:")
-        print(colored_ebx_bits)
-        print()
+    if get_host_os() != "Linux":
+        click.echo("The tracing-readiness check requires Linux (perf_event_open).")
+        return
 
-    # Step through each bit in ebx_binary and list its meaning
-    click.echo("Intel CPUID Leaf 7, Sub-leaf 0 EBX Bits:")
-    for bit_index, description in intel_leaf7_ebx_bits:
-        bit_value = ebx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        #click.echo(f"Value: {colored_value} - {description}")
-        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
-        click.echo(f"{colored_value} - {colored_desc}")
+    paranoid = read_sysfs_value("/proc/sys/kernel/perf_event_paranoid")
+    click.echo(f"perf_event_paranoid: {paranoid}")
+    pmu = read_perf_pmu("intel_pt")
+    if pmu is None:
+        click.echo(click.style("The kernel exposes no intel_pt PMU", fg='red') +
+                   (", PT is hidden by the hypervisor or not supported." if not leaf7_ebx & (1 << 25) else
+                    ", build the kernel with CONFIG_PERF_EVENTS_INTEL_PT or check dmesg for PT errors."))
+        return
+    click.echo(f"intel_pt PMU type {pmu['type']}, format fields: {', '.join(sorted(pmu['format']))}")
+    click.echo()
 
-    click.echo()  # Add a newline for cleaner output
+    perf_lib = compile_and_load_native("perf_probe", perf_probe_cdef, perf_probe_c_code)
+    if perf_lib is None:
+        click.echo("Error: unable to compile the perf_event_open probe.")
+        return
+
+    # Cheapest first: no cycle or timing packets, return compression on, the sparsest PSB the CPU offers
+    psb_periods = caps.get("psb_periods") or int(pmu["caps"].get("psb_periods", "0") or "0", 16)
+    sparsest_psb = psb_periods.bit_length() - 1 if psb_periods else 0
+    configurations = [
+        ("branches, no timing, user only", {"pt": 1, "branch": 1, "psb_period": sparsest_psb}, 1),
+        ("branches with TSC, user only", {"pt": 1, "branch": 1, "tsc": 1, "psb_period": sparsest_psb}, 1),
+        ("branches with TSC and MTC, user only", {"pt": 1, "branch": 1, "tsc": 1, "mtc": 1, "psb_period": sparsest_psb}, 1),
+        ("branches with TSC, user and kernel", {"pt": 1, "branch": 1, "tsc": 1, "psb_period": sparsest_psb}, 0),
+        ("cycle accurate, user and kernel", {"pt": 1, "branch": 1, "tsc": 1, "mtc": 1, "cyc": 1}, 0),
+    ]
+
+    click.echo("{:<40} {}".format("Configuration", "perf_event_open"))
+    click.echo("-" * 74)
+    usable = []
+    for name, values, user_only in configurations:
+        config, config1, config2 = encode_perf_config(pmu, values)
+        status = perf_lib.perf_probe_open(pmu["type"], config, config1, config2, 0, 0, user_only, 1, 0)
+        if status == 0:
+            usable.append((name, values, user_only))
+            click.echo("{:<40} {}".format(name, click.style("OK", fg='green', bold=True)))
+        else:
+            click.echo("{:<40} {}".format(name, click.style(perf_open_error(-status), fg='red')))
+    click.echo()
+
+    if not usable:
+        click.echo(click.style("Processor Trace cannot be opened here.", fg='red'))
+        if paranoid not in ("-1", "0"):
+            click.echo("Lower kernel.perf_event_paranoid or grant CAP_PERFMON to the tracing process.")
+        return
+
+    name, values, user_only = usable[0]
+    terms = ",".join(f"{field}={value}" for field, value in values.items() if field != "pt" and field in pmu["format"])
+    click.echo(click.style(f"Cheapest usable configuration: {name}", fg='green'))
+    click.echo(f"  perf record -e intel_pt/{terms}/{'u' if user_only else ''} -- <command>")
+    if caps.get("address_ranges"):
+        click.echo(f"  Add --filter 'filter <function> @ <binary>' to trace up to {caps['address_ranges']} address ranges only.")
+    if caps.get("cr3_filter"):
+        click.echo("  CR3 filtering lets per-process traces skip other processes at no cost.")
+    if not caps.get("topa_multi"):
+        click.echo(click.style("  No multi-entry ToPA: the AUX buffer is one contiguous region, keep it small.", fg='yellow'))
+    click.echo()
+
+def inspect_branch_records():
+    click.clear()
 
-    # Print ECX in binary format
     if DEBUG.upper() == "TRUE":
-        click.echo("ECX in binary:")
-        print(colored_ecx_bits)
-        print()
+        click.echo("If you see this message, you're in DEBUG mode...")
 
-    # Step through each bit in ecx_binary and list its meaning
-    click.echo("Intel CPUID Leaf 7, Sub-leaf 0 ECX Bits:")
-    for bit_index, description in intel_leaf7_ecx_bits:
-        bit_value = ecx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        #click.echo(f"Value: {colored_value} - {description}")
-        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
-        click.echo(f"{colored_value} - {colored_desc}")
+    compile_and_load_cpuid()
 
-    click.echo()  # Add a newline for cleaner output
+    vendor = schema_vendor(get_cpu_vendor())
+    max_basic_leaf, _, _, _ = call_cpuid(0, 0)
+    max_extended_leaf, _, _, _ = call_cpuid(0x80000000, 0)
+    hypervisor = bool(call_cpuid(1, 0)[2] & (1 << 31))
 
-    # Print EDX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("EDX in binary:")
-        print(colored_edx_bits)
-        print()
+    # Hardware branch recording the CPU enumerates, as (mechanism, depth or None)
+    mechanisms = []
+    if vendor == "intel":
+        leaf7_edx = call_cpuid(7, 0)[3] if max_basic_leaf >= 7 else 0
+        click.echo("Architectural LBR (Leaf 7 EDX[19]): " + (click.style("Supported", fg='green', bold=True) if leaf7_edx & (1 << 19) else click.style("Not supported", fg='red')))
+        click.echo()
+        if leaf7_edx & (1 << 19) and max_basic_leaf >= 0x1C:
+            eax, ebx, ecx, _ = call_cpuid(0x1C, 0)
+            print_bit_list("Intel CPUID Leaf 1C EAX Bits:", eax, feature_bits("intel", 0x0000001C, 0, "eax"))
+            print_bit_list("Intel CPUID Leaf 1C EBX Bits:", ebx, feature_bits("intel", 0x0000001C, 0, "ebx"))
+            print_bit_list("Intel CPUID Leaf 1C ECX Bits:", ecx, feature_bits("intel", 0x0000001C, 0, "ecx"))
+            depths = [8 * (bit + 1) for bit in range(8) if eax & (1 << bit)]
+            click.echo(f"Supported LBR depths: {', '.join(map(str, depths)) or 'none'}")
+            click.echo(f"CPL filtering: {'yes' if ebx & 1 else 'no'}, call-stack mode: {'yes' if ebx & 4 else 'no'}, "
+                       f"mispredict bit: {'yes' if ecx & 1 else 'no'}, cycle counts: {'yes' if ecx & 2 else 'no'}")
+            click.echo()
+            mechanisms.append(("Architectural LBR", max(depths, default=None)))
+        elif not hypervisor:
+            # Model-specific LBRs predate leaf 0x1C and are not enumerated, perf knows them by model
+            mechanisms.append(("Model-specific LBR", None))
+    else:
+        brs = max_extended_leaf >= 0x80000008 and call_cpuid(0x80000008, 0)[1] & (1 << 31)
+        click.echo("Branch Sampling (BRS, Leaf 0x80000008 EBX[31]): " + (click.style("Supported", fg='green', bold=True) if brs else click.style("Not supported", fg='red')))
+        lbr_v2 = False
+        if max_extended_leaf >= 0x80000022:
+            eax, ebx, _, _ = call_cpuid(0x80000022, 0)
+            lbr_v2 = bool(eax & (1 << 1))
+            click.echo("LBR stack (LbrExtV2, Leaf 0x80000022 EAX[1]): " + (click.style("Supported", fg='green', bold=True) if lbr_v2 else click.style("Not supported", fg='red')))
+            click.echo()
+            print_bit_list("AMD CPUID Leaf 80000022 EAX Bits:", eax, feature_bits("amd", 0x80000022, 0, "eax"))
+            print_register_fields("AMD CPUID Leaf 80000022 EBX:", "amd", 0x80000022, 0, "ebx", ebx)
+            if lbr_v2:
+                mechanisms.append(("LbrExtV2", (ebx >> 4) & 0x3F))
+        else:
+            click.echo()
+        if brs:
+            mechanisms.append(("BRS", 16))
 
-    # Step through each bit in edx_binary and list its meaning
-    click.echo("Intel CPUID Leaf 7, Sub-leaf 0 EDX Bits:")
-    for bit_index, description in intel_leaf7_edx_bits:
-        bit_value = edx_binary[31 - bit_index]
-        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        #click.echo(f"Value: {colored_value} - {description}")
-        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
-        click.echo(f"{colored_value} - {colored_desc}")
+    if get_host_os() != "Linux":
+        click.echo("The perf readiness check requires Linux (perf_event_open).")
+        return
 
-    click.echo()  # Add a newline for cleaner output
+    cpu_pmu = read_perf_pmu("cpu") or read_perf_pmu("cpu_core")
+    sysfs_depth = cpu_pmu["caps"].get("branches") if cpu_pmu else None
+    click.echo(f"perf_event_paranoid: {read_sysfs_value('/proc/sys/kernel/perf_event_paranoid')}")
+    click.echo(f"Kernel branch stack depth (cpu PMU caps/branches): {sysfs_depth or 'not reported'}")
+    click.echo()
 
-def inspect_leaf80000001_intel_support():
-    click.clear()
+    perf_lib = compile_and_load_native("perf_probe", perf_probe_cdef, perf_probe_c_code)
+    if perf_lib is None:
+        click.echo("Error: unable to compile the perf_event_open probe.")
+        return
 
-    def color_bits(binary_string):
-        """Returns a colored version of the binary string with specific bits highlighted."""
-        colored_bits = ""
-        for i, bit in enumerate(binary_string):
-            # Highlight specific bit in red if it's '0', green if it's '1'
-            if bit == '0':
-                colored_bits += click.style(bit, fg='red')
-            else:
-                colored_bits += click.style(bit, fg='green', bold=True)
-        return colored_bits
+    # perf record -b samples cycles with PERF_SAMPLE_BRANCH_STACK, --call-graph lbr adds the call-stack filter
+    sample_ip, sample_branch_stack = 1 << 0, 1 << 11
+    branch_user, branch_any, branch_call_stack = 1 << 0, 1 << 3, 1 << 11
+    checks = [
+        ("cycles sampling (no branches)", sample_ip, 0, 1),
+        ("branch stack, user (perf -b)", sample_ip | sample_branch_stack, branch_user | branch_any, 1),
+        ("branch stack, user and kernel", sample_ip | sample_branch_stack, branch_any, 0),
+        ("LBR call stack (--call-graph lbr)", sample_ip | sample_branch_stack, branch_user | branch_call_stack, 1),
+    ]
+    click.echo("{:<36} {}".format("perf_event_open", "Result"))
+    click.echo("-" * 74)
+    results = {}
+    for name, sample_type, branch_type, user_only in checks:
+        status = perf_lib.perf_probe_open(0, 0, 0, 0, sample_type, branch_type, user_only, 1, 0)
+        results[name] = status
+        click.echo("{:<36} {}".format(name, click.style("OK", fg='green', bold=True) if status == 0 else click.style(perf_open_error(-status), fg='red')))
+    click.echo()
 
-    def colored_description(description, bit_value):
-        """Returns a colored version of the description based on the bit value."""
-        if bit_value == '0':
-            return click.style(description, fg='red')
+    if results["branch stack, user (perf -b)"] == 0:
+        depth = sysfs_depth or next((depth for _, depth in mechanisms if depth), None)
+        click.echo(click.style("PGO profile collection supported", fg='green', bold=True) +
+                   f" ({', '.join(name for name, _ in mechanisms) or 'branch stack'}{f', {depth} entries' if depth else ''}).")
+        click.echo("  AutoFDO: perf record -b -e cycles:u -- <command>, then create_llvm_prof --binary=<binary> --profile=perf.data")
+        click.echo("  BOLT:    perf record -e cycles:u -j any,u -- <command>, then perf2bolt -p perf.data -o perf.fdata <binary>")
+        if results["LBR call stack (--call-graph lbr)"] != 0:
+            click.echo("  LBR call-stack mode is unavailable, use --call-graph dwarf or fp for call graphs.")
+    else:
+        click.echo(click.style("PGO profile collection with branch records is not available here.", fg='red'))
+        if not mechanisms:
+            click.echo("  The CPU reports no branch recording" + (", the hypervisor hides it from this guest." if hypervisor else "."))
+        elif -results["cycles sampling (no branches)"] in (2, 19, 95):
+            click.echo("  No hardware PMU is available to perf" + (", the hypervisor exposes none to this guest." if hypervisor else "."))
+        elif results["cycles sampling (no branches)"] != 0:
+            click.echo("  Hardware sampling is blocked, lower kernel.perf_event_paranoid or grant CAP_PERFMON.")
         else:
-            return click.style(description, fg='green', bold=True)
+            click.echo("  The kernel cannot program the branch records, check that the PMU driver supports this CPU.")
+        if results["cycles sampling (no branches)"] == 0:
+            click.echo("  Fallback: BOLT without LBR, perf record -e cycles:u -- <command>, then perf2bolt -nl.")
+    click.echo()
+
+def order_cpus_by_distance(cpus):
+    """
+    Orders CPUs by topology distance from the first one: its SMT siblings, then cores sharing its last
+    level cache, then the rest of its package, then other packages.
+
+    Returns:
+        list: (cpu, distance) pairs, distance being "self", "smt", "core", "llc" or "package".
+    """
+    topology = read_cpu_topology(cpus)
+    first = topology[cpus[0]]
+    ranks = {"self": 0, "smt": 1, "core": 2, "llc": 3, "package": 4}
+
+    def distance(cpu):
+        if cpu == cpus[0]:
+            return "self"
+        if topology[cpu]["package"] != first["package"]:
+            return "package"
+        if cpu in first["siblings"]:
+            return "smt"
+        return "core" if cpu in first["llc"] else "llc"
+
+    return sorted(((cpu, distance(cpu)) for cpu in cpus), key=lambda entry: (ranks[entry[1]], entry[0]))
+
+def inspect_tlb_shootdown():
+    click.clear()
 
     if DEBUG.upper() == "TRUE":
         click.echo("If you see this message, you're in DEBUG mode...")
 
     compile_and_load_cpuid()
 
-    # Query CPUID leaf 0x80000001, subleaf H
-    eax, ebx, ecx, edx = call_cpuid(0x80000001, 17)
-    if DEBUG.upper() == "TRUE":
-        print("call_cpuid function returned:")
-        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+    max_basic_leaf, _, _, _ = call_cpuid(0, 0)
+    max_extended_leaf, _, _, _ = call_cpuid(0x80000000, 0)
+    leaf1_ecx = call_cpuid(1, 0)[2]
+    leaf7_ebx = call_cpuid(7, 0)[1] if max_basic_leaf >= 7 else 0
+    _, ext8_ebx, _, ext8_edx = call_cpuid(0x80000008, 0) if max_extended_leaf >= 0x80000008 else (0, 0, 0, 0)
+    invlpgb = schema_vendor(get_cpu_vendor()) == "amd" and ext8_ebx & (1 << 3)
+
+    capabilities = [
+        ("Process context identifiers (PCID)", "Leaf 1 ECX[17]",          leaf1_ecx & (1 << 17)),
+        ("INVPCID instruction",                "Leaf 7 EBX[10]",          leaf7_ebx & (1 << 10)),
+        ("INVLPGB and TLBSYNC (AMD)",          "Leaf 0x80000008 EBX[3]",  invlpgb),
+    ]
+    click.echo("TLB Management Capabilities:")
+    click.echo("{:<38} {:<26} {:<10}".format("Feature", "Location", "Status"))
+    click.echo("-" * 74)
+    for feature, location, supported in capabilities:
+        status = click.style("Yes", fg='green', bold=True) if supported else click.style("No", fg='red')
+        click.echo("{:<38} {:<26} {}".format(feature, location, status))
+    if invlpgb:
+        click.echo(f"INVLPGB maximum page count (Leaf 0x80000008 EDX[15:0]): {(ext8_edx & 0xFFFF) + 1}")
+    click.echo()
 
-    # Print EBX in hexadecimal format
-    if DEBUG.upper() == "TRUE":
-        click.echo("Leaf 0x80000001 sub-leaf H Registers:")
-        click.echo(f"EAX: 0x{eax:08X}")
-        click.echo(f"EBX: 0x{ebx:08X}")
-        click.echo(f"ECX: 0x{ecx:08X}")
-        click.echo(f"EDX: 0x{edx:08X}\n")
+    if leaf1_ecx & (1 << 17) and leaf7_ebx & (1 << 10):
+        click.echo("PCID with INVPCID: context switches keep TLB entries, and the kernel flushes single PCIDs.")
+    elif leaf1_ecx & (1 << 17):
+        click.echo("PCID without INVPCID: the kernel falls back to CR3 writes to flush other PCIDs.")
+    else:
+        click.echo(click.style("No PCID: every context switch flushes the TLB, and so does every page table isolation switch.", fg='yellow'))
+    if invlpgb:
+        click.echo("INVLPGB broadcasts invalidations in hardware, kernels that use it skip the shootdown IPIs.")
+    else:
+        click.echo("Remote TLB flushes are IPIs to every CPU running the mm, their cost grows with the number of CPUs.")
+    click.echo()
 
-    # Convert EBX to binary string
-    ebx_binary = f"{ebx:032b}"
-    ecx_binary = f"{ecx:032b}"
-    edx_binary = f"{edx:032b}"
+    if get_host_os() != "Linux":
+        click.echo("The shootdown benchmark requires Linux (CPU affinity).")
+        return
 
-    colored_ebx_bits = color_bits(ebx_binary)
-    colored_ecx_bits = color_bits(ecx_binary)
-    colored_edx_bits = color_bits(edx_binary)
-    
-    # Print EBX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("EBX in binary:")
-        print(colored_ebx_bits)
-        print()
+    shootdown_lib = compile_and_load_native("shootdown_probe", shootdown_probe_cdef, shootdown_probe_c_code)
+    if shootdown_lib is None:
+        click.echo("Error: unable to compile the shootdown benchmark.")
+        return
 
-    # Step through each bit in ebx_binary and list its meaning
-    click.echo("Intel CPUID Leaf 0x80000001, Sub-leaf H EBX Bits:")
-    for bit_index, description in intel_leaf80000001_ebx_bits:
-        bit_value = ebx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        #click.echo(f"Value: {colored_value} - {description}")
-        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
-        click.echo(f"{colored_value} - {colored_desc}")
+    ordered = order_cpus_by_distance(sorted(os.sched_getaffinity(0)))
+    # 1, 2, 4, ... threads, plus the first CPU of every farther domain so each boundary is covered
+    counts = {1, len(ordered)}
+    count = 2
+    while count < len(ordered):
+        counts.add(count)
+        count *= 2
+    for index in range(1, len(ordered)):
+        if ordered[index][1] != ordered[index - 1][1]:
+            counts.add(index + 1)
+    counts = sorted(counts)
+
+    pages = click.prompt("Enter the number of 4 KB pages per operation", default=1, type=int)
+    if pages <= 0:
+        click.echo("Error: the number of pages must be positive.")
+        return
+    iterations = 2000
+
+    operations = [(0, "munmap"), (1, "mprotect RW->R"), (2, "madvise DONTNEED")]
+    click.echo(f"\nTiming each operation {iterations} times with 1 to {len(ordered)} threads sharing the mm...\n")
+    header = "{:>8} {:<10}".format("Threads", "Farthest") + "".join("{:>21}".format(name + " us") for _, name in operations)
+    click.echo(header)
+    click.echo("-" * len(header))
+
+    results = {}
+    with EnergyMeter() as meter:
+        for count in counts:
+            cpus = [cpu for cpu, _ in ordered[:count]]
+            cells = []
+            for op, name in operations:
+                ns_per_op = ffi_new("double *")
+                status = shootdown_lib.shootdown_probe(count, ffi_new("int[]", cpus), op, pages, iterations, ns_per_op)
+                count_benchmark_ops(iterations, "memory map operations")
+                results[(count, name)] = ns_per_op[0] / 1000 if status == 0 else None
+                cells.append("{:>21.2f}".format(results[(count, name)]) if status == 0 else "{:>21}".format("failed"))
+            click.echo("{:>8} {:<10}".format(count, ordered[count - 1][1]) + "".join(cells))
+    click.echo()
 
-    click.echo()  # Add a newline for cleaner output
+    alone = results.get((1, "munmap"))
+    widest = results.get((counts[-1], "munmap"))
+    if len(counts) == 1:
+        click.echo("Only one CPU is available, the numbers are the local cost without any shootdown.")
+    elif alone and widest:
+        click.echo(f"munmap costs {widest / alone:.1f}x more with {counts[-1]} threads sharing the mm than with one.")
+        farthest = {}
+        for index, (_, distance) in enumerate(ordered):
+            farthest.setdefault(distance, index + 1)
+        for distance in ("core", "llc", "package"):
+            if distance in farthest and results.get((farthest[distance], "munmap")):
+                click.echo(f"  Reaching {distance} distance ({farthest[distance]} threads): {results[(farthest[distance], 'munmap')]:.2f} us per munmap")
+        click.echo("Keep arenas per thread group within one LLC, batch unmaps, and prefer MADV_FREE or reuse over munmap in hot paths.")
+    click.echo()
+    meter.report()
+
+def read_split_lock_policy():
+    """
+    Reads how the Linux kernel handles split locks and bus locks.
+
+    Returns:
+        dict: "flags" (the split_lock_detect and bus_lock_detect flags of /proc/cpuinfo that are set),
+        "mode" (the split_lock_detect= boot parameter, "warn" being the kernel default) and "mitigate"
+        (kernel.split_lock_mitigate, None when the sysctl is absent).
+    """
+    flags = set()
+    try:
+        with open("/proc/cpuinfo") as f:
+            for line in f:
+                if line.startswith("flags"):
+                    flags = set(line.split(":", 1)[1].split()) & {"split_lock_detect", "bus_lock_detect"}
+                    break
+    except OSError:
+        pass
+
+    mode = "warn"
+    for argument in read_sysfs_value("/proc/cmdline", "").split():
+        if argument.startswith("split_lock_detect="):
+            mode = argument.split("=", 1)[1]
+    mitigate = read_sysfs_value("/proc/sys/kernel/split_lock_mitigate", None)
+    return {"flags": flags, "mode": mode, "mitigate": None if mitigate is None else mitigate == "1"}
+
+def inspect_atomic_cost():
+    click.clear()
 
-    # Print ECX in binary format
     if DEBUG.upper() == "TRUE":
-        click.echo("ECX in binary:")
-        print(colored_ecx_bits)
-        print()
+        click.echo("If you see this message, you're in DEBUG mode...")
 
-    # Step through each bit in ecx_binary and list its meaning
-    click.echo("Intel CPUID Leaf 0x80000001, Sub-leaf H ECX Bits:")
-    for bit_index, description in intel_leaf80000001_ecx_bits:
-        bit_value = ecx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        #click.echo(f"Value: {colored_value} - {description}")
-        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
-        click.echo(f"{colored_value} - {colored_desc}")
+    compile_and_load_cpuid()
 
-    click.echo()  # Add a newline for cleaner output
+    max_basic_leaf, _, _, _ = call_cpuid(0, 0)
+    leaf1_ecx = call_cpuid(1, 0)[2]
+    _, _, leaf7_ecx, leaf7_edx = call_cpuid(7, 0) if max_basic_leaf >= 7 else (0, 0, 0, 0)
+    core_capabilities = read_msr(0xCF) if leaf7_edx & (1 << 30) else None
+    arch_capabilities = read_msr(0x10A) if leaf7_edx & (1 << 29) else None
+
+    def status(value):
+        if value is None:
+            return click.style("Unknown", fg='yellow')
+        return click.style("Yes", fg='green', bold=True) if value else click.style("No", fg='red')
+
+    click.echo("Lock Detection Capabilities:")
+    click.echo("{:<38} {:<26} {:<10}".format("Feature", "Location", "Status"))
+    click.echo("-" * 74)
+    click.echo("{:<38} {:<26} {}".format("CMPXCHG16B instruction", "Leaf 1 ECX[13]", status(leaf1_ecx & (1 << 13))))
+    click.echo("{:<38} {:<26} {}".format("Bus lock debug exception", "Leaf 7 ECX[24]", status(leaf7_ecx & (1 << 24))))
+    click.echo("{:<38} {:<26} {}".format("IA32_ARCH_CAPABILITIES MSR", "Leaf 7 EDX[29]", status(leaf7_edx & (1 << 29))))
+    click.echo("{:<38} {:<26} {}".format("IA32_CORE_CAPABILITIES MSR", "Leaf 7 EDX[30]", status(leaf7_edx & (1 << 30))))
+    split_lock_detect = None if core_capabilities is None else core_capabilities & (1 << 5)
+    if not leaf7_edx & (1 << 30):
+        split_lock_detect = 0
+    click.echo("{:<38} {:<26} {}".format("Split lock #AC detection", "MSR 0xCF bit 5", status(split_lock_detect)))
+    if arch_capabilities is not None:
+        click.echo(f"IA32_ARCH_CAPABILITIES (MSR 0x10A) = 0x{arch_capabilities:016X}")
+    elif leaf7_edx & (1 << 29) or leaf7_edx & (1 << 30):
+        click.echo("The capability MSRs are unreadable, load the msr module and run as root to read them.")
+    click.echo()
 
-    # Print EDX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("EDX in binary:")
-        print(colored_edx_bits)
-        print()
+    if get_host_os() != "Linux":
+        click.echo("The atomic operation benchmark requires Linux (CPU affinity).")
+        return
 
-    # Step through each bit in edx_binary and list its meaning
-    click.echo("Intel CPUID Leaf 0x80000001, Sub-leaf H EDX Bits:")
-    for bit_index, description in intel_leaf80000001_edx_bits:
-        bit_value = edx_binary[31 - bit_index]
-        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        #click.echo(f"Value: {colored_value} - {description}")
-        #click.echo(f"Bit {bit_index}: {description} - Value: {colored_value}")
-        click.echo(f"{colored_value} - {colored_desc}")
+    policy = read_split_lock_policy()
+    click.echo("Kernel Split Lock Policy:")
+    click.echo(f"  Detection flags: {', '.join(sorted(policy['flags'])) or 'none'}")
+    if policy["flags"]:
+        click.echo(f"  split_lock_detect mode: {policy['mode']}")
+        if policy["mitigate"] is not None:
+            click.echo(f"  kernel.split_lock_mitigate: {int(policy['mitigate'])}")
+        if policy["mode"] == "fatal":
+            click.echo(click.style("  Split locks are fatal, any process issuing one receives SIGBUS.", fg='red'))
+        elif policy["mode"] in ("warn", "ratelimit") or policy["mode"].startswith("ratelimit:"):
+            click.echo(click.style("  Split locks are logged and the offending task is throttled.", fg='yellow'))
+    click.echo()
 
-    click.echo()  # Add a newline for cleaner output
+    atomic_lib = compile_and_load_native("atomic_probe", atomic_probe_cdef, atomic_probe_c_code)
+    if atomic_lib is None:
+        click.echo("Error: unable to compile the atomic operation benchmark.")
+        return
 
-def inspect_leaf1_amd_support():
-    click.clear()
+    cpus = sorted(os.sched_getaffinity(0))
+    pairs = pick_cpu_pairs(cpus)
+    operations = [(0, "LOCK XADD"), (1, "LOCK CMPXCHG")]
+    if leaf1_ecx & (1 << 13):
+        operations.append((2, "LOCK CMPXCHG16B"))
+    iterations = 1000000
+
+    def cost(op, cpu_a, cpu_b):
+        count_benchmark_ops(3 * iterations * (1 if cpu_b < 0 else 2), "atomic operations")
+        return min(atomic_lib.atomic_probe(op, cpu_a, cpu_b, iterations) for _ in range(3))
+
+    labels = {"smt": "SMT siblings", "core": "Same LLC", "llc": "Other LLC", "package": "Other package"}
+    columns = [("alone", "Uncontended")] + [(distance, labels[distance]) for distance in ("smt", "core", "llc", "package") if distance in pairs]
+
+    click.echo("Running the atomic operation benchmark, ns per successful operation...")
+    results = {}
+    meter = EnergyMeter()
+    with meter:
+        for op, name in operations:
+            results[name] = {}
+            for distance, _ in columns:
+                cpu_a, cpu_b = (cpus[0], -1) if distance == "alone" else pairs[distance]
+                results[name][distance] = cost(op, cpu_a, cpu_b)
+    click.echo()
 
-    def color_bits(binary_string):
-        """Returns a colored version of the binary string with specific bits highlighted."""
-        colored_bits = ""
-        for i, bit in enumerate(binary_string):
-            # Highlight specific bit in red if it's '0', green if it's '1'
-            if bit == '0':
-                colored_bits += click.style(bit, fg='red')
-            else:
-                colored_bits += click.style(bit, fg='green', bold=True)
-        return colored_bits
+    click.echo("{:<18}".format("Operation") + "".join("{:>15}".format(label) for _, label in columns))
+    click.echo("-" * (18 + 15 * len(columns)))
+    for _, name in operations:
+        cells = []
+        for distance, _ in columns:
+            value = results[name][distance]
+            cells.append("{:>15}".format("failed") if value < 0 else "{:>15.1f}".format(value))
+        click.echo("{:<18}".format(name) + "".join(cells))
+    if not pairs:
+        click.echo("Only one CPU is available, contended costs need at least two.")
+    click.echo()
 
-    def colored_description(description, bit_value):
-        """Returns a colored version of the description based on the bit value."""
-        if bit_value == '0':
-            return click.style(description, fg='red')
+    ns_per_op = ffi_new("double *")
+    with meter:
+        split_status = atomic_lib.split_lock_probe(100000, ns_per_op)
+    aligned = results["LOCK XADD"]["alone"]
+    click.echo("Split Lock Cost (LOCK XADD on a quadword straddling two cache lines):")
+    if split_status == 0:
+        if aligned > 0:
+            click.echo(f"  Split: {ns_per_op[0]:.1f} ns per operation, aligned: {aligned:.1f} ns ({ns_per_op[0] / aligned:.0f}x)")
         else:
-            return click.style(description, fg='green', bold=True)
+            click.echo(f"  Split: {ns_per_op[0]:.1f} ns per operation, aligned run failed")
+        if ns_per_op[0] >= 1e4:
+            click.echo(click.style("  The kernel traps or throttles every split lock, avoid them entirely on this host.", fg='red'))
+        else:
+            click.echo(click.style("  Every split lock locks the bus, stalling memory access on all cores of the socket.", fg='yellow'))
+    elif split_status > 0:
+        click.echo(click.style(f"  The benchmark was killed by signal {split_status} ({signal.Signals(split_status).name}), "
+                               "split locks are fatal on this host.", fg='red'))
+    else:
+        click.echo("  Error: unable to run the split lock benchmark.")
+    click.echo()
+
+    alone = results["LOCK XADD"]["alone"]
+    contended = [results["LOCK XADD"][distance] for distance, _ in columns[1:] if results["LOCK XADD"][distance] > 0]
+    if alone > 0 and contended:
+        click.echo(f"A contended LOCK XADD costs up to {max(contended) / alone:.1f}x an uncontended one, "
+                   "shard hot counters per core or per LLC and combine them on read.")
+    if results["LOCK CMPXCHG"]["alone"] > 0 and alone > 0 and results["LOCK CMPXCHG"]["alone"] > alone * 1.5:
+        click.echo("Compare and exchange loops cost more than LOCK XADD alone, use fetch-and-add for counters.")
+    click.echo("Keep every atomic variable naturally aligned so it never crosses a cache line.")
+    click.echo()
+    meter.report()
+
+def read_cache_sizes():
+    """
+    Reads the data and unified cache sizes from the deterministic cache parameters leaf, 0x4 on Intel
+    and 0x8000001D on AMD.
+
+    Returns:
+        dict: cache level to its size in bytes, empty when the leaf is not available.
+    """
+    vendor = schema_vendor(get_cpu_vendor())
+    cache_leaf = 0x8000001D if vendor == "amd" else 0x00000004
+    max_leaf, _, _, _ = call_cpuid(cache_leaf & 0x80000000, 0)
+    sizes = {}
+    if max_leaf < cache_leaf:
+        return sizes
+
+    # Size = ways * partitions * line size * sets, each stored minus 1
+    for subleaf in range(16):
+        eax, ebx, ecx, _ = call_cpuid(cache_leaf, subleaf)
+        cache_type = eax & 0x1F
+        if cache_type == 0:
+            break
+        if cache_type in (1, 3):
+            level = (eax >> 5) & 0x7
+            sizes[level] = ((ebx >> 22) + 1) * (((ebx >> 12) & 0x3FF) + 1) * ((ebx & 0xFFF) + 1) * (ecx + 1)
+    return sizes
+
+def inspect_cache_flush_cost():
+    click.clear()
 
     if DEBUG.upper() == "TRUE":
         click.echo("If you see this message, you're in DEBUG mode...")
 
     compile_and_load_cpuid()
 
-    # Query CPUID leaf 1, subleaf 0
-    eax, ebx, ecx, edx = call_cpuid(1, 0)
-    if DEBUG.upper() == "TRUE":
-        print("call_cpuid function returned:")
-        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+    max_basic_leaf, _, _, _ = call_cpuid(0, 0)
+    leaf1_edx = call_cpuid(1, 0)[3]
+    _, leaf7_ebx, leaf7_ecx, _ = call_cpuid(7, 0) if max_basic_leaf >= 7 else (0, 0, 0, 0)
+
+    instructions = [
+        (0, "CLFLUSH",    "Leaf 1 EDX[19]", leaf1_edx & (1 << 19)),
+        (1, "CLFLUSHOPT", "Leaf 7 EBX[23]", leaf7_ebx & (1 << 23)),
+        (2, "CLWB",       "Leaf 7 EBX[24]", leaf7_ebx & (1 << 24)),
+        (3, "CLDEMOTE",   "Leaf 7 ECX[25]", leaf7_ecx & (1 << 25)),
+    ]
+    click.echo("Cache Line Flush Instructions:")
+    click.echo("{:<38} {:<26} {:<10}".format("Instruction", "Location", "Status"))
+    click.echo("-" * 74)
+    for _, name, location, supported in instructions:
+        status = click.style("Yes", fg='green', bold=True) if supported else click.style("No", fg='red')
+        click.echo("{:<38} {:<26} {}".format(name, location, status))
+    click.echo()
 
-    # Print Registers in hexadecimal format
-    if DEBUG.upper() == "TRUE":
-        click.echo("Leaf 1 sub-leaf 0 Registers:")
-        click.echo(f"EAX: 0x{eax:08X}")
-        click.echo(f"EBX: 0x{ebx:08X}")
-        click.echo(f"ECX: 0x{ecx:08X}")
-        click.echo(f"EDX: 0x{edx:08X}\n")
+    if get_host_os() != "Linux":
+        click.echo("The flush benchmark requires Linux (CPU affinity).")
+        return
 
-    # Convert Registers to binary strings
-    ebx_binary = f"{ebx:032b}"
-    ecx_binary = f"{ecx:032b}"
-    edx_binary = f"{edx:032b}"
+    flush_lib = compile_and_load_native("flush_probe", flush_probe_cdef, flush_probe_c_code)
+    if flush_lib is None:
+        click.echo("Error: unable to compile the flush benchmark.")
+        return
 
-    colored_ebx_bits = color_bits(ebx_binary)
-    colored_ecx_bits = color_bits(ecx_binary)
-    colored_edx_bits = color_bits(edx_binary)
-    
-    # Print EBX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("EBX in binary:")
-        print(colored_ebx_bits)
+    # Half of each level keeps the buffer resident in it, twice the largest one leaves it in memory
+    cache_sizes = read_cache_sizes()
+    levels = [(f"L{level}", cache_sizes[level] // 2) for level in sorted(cache_sizes)]
+    levels.append(("Memory", max(list(cache_sizes.values()) + [16 * 1024 * 1024]) * 2))
+    operations = [(op, name) for op, name, _, supported in instructions if supported]
+    operations.append((-1, "Fence only"))
+
+    def rounds(size):
+        return 2 if size > 16 * 1024 * 1024 else 5
+
+    click.echo("Running the flush benchmark on dirty lines resident in each level...")
+    results = {}
+    meter = EnergyMeter()
+    with meter:
+        for serialize in (1, 0):
+            for op, name in operations:
+                for level, size in levels:
+                    results[(serialize, name, level)] = flush_lib.flush_probe(op, serialize, size, rounds(size))
+                    count_benchmark_ops(size // 64 * rounds(size), "cache lines")
+    click.echo()
+
+    for serialize, title in ((1, "Latency, ns per line with MFENCE after each line:"), (0, "Throughput, ns per line with one SFENCE per pass:")):
+        click.echo(title)
+        click.echo("{:<14}".format("Instruction") + "".join("{:>16}".format(f"{level} ({size // 1024} KB)" if size < 1 << 20 else f"{level} ({size >> 20} MB)") for level, size in levels))
+        click.echo("-" * (14 + 16 * len(levels)))
+        for _, name in operations:
+            cells = []
+            for level, _ in levels:
+                value = results[(serialize, name, level)]
+                cells.append("{:>16}".format("failed") if value < 0 else "{:>16.1f}".format(value))
+            click.echo("{:<14}".format(name) + "".join(cells))
         click.echo()
 
-    # Step through each bit in ebx_binary and list its meaning
-    click.echo("AMD CPUID Leaf 1, Sub-leaf 0 EBX Bits:")
-    for bit_index, description in amd_leaf1_ebx_bits:
-        bit_value = ebx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        click.echo(f"{colored_value} - {colored_desc}")
+    pairs = pick_cpu_pairs(sorted(os.sched_getaffinity(0)))
+    if not pairs:
+        click.echo("Only one CPU is available, skipping the cross-core handoff benchmark.")
+        click.echo()
+    else:
+        labels = {"smt": "SMT siblings", "core": "Same LLC", "llc": "Other LLC", "package": "Other package"}
+        handoff_ops = [(-1, "None")] + [(op, name) for op, name in operations if op in (1, 2, 3)]
+        producer_ns = ffi_new("double *")
+        consumer_ns = ffi_new("double *")
+        click.echo("Producer to consumer handoff of 64 lines, ns per line (producer write and hint / consumer load):")
+        click.echo("{:<14}".format("Hint") + "".join("{:>22}".format(labels[distance]) for distance in pairs))
+        click.echo("-" * (14 + 22 * len(pairs)))
+        best = {}
+        with meter:
+            for op, name in handoff_ops:
+                cells = []
+                for distance, (cpu_a, cpu_b) in pairs.items():
+                    count_benchmark_ops(64 * 2000, "cache lines")
+                    if flush_lib.flush_handoff_probe(op, cpu_a, cpu_b, 64, 2000, producer_ns, consumer_ns) != 0:
+                        cells.append("{:>22}".format("failed"))
+                        continue
+                    cells.append("{:>22}".format(f"{producer_ns[0]:.1f} / {consumer_ns[0]:.1f}"))
+                    if distance not in best or consumer_ns[0] < best[distance][1]:
+                        best[distance] = (name, consumer_ns[0])
+                click.echo("{:<14}".format(name) + "".join(cells))
+        click.echo()
+        for distance, (name, value) in best.items():
+            click.echo(f"{labels[distance]}: fastest consumer loads with {'no hint' if name == 'None' else name} ({value:.1f} ns per line)")
+        click.echo()
 
-    click.echo()  # Add a newline for cleaner output
+    if leaf7_ebx & (1 << 24):
+        click.echo("For persistence use CLWB followed by SFENCE, it writes back without evicting the line.")
+    elif leaf7_ebx & (1 << 23):
+        click.echo("For persistence use CLFLUSHOPT followed by SFENCE, CLWB is not available.")
+    else:
+        click.echo("Only CLFLUSH is available for persistence, it is serialized against other flushes.")
+    if leaf7_ecx & (1 << 25):
+        click.echo("CLDEMOTE is a hint, keep it only where the handoff table shows it shortens consumer loads.")
+    click.echo()
+    meter.report()
+
+def inspect_prefetch_tuning():
+    click.clear()
 
-    # Print ECX in binary format
     if DEBUG.upper() == "TRUE":
-        click.echo("ECX in binary:")
-        print(colored_ecx_bits)
-        click.echo()
+        click.echo("If you see this message, you're in DEBUG mode...")
 
-    # Step through each bit in ecx_binary and list its meaning
-    click.echo("AMD CPUID Leaf 1, Sub-leaf 0 ECX Bits:")
-    for bit_index, description in amd_leaf1_ecx_bits:
-        bit_value = ecx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        click.echo(f"{colored_value} - {colored_desc}")
+    compile_and_load_cpuid()
+
+    max_extended_leaf, _, _, _ = call_cpuid(0x80000000, 0)
+    ext1_ecx = call_cpuid(0x80000001, 0)[2] if max_extended_leaf >= 0x80000001 else 0
+    prefetchw = ext1_ecx & (1 << 8)
+    cache_sizes = read_cache_sizes()
+
+    click.echo("Prefetch Inputs:")
+    click.echo("{:<38} {:<26} {:<10}".format("Item", "Location", "Value"))
+    click.echo("-" * 74)
+    status = click.style("Yes", fg='green', bold=True) if prefetchw else click.style("No", fg='red')
+    click.echo("{:<38} {:<26} {}".format("PREFETCHW instruction", "Leaf 0x80000001 ECX[8]", status))
+    for level, size in sorted(cache_sizes.items()):
+        click.echo("{:<38} {:<26} {}".format(f"L{level} cache size", "Deterministic cache leaf", f"{size // 1024} KB"))
+    click.echo()
+
+    if get_host_os() != "Linux":
+        click.echo("The prefetch tuner requires Linux.")
+        return
+
+    prefetch_lib = compile_and_load_native("prefetch_probe", prefetch_probe_cdef, prefetch_probe_c_code)
+    if prefetch_lib is None:
+        click.echo("Error: unable to compile the prefetch tuner.")
+        return
+
+    # Twice the largest cache keeps every kernel missing to memory, like a scan or a probe of a large table
+    working_set = min(max(list(cache_sizes.values()) + [32 * 1024 * 1024]) * 2, 1 << 30)
+    accesses = 1 << 20
+    if prefetch_lib.prefetch_setup(working_set, accesses) != 0:
+        click.echo("Error: unable to allocate the prefetch tuner buffers.")
+        return
+
+    kernels = [(0, "Streaming scan"), (1, "Random gather"), (2, "Random update"), (3, "Pointer chase")]
+    hints = [(1, "T0"), (2, "T1"), (3, "NTA")] + ([(4, "W")] if prefetchw else [])
+    distances = [1, 2, 4, 8, 16, 32, 64, 128, 256, 512]
+
+    def cost(kernel, hint, distance):
+        count_benchmark_ops(2 * accesses, "memory accesses")
+        return min(prefetch_lib.prefetch_probe(kernel, hint, distance, accesses) for _ in range(2))
+
+    click.echo(f"Sweeping prefetch distances over a {working_set >> 20} MB working set, ns per access...")
+    click.echo()
+    try:
+        with EnergyMeter() as meter:
+            best = {}
+            for kernel, kernel_name in kernels:
+                baseline = cost(kernel, 0, 0)
+                timings = {(hint, distance): cost(kernel, hint, distance) for hint, _ in hints for distance in distances}
+
+                click.echo(f"{kernel_name} (no prefetch: {baseline:.2f} ns):")
+                click.echo("{:>10}".format("Distance") + "".join("{:>10}".format(name) for _, name in hints))
+                click.echo("-" * (10 + 10 * len(hints)))
+                fastest = min(timings, key=timings.get)
+                for distance in distances:
+                    cells = []
+                    for hint, _ in hints:
+                        value = "{:>10.2f}".format(timings[(hint, distance)])
+                        cells.append(click.style(value, fg='green', bold=True) if (hint, distance) == fastest else value)
+                    click.echo("{:>10}".format(distance) + "".join(cells))
+                click.echo()
+                best[kernel_name] = (baseline, fastest, timings[fastest])
+    finally:
+        prefetch_lib.prefetch_teardown()
+
+    # A prefetch must be issued one memory latency before the load, the chase without prefetch measures that latency
+    names = dict(hints)
+    memory_latency = best["Pointer chase"][0]
+    click.echo(f"Measured memory latency: {memory_latency:.1f} ns per dependent load")
+    click.echo()
+    click.echo("{:<18} {:>8} {:>10} {:>12} {:>10} {:>12}".format("Access pattern", "Hint", "Distance", "Predicted", "Speedup", "ns/access"))
+    click.echo("-" * 75)
+    for kernel_name, (baseline, (hint, distance), value) in best.items():
+        predicted = max(1, math.ceil(memory_latency / value)) if value > 0 else 0
+        if value >= baseline * 0.95:
+            click.echo("{:<18} {:>8} {:>10} {:>12} {:>9.2f}x {:>12.2f}".format(kernel_name, "none", "-", predicted, 1.0, baseline))
+        else:
+            click.echo("{:<18} {:>8} {:>10} {:>12} {:>9.2f}x {:>12.2f}".format(kernel_name, names[hint], distance, predicted, baseline / value, value))
+    click.echo()
+    click.echo("Predicted distances are the memory latency divided by the prefetched loop's time per access.")
+    click.echo("Patterns marked none gain less than 5% from software prefetch, hardware prefetch or out-of-order execution already hides their misses.")
+    click.echo()
+    meter.report()
+
+def inspect_pipeline():
+    click.clear()
+
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
+
+    compile_and_load_cpuid()
 
-    click.echo()  # Add a newline for cleaner output
+    vendor, family, model, stepping = cpu_signature()
+    identified = identify_uarch(vendor, family, model)
+    click.echo(f"CPU signature (leaf 1): family 0x{family:X}, model 0x{model:X}, stepping {stepping}")
+    if identified:
+        click.echo(f"Microarchitecture: {click.style(identified[0], fg='cyan', bold=True)} ({identified[1]} class)")
+    else:
+        click.echo(click.style("Microarchitecture: not in the model table, showing measured values only", fg='yellow'))
+    click.echo()
 
-    # Print EDX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("EDX in binary:")
-        print(colored_edx_bits)
-        click.echo()
+    if get_host_os() != "Linux":
+        click.echo("The pipeline characterization suite requires Linux.")
+        return
 
-    # Step through each bit in edx_binary and list its meaning
-    click.echo("AMD CPUID Leaf 1, Sub-leaf 0 EDX Bits:")
-    for bit_index, description in amd_leaf1_edx_bits:
-        bit_value = edx_binary[31 - bit_index]
-        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        click.echo(f"{colored_value} - {colored_desc}")
+    uarch_lib = compile_and_load_native("uarch_probe", uarch_probe_cdef, uarch_probe_c_code)
+    pipeline_lib = compile_and_load_native("pipeline_probe", pipeline_probe_cdef, pipeline_probe_c_code)
+    if uarch_lib is None or pipeline_lib is None:
+        click.echo("Error: unable to compile the pipeline characterization suite.")
+        return
 
-    click.echo()  # Add a newline for cleaner output
+    # Paired with the one cycle ADD chain like the fingerprint probes, so results are in core cycles
+    def cycles(probe, *args, repeats=9):
+        ratios = sorted(probe(*args) / uarch_lib.uarch_add_latency(20000) for _ in range(repeats))
+        return ratios[len(ratios) // 2]
+
+    click.echo("Measuring branch, store forwarding and 4K aliasing costs...")
+    meter = EnergyMeter()
+    with meter:
+        predictable = cycles(pipeline_lib.pipeline_branch, 0, 1000000)
+        mispredict = (cycles(pipeline_lib.pipeline_branch, 1, 1000000) - predictable) * 2
+        forward = cycles(pipeline_lib.pipeline_store_forward, 0, 100000)
+        forward_fail = cycles(pipeline_lib.pipeline_store_forward, 1, 100000)
+        alias_offsets = [0, 4, 8, 16, 64]
+        alias = {offset: cycles(pipeline_lib.pipeline_alias, offset, 100000) for offset in alias_offsets}
+
+    # Two chains missing to memory, twice the largest cache so neither stays cached
+    cache_sizes = read_cache_sizes()
+    if pipeline_lib.pipeline_setup(max(list(cache_sizes.values()) + [64 * 1024 * 1024]) * 2) != 0:
+        click.echo("Error: unable to allocate the pointer chase buffer.")
+        return
 
-def inspect_leaf7_amd_support():
-    click.clear()
+    # Filler kind, name, structure entries used besides the fillers (the two chase loads where they count)
+    structures = [(0, "Reorder buffer", "NOP", 2), (1, "Scheduler", "LEA", 0),
+                  (2, "Load buffer", "L1 load", 2), (3, "Store buffer", "store", 0)]
+    windows = {}
+    click.echo("Sweeping filler counts between two cache missing loads...")
+    try:
+        with meter:
+            for filler, name, _, extra in structures:
+                # Each run is paired with a run of 8 fillers right before it, memory latency drifts on busy hosts
+                ratios = []
+                step = None
+                for count in range(16, 1025, 8):
+                    runs = sorted(pipeline_lib.pipeline_window(filler, count, 1000) / pipeline_lib.pipeline_window(filler, 8, 1000)
+                                  for _ in range(7))
+                    ratios.append((count, runs[3]))
+                    # The step is the first count after which three ratios in a row pass 1.5, serialized misses doubling the time
+                    recent = ratios[-3:]
+                    if len(recent) == 3 and all(ratio > 1.5 for _, ratio in recent):
+                        step = recent[0][0]
+                        break
+                windows[name] = step + extra if step else None
+    finally:
+        pipeline_lib.pipeline_teardown()
+    click.echo()
 
-    def color_bits(binary_string):
-        """Returns a colored version of the binary string with specific bits highlighted."""
-        colored_bits = ""
-        for i, bit in enumerate(binary_string):
-            # Highlight specific bit in red if it's '0', green if it's '1'
-            if bit == '0':
-                colored_bits += click.style(bit, fg='red')
-            else:
-                colored_bits += click.style(bit, fg='green', bold=True)
-        return colored_bits
+    published = {}
+    if identified:
+        for reference, rob, load_buffer, store_buffer in uarch_window_list:
+            if reference == identified[1]:
+                published = {"Reorder buffer": rob, "Load buffer": load_buffer, "Store buffer": store_buffer}
+
+    click.echo("{:<38} {:>12} {:>12}".format("Parameter", "Measured", "Published"))
+    click.echo("-" * 64)
+    click.echo("{:<38} {:>12.1f} {:>12}".format("Branch mispredict penalty (cycles)", mispredict, "-"))
+    for _, name, filler_name, _ in structures:
+        measured = f"~{windows[name]}" if windows[name] else "> 1024"
+        reference = published.get(name)
+        click.echo("{:<38} {:>12} {:>12}".format(f"{name} entries ({filler_name} fillers)", measured, reference if reference else "-"))
+    click.echo("{:<38} {:>12.1f} {:>12}".format("Store to load forwarding (cycles)", forward, "-"))
+    click.echo("{:<38} {:>12.1f} {:>12}".format("Failed forwarding, 4B store 8B load", forward_fail, "-"))
+    click.echo("{:<38} {:>12.1f} {:>12}".format("4K aliasing penalty (cycles)", alias[0] - alias[64], "-"))
+    click.echo()
 
-    def colored_description(description, bit_value):
-        """Returns a colored version of the description based on the bit value."""
-        if bit_value == '0':
-            return click.style(description, fg='red')
-        else:
-            return click.style(description, fg='green', bold=True)
+    click.echo("Store and reload chain through an address 4 KB + offset away, cycles per iteration:")
+    click.echo("  " + "  ".join(f"+{offset}: {alias[offset]:.1f}" for offset in alias_offsets))
+    click.echo()
+
+    if forward < 1:
+        click.echo("Forwarding costs under a cycle, the core renames memory operands and bypasses the store buffer.")
+    click.echo(f"A mispredicted branch costs about {mispredict:.0f} cycles, branchless code pays off once a data dependent "
+               f"branch mispredicts more than {min(100, 200 / max(mispredict, 1)):.0f}% of the time (about two cycles per select).")
+    if alias[0] - alias[64] >= 1:
+        click.echo("Buffers read and written in the same loop should not start at the same offset within a 4 KB page.")
+    for name in ("Reorder buffer", "Load buffer", "Store buffer"):
+        if windows[name] and published.get(name) and abs(windows[name] - published[name]) > published[name] * 0.25:
+            click.echo(click.style(f"The measured {name.lower()} differs from the published size, the host may be "
+                                   "partitioning it with another thread or a noisy neighbor disturbed the sweep.", fg='yellow'))
+    click.echo()
+    meter.report()
+
+def inspect_smt_contention():
+    click.clear()
 
     if DEBUG.upper() == "TRUE":
         click.echo("If you see this message, you're in DEBUG mode...")
 
     compile_and_load_cpuid()
 
-    # Query CPUID leaf 7, subleaf 0
-    eax, ebx, ecx, edx = call_cpuid(7, 0)
-    if DEBUG.upper() == "TRUE":
-        print("call_cpuid function returned:")
-        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+    vendor = schema_vendor(get_cpu_vendor())
+    max_basic_leaf, _, _, _ = call_cpuid(0, 0)
+    max_extended_leaf, _, _, _ = call_cpuid(0x80000000, 0)
+
+    # Threads per core: extended topology SMT level on Intel, 0x8000001E EBX[15:8] on AMD
+    threads_per_core = None
+    if vendor == "amd" and max_extended_leaf >= 0x8000001E:
+        threads_per_core = ((call_cpuid(0x8000001E, 0)[1] >> 8) & 0xFF) + 1
+    elif max_basic_leaf >= 0xB:
+        _, ebx, ecx, _ = call_cpuid(0xB, 0)
+        if (ecx >> 8) & 0xFF == 1:
+            threads_per_core = ebx & 0xFFFF
+
+    click.echo("Simultaneous Multithreading:")
+    click.echo(f"  Threads per core (CPUID): {threads_per_core if threads_per_core else 'Unknown'}")
+    if get_host_os() == "Linux":
+        click.echo(f"  Kernel SMT control: {read_sysfs_value('/sys/devices/system/cpu/smt/control')}")
+    click.echo()
 
-    # Print Registers in hexadecimal format
-    if DEBUG.upper() == "TRUE":
-        click.echo("Leaf 7 sub-leaf 0 Registers:")
-        click.echo(f"EAX: 0x{eax:08X}")
-        click.echo(f"EBX: 0x{ebx:08X}")
-        click.echo(f"ECX: 0x{ecx:08X}")
-        click.echo(f"EDX: 0x{edx:08X}\n")
+    if get_host_os() != "Linux":
+        click.echo("The SMT contention benchmark requires Linux (CPU affinity).")
+        return
 
-    # Convert Registers to binary strings
-    ebx_binary = f"{ebx:032b}"
-    ecx_binary = f"{ecx:032b}"
-    edx_binary = f"{edx:032b}"
+    smt_lib = compile_and_load_native("smt_probe", smt_probe_cdef, smt_probe_c_code)
+    if smt_lib is None:
+        click.echo("Error: unable to compile the SMT contention benchmark.")
+        return
 
-    colored_ebx_bits = color_bits(ebx_binary)
-    colored_ecx_bits = color_bits(ecx_binary)
-    colored_edx_bits = color_bits(edx_binary)
-    
-    # Print EBX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("EBX in binary:")
-        print(colored_ebx_bits)
-        click.echo()
+    cpus = sorted(os.sched_getaffinity(0))
+    sibling_pair = pick_cpu_pairs(cpus).get("smt")
+    cache_sizes = read_cache_sizes()
+    if smt_lib.smt_setup(max(list(cache_sizes.values()) + [32 * 1024 * 1024]) * 2) != 0:
+        click.echo("Error: unable to allocate the memory kernel buffers.")
+        return
 
-    # Step through each bit in ebx_binary and list its meaning
-    click.echo("AMD CPUID Leaf 7, Sub-leaf 0 EBX Bits:")
-    for bit_index, description in amd_leaf7_ebx_bits:
-        bit_value = ebx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        click.echo(f"{colored_value} - {colored_desc}")
+    kernels = [(0, "Integer"), (1, "FP vector"), (2, "Memory"), (3, "Branchy")]
+    try:
+        with EnergyMeter() as meter:
+            # Size every kernel to about 30 ms alone, the pairings then run for comparable times
+            cpu_a = sibling_pair[0] if sibling_pair else cpus[0]
+            iterations = {}
+            for kernel, _ in kernels:
+                per_unit = smt_lib.smt_probe(kernel, cpu_a, 0, -1, 1000)
+                iterations[kernel] = max(1000, int(30e6 / per_unit)) if per_unit > 0 else 1000
+
+            def cost(kernel, kernel_b, cpu_b):
+                count_benchmark_ops(3 * iterations[kernel], "measured kernel units")
+                runs = sorted(smt_lib.smt_probe(kernel, cpu_a, kernel_b, cpu_b, iterations[kernel]) for _ in range(3))
+                return runs[1]
+
+            click.echo("Running every kernel alone" + (f" on CPU {cpu_a} and next to each kernel on its sibling CPU {sibling_pair[1]}..."
+                                                      if sibling_pair else f" on CPU {cpu_a}..."))
+            alone = {kernel: cost(kernel, 0, -1) for kernel, _ in kernels}
+            paired = {}
+            if sibling_pair:
+                for kernel, _ in kernels:
+                    for kernel_b, _ in kernels:
+                        paired[(kernel, kernel_b)] = cost(kernel, kernel_b, sibling_pair[1])
+    finally:
+        smt_lib.smt_teardown()
+    click.echo()
 
-    click.echo()  # Add a newline for cleaner output
+    click.echo("{:<12} {:>14}".format("Kernel", "Alone ns/unit"))
+    click.echo("-" * 27)
+    for kernel, name in kernels:
+        click.echo("{:<12} {:>14}".format(name, "failed" if alone[kernel] < 0 else f"{alone[kernel]:.2f}"))
+    click.echo()
 
-    # Print ECX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("ECX in binary:")
-        print(colored_ecx_bits)
+    if not sibling_pair:
+        click.echo("No SMT siblings are available to this process, only the alone times were measured.")
         click.echo()
+        meter.report()
+        return
 
-    # Step through each bit in ecx_binary and list its meaning
-    click.echo("AMD CPUID Leaf 7, Sub-leaf 0 ECX Bits:")
-    for bit_index, description in amd_leaf7_ecx_bits:
-        bit_value = ecx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        click.echo(f"{colored_value} - {colored_desc}")
+    # Latency inflation is the slowdown of the row kernel with the column kernel on its sibling, None when a run failed
+    inflation = {pair: value / alone[pair[0]] if value > 0 and alone[pair[0]] > 0 else None for pair, value in paired.items()}
+    click.echo("Latency inflation of the row kernel with the column kernel on the sibling thread:")
+    click.echo("{:<12}".format("") + "".join("{:>12}".format(name) for _, name in kernels))
+    click.echo("-" * (12 + 12 * len(kernels)))
+    for kernel, name in kernels:
+        cells = []
+        for kernel_b, _ in kernels:
+            value = inflation[(kernel, kernel_b)]
+            if value is None:
+                cells.append("{:>12}".format("failed"))
+                continue
+            color = 'red' if value >= 1.8 else 'yellow' if value >= 1.3 else None
+            cell = "{:>11.2f}x".format(value)
+            cells.append(click.style(cell, fg=color) if color else cell)
+        click.echo("{:<12}".format(name) + "".join(cells))
+    click.echo()
 
-    click.echo()  # Add a newline for cleaner output
+    # Throughput of a pairing against running the two kernels one after the other on one thread
+    click.echo("Combined throughput of each pairing against one thread running both in turn:")
+    for index, (kernel, name) in enumerate(kernels):
+        for kernel_b, name_b in kernels[index:]:
+            if inflation[(kernel, kernel_b)] is None or inflation[(kernel_b, kernel)] is None:
+                click.echo(f"  {name + ' + ' + name_b:<26} failed")
+                continue
+            throughput = 1 / inflation[(kernel, kernel_b)] + 1 / inflation[(kernel_b, kernel)]
+            if kernel == kernel_b:
+                throughput = 2 / inflation[(kernel, kernel)]
+            color = 'green' if throughput >= 1.3 else 'red' if throughput < 1.05 else 'yellow'
+            click.echo(f"  {name + ' + ' + name_b:<26} {click.style(f'{throughput:.2f}x', fg=color)}")
+    click.echo()
 
-    # Print EDX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("EDX in binary:")
-        print(colored_edx_bits)
-        click.echo()
+    click.echo("Recommendation per workload class (both siblings running the same class):")
+    for kernel, name in kernels:
+        if inflation[(kernel, kernel)] is None:
+            click.echo(f"  {name:<12} failed")
+            continue
+        throughput = 2 / inflation[(kernel, kernel)]
+        if throughput >= 1.3:
+            verdict = click.style("SMT helps", fg='green', bold=True) + f", {throughput:.2f}x throughput for {inflation[(kernel, kernel)]:.2f}x latency"
+        elif throughput >= 1.05:
+            verdict = click.style("Marginal", fg='yellow') + f", {throughput:.2f}x throughput; keep siblings idle for latency sensitive work"
+        else:
+            verdict = click.style("SMT hurts", fg='red', bold=True) + ", no throughput gain; disable SMT or leave siblings idle"
+        click.echo(f"  {name:<12} {verdict}")
+    click.echo()
+    meter.report()
 
-    # Step through each bit in edx_binary and list its meaning
-    click.echo("AMD CPUID Leaf 7, Sub-leaf 0 EDX Bits:")
-    for bit_index, description in amd_leaf7_edx_bits:
-        bit_value = edx_binary[31 - bit_index]
-        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        click.echo(f"{colored_value} - {colored_desc}")
+def inspect_power_reporting():
+    click.clear()
 
-    click.echo()  # Add a newline for cleaner output
+    if DEBUG.upper() == "TRUE":
+        click.echo("If you see this message, you're in DEBUG mode...")
 
-def inspect_leaf80000001_amd_support():
-    click.clear()
+    compile_and_load_cpuid()
 
-    def color_bits(binary_string):
-        """Returns a colored version of the binary string with specific bits highlighted."""
-        colored_bits = ""
-        for i, bit in enumerate(binary_string):
-            # Highlight specific bit in red if it's '0', green if it's '1'
-            if bit == '0':
-                colored_bits += click.style(bit, fg='red')
-            else:
-                colored_bits += click.style(bit, fg='green', bold=True)
-        return colored_bits
+    vendor = schema_vendor(get_cpu_vendor())
+    max_basic_leaf, _, _, _ = call_cpuid(0, 0)
+    max_extended_leaf, _, _, _ = call_cpuid(0x80000000, 0)
+
+    vendor_label = "AMD" if vendor == "amd" else "Intel"
+
+    if max_basic_leaf >= 6:
+        leaf6_eax, _, leaf6_ecx, _ = call_cpuid(6, 0)
+        print_bit_list(f"{vendor_label} CPUID Leaf 6, Sub-leaf 0 EAX Bits:", leaf6_eax, feature_bits(vendor, 0x00000006, 0, "eax"))
+        print_bit_list(f"{vendor_label} CPUID Leaf 6, Sub-leaf 0 ECX Bits:", leaf6_ecx, feature_bits(vendor, 0x00000006, 0, "ecx"))
+    if max_extended_leaf >= 0x80000007:
+        _, _, ext7_ecx, ext7_edx = call_cpuid(0x80000007, 0)
+        print_bit_list(f"{vendor_label} CPUID Leaf 0x80000007 EDX Bits:", ext7_edx, feature_bits(vendor, 0x80000007, 0, "edx"))
+        if vendor == "amd" and ext7_edx & (1 << 12):
+            click.echo(f"Compute unit power sample time ratio (Leaf 0x80000007 ECX): {ext7_ecx}")
+            click.echo()
+
+    # RAPL is model specific on Intel, AMD enumerates it in 0x80000007 EDX[14]; both share the unit MSR layout
+    unit_msr = 0xC0010299 if vendor == "amd" else 0x606
+    units = read_msr(unit_msr)
+    click.echo(f"RAPL Power Units (MSR 0x{unit_msr:X}):")
+    if units is None:
+        click.echo("  Unreadable, load the msr module and run as root to read it.")
+    else:
+        click.echo(f"  Power unit:  {1 / (1 << (units & 0xF)):.6f} W")
+        click.echo(f"  Energy unit: {1e6 / (1 << ((units >> 8) & 0x1F)):.3f} uJ")
+        click.echo(f"  Time unit:   {1e6 / (1 << ((units >> 16) & 0xF)):.1f} us")
+    click.echo()
 
-    def colored_description(description, bit_value):
-        """Returns a colored version of the description based on the bit value."""
-        if bit_value == '0':
-            return click.style(description, fg='red')
+    if get_host_os() != "Linux":
+        click.echo("Energy counters are read from Linux sysfs (powercap and hwmon).")
+        return
+
+    counters = read_energy_counters()
+    click.echo("Energy Counters:")
+    if not counters:
+        if not os.path.isdir("/sys/class/powercap"):
+            click.echo("  /sys/class/powercap is absent (no RAPL driver, or a virtual machine without power reporting).")
         else:
-            return click.style(description, fg='green', bold=True)
+            click.echo("  No readable intel-rapl zones, energy_uj is restricted to root on recent kernels.")
+        click.echo("  Benchmarks run without energy figures.")
+        click.echo()
+        return
+
+    # Two samples a second apart give the current draw of each domain
+    first = counters
+    time.sleep(1)
+    second = read_energy_counters()
+    click.echo("{:<28} {:>20} {:>12}".format("Domain", "Counter (uJ)", "Power (W)"))
+    click.echo("-" * 62)
+    for name, (energy, energy_range) in first.items():
+        delta = second.get(name, (energy, energy_range))[0] - energy
+        if delta < 0:
+            delta += energy_range
+        click.echo("{:<28} {:>20} {:>12.2f}".format(name, energy, delta / 1e6))
+    click.echo()
+    click.echo("Every benchmark in this menu reports its energy and operations per joule from these counters.")
+    click.echo()
+
+def read_cpuidle_states(cpu):
+    """
+    Reads the cpuidle state table of a CPU from sysfs.
+
+    Returns:
+        list: one dict per state with index, name, desc, latency and residency (microseconds), disabled and
+        usage (entry count), empty when the CPU has no cpuidle directory.
+    """
+    states = []
+    base = f"/sys/devices/system/cpu/cpu{cpu}/cpuidle"
+    if not os.path.isdir(base):
+        return states
+    for entry in sorted(os.listdir(base)):
+        if not entry.startswith("state") or not entry[5:].isdigit():
+            continue
+        path = f"{base}/{entry}"
+        states.append({
+            "index": int(entry[5:]),
+            "name": read_sysfs_value(f"{path}/name"),
+            "desc": read_sysfs_value(f"{path}/desc", ""),
+            "latency": int(read_sysfs_value(f"{path}/latency", "0")),
+            "residency": int(read_sysfs_value(f"{path}/residency", "0")),
+            "disabled": read_sysfs_value(f"{path}/disable", "0") == "1",
+            "usage": int(read_sysfs_value(f"{path}/usage", "0")),
+        })
+    return sorted(states, key=lambda state: state["index"])
+
+def open_pm_qos_constraint(latency_us):
+    """
+    Requests a CPU wake-up latency limit through /dev/cpu_dma_latency, held for as long as the returned
+    descriptor stays open. Returns the descriptor, or None when the device cannot be opened (root only).
+    """
+    try:
+        fd = os.open("/dev/cpu_dma_latency", os.O_WRONLY)
+    except OSError:
+        return None
+    try:
+        os.write(fd, struct.pack("i", latency_us))
+    except OSError:
+        os.close(fd)
+        return None
+    return fd
+
+def inspect_idle_latency():
+    click.clear()
 
     if DEBUG.upper() == "TRUE":
         click.echo("If you see this message, you're in DEBUG mode...")
 
     compile_and_load_cpuid()
 
-    # Query CPUID leaf 0x80000001, subleaf H
-    eax, ebx, ecx, edx = call_cpuid(0x80000001, 17)
-    if DEBUG.upper() == "TRUE":
-        print("call_cpuid function returned:")
-        print(f"EAX: {eax}, EBX: {ebx}, ECX: {ecx}, EDX: {edx}\n")
+    vendor = schema_vendor(get_cpu_vendor())
+    max_basic_leaf, _, _, _ = call_cpuid(0, 0)
+    leaf1_ecx = call_cpuid(1, 0)[2]
 
-    # Print Registers in hexadecimal format
-    if DEBUG.upper() == "TRUE":
-        click.echo("Leaf 0x80000001 sub-leaf H Registers:")
-        click.echo(f"EAX: 0x{eax:08X}")
-        click.echo(f"EBX: 0x{ebx:08X}")
-        click.echo(f"ECX: 0x{ecx:08X}")
-        click.echo(f"EDX: 0x{edx:08X}\n")
+    click.echo("MONITOR/MWAIT (Leaf 1 ECX[3]): " + (click.style("Supported", fg='green', bold=True) if leaf1_ecx & (1 << 3) else click.style("Not supported", fg='red')))
+    if max_basic_leaf >= 5 and leaf1_ecx & (1 << 3):
+        eax, ebx, ecx, edx = call_cpuid(5, 0)
+        click.echo(f"  Monitor line size (Leaf 5 EAX/EBX[15:0]): {eax & 0xFFFF} to {ebx & 0xFFFF} bytes")
+        click.echo(f"  MWAIT extensions (Leaf 5 ECX[0]): {'Yes' if ecx & 1 else 'No'}")
+        click.echo(f"  Interrupts break MWAIT when masked (Leaf 5 ECX[1]): {'Yes' if ecx & 2 else 'No'}")
+        click.echo()
+        if vendor == "intel":
+            click.echo("MWAIT Sub C-states (Leaf 5 EDX):")
+            for state in range(8):
+                count = (edx >> (state * 4)) & 0xF
+                if count:
+                    click.echo(f"  C{state}: {count} sub-state{'s' if count > 1 else ''}")
+    click.echo()
 
-    # Convert Registers to binary strings
-    ebx_binary = f"{ebx:032b}"
-    ecx_binary = f"{ecx:032b}"
-    edx_binary = f"{edx:032b}"
+    if get_host_os() != "Linux":
+        click.echo("The idle exit latency profiler requires Linux (cpuidle and PM QoS).")
+        return
 
-    colored_ebx_bits = color_bits(ebx_binary)
-    colored_ecx_bits = color_bits(ecx_binary)
-    colored_edx_bits = color_bits(edx_binary)
+    click.echo(f"cpuidle driver: {read_sysfs_value('/sys/devices/system/cpu/cpuidle/current_driver')}, "
+               f"governor: {read_sysfs_value('/sys/devices/system/cpu/cpuidle/current_governor_ro', read_sysfs_value('/sys/devices/system/cpu/cpuidle/current_governor'))}")
+
+    cpus = sorted(os.sched_getaffinity(0))
+    pairs = pick_cpu_pairs(cpus)
+    cpu_a, cpu_b = pairs.get("core") or pairs.get("smt") or pairs.get("llc") or pairs.get("package") or (cpus[0], cpus[0])
+    states = read_cpuidle_states(cpu_b)
+    if states:
+        click.echo(f"\nIdle States of CPU {cpu_b}:")
+        click.echo("{:>5} {:<12} {:<28} {:>12} {:>14} {:>9}".format("State", "Name", "Description", "Exit (us)", "Residency (us)", "Enabled"))
+        click.echo("-" * 85)
+        for state in states:
+            enabled = click.style("No", fg='red') if state["disabled"] else click.style("Yes", fg='green')
+            click.echo("{:>5} {:<12} {:<28} {:>12} {:>14} {:>9}".format(state["index"], state["name"], state["desc"][:28], state["latency"], state["residency"], enabled))
+    else:
+        click.echo(f"CPU {cpu_b} has no cpuidle states, it idles with the default HLT or the hypervisor decides.")
+    click.echo()
 
-    # Print EBX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("EBX in binary:")
-        print(colored_ebx_bits)
-        click.echo()
+    wake_lib = compile_and_load_native("idle_wake", idle_wake_cdef, idle_wake_c_code)
+    if wake_lib is None:
+        click.echo("Error: unable to compile the wake-up latency probe.")
+        return
 
-    # Step through each bit in ebx_binary and list its meaning
-    click.echo("AMD CPUID Leaf 0x80000001, Sub-leaf H EBX Bits:")
-    for bit_index, description in amd_leaf80000001_ebx_bits:
-        bit_value = ebx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ebx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        click.echo(f"{colored_value} - {colored_desc}")
+    # Each constraint allows the states whose exit latency fits it, from all states down to polling only
+    constraints = [None] + sorted({state["latency"] for state in states if state["latency"] > 0}, reverse=True) + [0]
+    probe_fd = open_pm_qos_constraint(2000000000)
+    if probe_fd is None:
+        click.echo(click.style("/dev/cpu_dma_latency is not writable (root only), measuring without PM QoS constraints.", fg='yellow'))
+        constraints = [None]
+    else:
+        os.close(probe_fd)
+
+    # Sleep long enough between wake-ups for the deepest state to be worth entering
+    idle_us = min(max([2 * state["residency"] for state in states] + [1000]), 20000)
+    samples = 200
+    if cpu_a == cpu_b:
+        click.echo("Only one CPU is available, the waker and the sleeper share it and no cross-core wake-up is measured.")
+    click.echo(f"Waking CPU {cpu_b} from CPU {cpu_a} {samples} times per constraint, {idle_us} us idle between wake-ups...")
+    click.echo()
 
-    click.echo()  # Add a newline for cleaner output
-    
-    # Print ECX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("ECX in binary:")
-        print(colored_ecx_bits)
-        click.echo()
+    results = []
+    latencies = ffi_new("double[]", samples)
+    with EnergyMeter() as meter:
+        for constraint in constraints:
+            fd = open_pm_qos_constraint(constraint) if constraint is not None else None
+            try:
+                usage_before = {state["index"]: state["usage"] for state in read_cpuidle_states(cpu_b)}
+                status = wake_lib.idle_wake_probe(cpu_a, cpu_b, samples, idle_us, latencies)
+                count_benchmark_ops(samples, "futex wake-ups")
+                usage_after = {state["index"]: state["usage"] for state in read_cpuidle_states(cpu_b)}
+            finally:
+                if fd is not None:
+                    os.close(fd)
+            if status != 0:
+                click.echo(f"Error: unable to pin the probe threads to CPUs {cpu_a} and {cpu_b}.")
+                return
+            values = sorted(latencies[index] / 1000 for index in range(samples))
+            entered = {index: usage_after.get(index, 0) - count for index, count in usage_before.items()}
+            deepest = max((index for index, count in entered.items() if count > 0), default=None)
+            results.append((constraint, values[0], values[samples // 2], values[int(samples * 0.99)], values[-1],
+                            next((state["name"] for state in states if state["index"] == deepest), "-")))
+
+    click.echo("{:<16} {:>10} {:>10} {:>10} {:>10}  {:<14}".format("PM QoS limit", "Min us", "Median us", "P99 us", "Max us", "Deepest state"))
+    click.echo("-" * 76)
+    for constraint, minimum, median, p99, maximum, deepest in results:
+        label = "none" if constraint is None else f"{constraint} us"
+        click.echo("{:<16} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f}  {:<14}".format(label, minimum, median, p99, maximum, deepest))
+    click.echo()
 
-    # Step through each bit in ecx_binary and list its meaning
-    click.echo("AMD CPUID Leaf 0x80000001, Sub-leaf H ECX Bits:")
-    for bit_index, description in amd_leaf80000001_ecx_bits:
-        bit_value = ecx_binary[31 - bit_index]
-        colored_value = colored_binary_value(ecx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        click.echo(f"{colored_value} - {colored_desc}")
+    if len(results) > 1:
+        # The loosest limit whose median wake-up stays within 10 us of polling keeps most of the power savings
+        polling_median = results[-1][2]
+        loosest = next(constraint for constraint, _, median, _, _, _ in results if median <= polling_median + 10)
+        if loosest is None:
+            click.echo("Deep idle states add less than 10 us to a wake-up here, no latency constraint is needed.")
+        else:
+            click.echo(f"Hold a {loosest} us limit (write it to /dev/cpu_dma_latency and keep it open, or set "
+                       f"power/pm_qos_resume_latency_us of the serving CPUs) to keep wake-ups within 10 us of polling.")
+    else:
+        click.echo("Run as root to compare the wake-up latency under each PM QoS limit.")
+    click.echo()
+    meter.report()
+
+def schema_vendor(vendor_string):
+    """Maps a CPUID vendor string to the vendor key used by the feature database."""
+    return "amd" if vendor_string in ("AuthenticAMD", "HygonGenuine") else "intel"
+
+def snapshot_rows(snapshot):
+    """Flattens a snapshot into (cpu, leaf, subleaf, eax, ebx, ecx, edx) rows, one CPU after another."""
+    per_cpu = snapshot.get("cpus") or {"0": snapshot["leaves"]}
+    rows = []
+    for cpu in sorted(per_cpu, key=int):
+        for key, values in sorted(per_cpu[cpu].items()):
+            leaf, subleaf = key.split('.')
+            rows.append((int(cpu), int(leaf, 16), int(subleaf, 16)) + tuple(int(value, 16) for value in values))
+    return rows
+
+class CpuidBrowser:
+    """
+    Full-screen CPUID browser.
 
-    click.echo()  # Add a newline for cleaner output
+    Only the rows that fit on screen are drawn, and a leaf is decoded the first time it is expanded.
+    Decoded output is shared between CPUs reporting identical registers. Feature name filters use an
+    index of (leaf, register, mask) built from the leaf schemas, so filtering never decodes rows.
+    """
 
-    # Print EDX in binary format
-    if DEBUG.upper() == "TRUE":
-        click.echo("EDX in binary:")
-        print(colored_edx_bits)
-        click.echo()
+    def __init__(self, rows, vendor, title):
+        self.rows = rows
+        self.vendor = vendor
+        self.title = title
+        self.visible = list(range(len(rows)))
+        self.expanded = set()
+        self.decoded = {}
+        self.cursor = 0
+        self.top = 0
+        self.filter_text = ""
+        self.editing_filter = False
+
+        # Feature index: leaf -> [(subleaf or None, register index, mask, search key)]
+        self.feature_index = {}
+        for leaf, subleaf, schema in feature_database.leaves(vendor):
+            for register, handle in schema.items():
+                flags, fields = compile_bit_schema(handle)
+                for mask, name in flags:
+                    self.feature_index.setdefault(leaf, []).append(
+                        (subleaf, ("eax", "ebx", "ecx", "edx").index(register), mask, self.search_key(name)))
+
+    @staticmethod
+    def search_key(text):
+        """Lowercases and drops punctuation so 'avx512' matches 'AVX-512' and 'sse4.2' matches 'SSE4.2'."""
+        return re.sub(r'[^a-z0-9]', '', text.lower())
+
+    def decoded_lines(self, row_index):
+        """Returns the decoded lines of a row, decoding its registers on first use."""
+        cpu, leaf, subleaf, *registers = self.rows[row_index]
+        key = (leaf, subleaf, tuple(registers))
+        lines = self.decoded.get(key)
+        if lines is None:
+            schema = lookup_leaf_schema(self.vendor, leaf, subleaf)
+            lines = []
+            for name, value in zip(("eax", "ebx", "ecx", "edx"), registers):
+                if name in schema:
+                    decoded = decode_register(schema[name], value)
+                    for field, field_value in decoded["fields"].items():
+                        lines.append(f"      {name.upper()}  {field}: {field_value} (0x{field_value:X})")
+                    for flag in decoded["flags"]:
+                        lines.append(f"      {name.upper()}  {flag}")
+                else:
+                    lines.append(f"      {name.upper()}  0x{value:08X}  {value:032b}  {binary_to_char(value)}")
+            if not lines:
+                lines.append("      (no features set)")
+            self.decoded[key] = lines
+        return lines
+
+    def apply_filter(self, text):
+        """Filters rows by CPU (cpu:0-3), leaf (0x7) and feature name terms, all terms must match."""
+        cpus = None
+        leaves = []
+        features = []
+        for term in text.lower().split():
+            try:
+                if term.startswith("cpu:"):
+                    cpus = set(parse_cpu_list(term[4:]))
+                elif term.startswith("0x"):
+                    leaves.append(int(term, 16))
+                elif self.search_key(term):
+                    features.append(self.search_key(term))
+            except ValueError:
+                # Partially typed terms such as "cpu:" or "0x" are ignored until they parse
+                continue
+
+        feature_masks = []
+        for term in features:
+            matches = [(leaf, subleaf, register, mask)
+                       for leaf, entries in self.feature_index.items()
+                       for subleaf, register, mask, name in entries if term in name]
+            feature_masks.append(matches)
+
+        visible = []
+        for row_index, row in enumerate(self.rows):
+            cpu, leaf, subleaf = row[0], row[1], row[2]
+            if cpus is not None and cpu not in cpus:
+                continue
+            if leaves and leaf not in leaves:
+                continue
+            if not all(any(leaf == match_leaf and match_subleaf in (None, subleaf) and row[3 + register] & mask
+                           for match_leaf, match_subleaf, register, mask in matches)
+                       for matches in feature_masks):
+                continue
+            visible.append(row_index)
+
+        # Expand matching rows when searching by feature so the hit is on screen
+        if features:
+            self.expanded.update(visible)
+
+        self.visible = visible
+        self.cursor = 0
+        self.top = 0
+
+    def row_height(self, position):
+        row_index = self.visible[position]
+        return 1 + (len(self.decoded_lines(row_index)) if row_index in self.expanded else 0)
+
+    def scroll_to_cursor(self, body_height):
+        """Moves the first drawn row so the cursor row is on screen, walking at most one screen of rows."""
+        if not self.visible:
+            return
+        if self.cursor < self.top:
+            self.top = self.cursor
+            return
+        used = 0
+        position = self.cursor
+        while position >= self.top:
+            used += self.row_height(position)
+            if used > body_height:
+                self.top = min(position + 1, self.cursor)
+                return
+            position -= 1
+
+    def draw(self, screen, curses):
+        height, width = screen.getmaxyx()
+        body_height = max(height - 2, 1)
+        self.scroll_to_cursor(body_height)
+        screen.erase()
+
+        header = f" {self.title} - {len(self.visible)}/{len(self.rows)} leaves"
+        self.add_line(screen, 0, header, width, curses.A_REVERSE)
+
+        y = 1
+        position = self.top
+        while y <= body_height and position < len(self.visible):
+            row_index = self.visible[position]
+            cpu, leaf, subleaf, eax, ebx, ecx, edx = self.rows[row_index]
+            marker = "-" if row_index in self.expanded else "+"
+            line = f" {marker} CPU {cpu:<4} {leaf:08X}.{subleaf:02X}  EAX {eax:08X}  EBX {ebx:08X}  ECX {ecx:08X}  EDX {edx:08X}"
+            self.add_line(screen, y, line, width, curses.A_REVERSE if position == self.cursor else curses.A_NORMAL)
+            y += 1
+            if row_index in self.expanded:
+                for decoded_line in self.decoded_lines(row_index):
+                    if y > body_height:
+                        break
+                    self.add_line(screen, y, decoded_line, width, curses.color_pair(1))
+                    y += 1
+            position += 1
+
+        if self.editing_filter:
+            footer = f" Filter: {self.filter_text}"
+        else:
+            footer = " Up/Down/PgUp/PgDn move  Enter expand  / filter (name, cpu:0-3, 0x7)  c clear  q quit"
+            if self.filter_text:
+                footer += f"  [{self.filter_text}]"
+        self.add_line(screen, height - 1, footer, width, curses.A_REVERSE)
+        screen.refresh()
+
+    @staticmethod
+    def add_line(screen, y, text, width, attributes):
+        try:
+            screen.addnstr(y, 0, text.ljust(width - 1), width - 1, attributes)
+        except Exception:
+            pass
 
-    # Step through each bit in ecx_binary and list its meaning
-    click.echo("AMD CPUID Leaf 0x80000001, Sub-leaf H EDX Bits:")
-    for bit_index, description in amd_leaf80000001_edx_bits:
-        bit_value = edx_binary[31 - bit_index]
-        colored_value = colored_binary_value(edx_binary, 31 - bit_index)
-        colored_desc = colored_description(description, bit_value)
-        click.echo(f"{colored_value} - {colored_desc}")
+    def run(self, screen, curses):
+        curses.curs_set(0)
+        curses.use_default_colors()
+        if curses.has_colors():
+            curses.init_pair(1, curses.COLOR_GREEN, -1)
+        screen.keypad(True)
 
-    click.echo()  # Add a newline for cleaner output
+        previous_filter = ""
+        while True:
+            self.draw(screen, curses)
+            key = screen.getch()
+            height, _ = screen.getmaxyx()
+            page = max(height - 3, 1)
+
+            if self.editing_filter:
+                if key in (curses.KEY_ENTER, 10, 13):
+                    self.editing_filter = False
+                elif key == 27:
+                    self.editing_filter = False
+                    self.filter_text = previous_filter
+                    self.apply_filter(self.filter_text)
+                elif key in (curses.KEY_BACKSPACE, 127, 8):
+                    self.filter_text = self.filter_text[:-1]
+                    self.apply_filter(self.filter_text)
+                elif 32 <= key <= 126:
+                    self.filter_text += chr(key)
+                    self.apply_filter(self.filter_text)
+                continue
+
+            if key in (ord('q'), 27):
+                return
+            elif key in (curses.KEY_DOWN, ord('j')):
+                self.cursor = min(self.cursor + 1, max(len(self.visible) - 1, 0))
+            elif key in (curses.KEY_UP, ord('k')):
+                self.cursor = max(self.cursor - 1, 0)
+            elif key == curses.KEY_NPAGE:
+                self.cursor = min(self.cursor + page, max(len(self.visible) - 1, 0))
+            elif key == curses.KEY_PPAGE:
+                self.cursor = max(self.cursor - page, 0)
+            elif key in (curses.KEY_HOME, ord('g')):
+                self.cursor = 0
+            elif key in (curses.KEY_END, ord('G')):
+                self.cursor = max(len(self.visible) - 1, 0)
+            elif key in (curses.KEY_ENTER, 10, 13, ord(' ')) and self.visible:
+                row_index = self.visible[self.cursor]
+                if row_index in self.expanded:
+                    self.expanded.discard(row_index)
+                else:
+                    self.expanded.add(row_index)
+            elif key == ord('/'):
+                previous_filter = self.filter_text
+                self.editing_filter = True
+            elif key == ord('c'):
+                self.filter_text = ""
+                self.apply_filter("")
+
+def run_cpuid_tui(snapshot):
+    """Opens the full-screen browser on a snapshot dictionary."""
+    # curses is not part of every Python build (e.g. Windows), so it is only imported when needed
+    try:
+        import curses
+    except ImportError:
+        click.echo("The full-screen browser requires the Python curses module.")
+        return
 
-def dumpcpuid_vmware_format():
+    rows = snapshot_rows(snapshot)
+    cpu_count = len(snapshot.get("cpus") or {"0": None})
+    title = f"ChipInspect {CI_vers} - {snapshot.get('vendor', 'Unknown')} - {cpu_count} CPU(s)"
+    browser = CpuidBrowser(rows, schema_vendor(snapshot.get("vendor", "")), title)
+    curses.wrapper(lambda screen: browser.run(screen, curses))
+
+def browse_cpuid_tui():
     click.clear()
 
     if DEBUG.upper() == "TRUE":
         click.echo("If you see this message, you're in DEBUG mode...")
 
-    compile_and_load_cpuid()
+    path = click.prompt("Enter a snapshot file to browse (leave blank to capture every CPU now)", default="", show_default=False).strip()
+    try:
+        if path:
+            with open(path) as f:
+                snapshot = json.load(f)
+        else:
+            compile_and_load_cpuid()
+            click.echo("Capturing CPUID from every CPU...")
+            snapshot = capture_cpuid_snapshot(per_cpu=True)
+    except (OSError, ValueError) as e:
+        click.echo(f"Error: unable to load snapshot: {e}")
+        return
 
-    process_leaves_bits_vmware()
+    run_cpuid_tui(snapshot)
+
+def corpus_renderers():
+    """Returns the (name, function) pairs the corpus suite runs against every replayed dump."""
+    def batch_decode():
+        rows = [f"{leaf:08X}.{subleaf:02X} {eax:08X} {ebx:08X} {ecx:08X} {edx:08X}"
+                for (leaf, subleaf), (eax, ebx, ecx, edx) in sorted(replay_registers.items())]
+        batch_decode_registers(rows, sys.stdout, schema_vendor(get_cpu_vendor()))
+
+    def placement_profile():
+        profile = snapshot_profile(capture_cpuid_snapshot(per_cpu=True))
+        click.echo(json.dumps({key: sorted(value) if isinstance(value, frozenset) else value for key, value in profile.items()}))
+
+    def tui_decode():
+        snapshot = capture_cpuid_snapshot(per_cpu=True)
+        browser = CpuidBrowser(snapshot_rows(snapshot), schema_vendor(snapshot["vendor"]), "corpus")
+        for row_index in range(len(browser.rows)):
+            click.echo('\n'.join(browser.decoded_lines(row_index)))
+
+    return [
+        ("registers", dump_cpu_registers),
+        ("bits", dump_cpu_bits),
+        ("raw-table", dump_cpu_register_table),
+        ("ascii", dump_cpu_ascii),
+        ("vmware", dumpcpuid_vmware_format),
+        ("intel-leaf1", inspect_leaf1_intel_support),
+        ("intel-leaf7", inspect_leaf7_intel_support),
+        ("intel-leaf80000001", inspect_leaf80000001_intel_support),
+        ("amd-leaf1", inspect_leaf1_amd_support),
+        ("amd-leaf7", inspect_leaf7_amd_support),
+        ("amd-leaf80000001", inspect_leaf80000001_amd_support),
+        ("virtualization", inspect_virtualization_support),
+        ("batch-decode", batch_decode),
+        ("placement-profile", placement_profile),
+        ("tui-decode", tui_decode),
+    ]
+
+def run_corpus_suite(corpus_dir, baseline_path=None):
+    """
+    Replays every dump of the reference corpus through every renderer, timing each one.
+
+    Renderer output is discarded but hashed. With a baseline file the hashes are compared against it, or
+    written to it when it does not exist yet, so a change in any decoder shows up as a changed output.
+    Prompts are answered with their defaults.
+
+    Returns:
+        bool: True when nothing failed and no output changed.
+    """
+    with open(os.path.join(corpus_dir, "index.json")) as f:
+        index = json.load(f)
+
+    baseline = None
+    if baseline_path and os.path.exists(baseline_path):
+        with open(baseline_path) as f:
+            baseline = json.load(f)
+
+    renderers = corpus_renderers()
+    digests = {}
+    timings = {name: [] for name, _ in renderers}
+    failures = []
+    changes = []
+    original_prompt = click.prompt
+    click.prompt = lambda text, default=None, **kwargs: default
+
+    try:
+        for entry in index["entries"]:
+            with open(os.path.join(corpus_dir, entry["file"])) as f:
+                start_replay(json.load(f))
+            digests[entry["file"]] = {}
+            for name, renderer in renderers:
+                output = io.StringIO()
+                start = time.perf_counter()
+                try:
+                    with contextlib.redirect_stdout(output):
+                        renderer()
+                except Exception as e:
+                    failures.append((entry["file"], name, f"{type(e).__name__}: {e}"))
+                timings[name].append(time.perf_counter() - start)
+                digest = hashlib.sha256(output.getvalue().encode()).hexdigest()
+                digests[entry["file"]][name] = digest
+                if baseline is not None and baseline.get(entry["file"], {}).get(name, digest) != digest:
+                    changes.append((entry["file"], name))
+    finally:
+        click.prompt = original_prompt
+        stop_replay()
+
+    click.echo(f"Corpus version {index['version']}: {len(index['entries'])} dumps, {len(renderers)} renderers")
+    # A coverage target is met by any dump whose index fields equal all of the target's fields
+    targets = index.get("targets", [])
+    missing = [target["name"] for target in targets
+               if not any(all(entry.get(key) == value for key, value in target.items() if key != "name") for entry in index["entries"])]
+    if targets:
+        click.echo(f"Coverage: {len(targets) - len(missing)} of {len(targets)} targets")
+    if missing:
+        click.echo(click.style(f"No dumps for: {'; '.join(missing)}", fg='yellow'))
+    click.echo(f"{'Renderer':<20} {'Min ms':>9} {'Avg ms':>9} {'Max ms':>9}")
+    for name, samples in timings.items():
+        if samples:
+            click.echo(f"{name:<20} {min(samples) * 1000:>9.2f} {sum(samples) / len(samples) * 1000:>9.2f} {max(samples) * 1000:>9.2f}")
+
+    for file, name, error in failures:
+        click.echo(click.style(f"FAIL {file} {name}: {error}", fg='red'))
+    for file, name in changes:
+        click.echo(click.style(f"CHANGED {file} {name}", fg='yellow'))
+
+    if baseline_path and baseline is None:
+        with open(baseline_path, 'w') as f:
+            json.dump(digests, f, indent=1)
+        click.echo(f"Baseline written to {baseline_path}")
+    elif baseline is not None:
+        click.echo(f"{len(changes)} outputs changed from {baseline_path}")
+
+    return not failures and not changes
+
+def verify_synthetic_topology(snapshot):
+    """Decodes every CPU's x2APIC ID from leaf 0xB and returns (packages, cores, problems) for a snapshot."""
+    packages = set()
+    cores = set()
+    apic_ids = set()
+    problems = []
+    for cpu, leaves in (snapshot.get("cpus") or {"0": snapshot["leaves"]}).items():
+        smt_eax, _, _, apic_id = (int(value, 16) for value in leaves.get("0000000B.00", ["0"] * 4))
+        package_eax = int(leaves.get("0000000B.01", ["0"] * 4)[0], 16)
+        if apic_id in apic_ids:
+            problems.append(f"CPU {cpu} repeats x2APIC ID 0x{apic_id:X}")
+        apic_ids.add(apic_id)
+        if (int(leaves["00000001.00"][1], 16) >> 24) != apic_id & 0xFF:
+            problems.append(f"CPU {cpu} leaf 1 APIC ID does not match x2APIC ID 0x{apic_id:X}")
+        packages.add(apic_id >> (package_eax & 0x1F))
+        cores.add(apic_id >> (smt_eax & 0x1F))
+    return len(packages), len(cores), problems
+
+def run_scale_check(snapshot):
+    """
+    Replays a per-CPU snapshot through the per-CPU paths, timing each one and reporting peak memory.
+
+    Meant for synthetic topologies (--synthesize) far larger than the machine running it.
+
+    Returns:
+        bool: True when every step ran and the decoded topology is consistent.
+    """
+    try:
+        import resource
+    except ImportError:
+        resource = None
+
+    def peak_rss_mb():
+        if resource is None:
+            return 0.0
+        peak = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+        # Linux reports kilobytes, macOS bytes
+        return peak / (1024 * 1024) if sys.platform == 'darwin' else peak / 1024
+
+    state = {}
+
+    def enumerate_cpus():
+        state["snapshot"] = capture_cpuid_snapshot(per_cpu=True)
+
+    def build_rows():
+        state["browser"] = CpuidBrowser(snapshot_rows(state["snapshot"]), schema_vendor(state["snapshot"]["vendor"]), "scale")
+
+    def decode_rows():
+        browser = state["browser"]
+        for row_index in range(len(browser.rows)):
+            browser.decoded_lines(row_index)
+
+    def archive_blob():
+        codec = SnapshotCodec(ARCHIVE_CODEC_ZSTD if load_zstd() else ARCHIVE_CODEC_ZLIB, b"")
+        state["blob"] = codec.compress(canonical_snapshot(state["snapshot"]))
+
+    steps = [
+        ("replay load", lambda: start_replay(snapshot)),
+        ("enumerate cpus", enumerate_cpus),
+        ("verify topology", lambda: state.setdefault("topology", verify_synthetic_topology(state["snapshot"]))),
+        ("placement profile", lambda: snapshot_profile(state["snapshot"])),
+        ("browser rows", build_rows),
+        ("browser filter", lambda: state["browser"].apply_filter(f"avx512f cpu:0-{len(state['snapshot'].get('cpus') or [0]) - 1}")),
+        ("decode rows", decode_rows),
+        ("archive blob", archive_blob),
+    ]
+
+    click.echo(f"Scale check: {len(snapshot.get('cpus') or {})} CPUs, {snapshot.get('vendor', 'Unknown')}")
+    click.echo(f"{'Step':<20} {'Wall ms':>10} {'Peak RSS MB':>12}")
+    failed = False
+    try:
+        for name, step in steps:
+            start = time.perf_counter()
+            try:
+                with ProfiledPhase(f"scale: {name}"):
+                    step()
+            except Exception as e:
+                click.echo(click.style(f"FAIL {name}: {type(e).__name__}: {e}", fg='red'))
+                failed = True
+                break
+            click.echo(f"{name:<20} {(time.perf_counter() - start) * 1000:>10.2f} {peak_rss_mb():>12.1f}")
+    finally:
+        stop_replay()
+
+    if "topology" in state:
+        packages, cores, problems = state["topology"]
+        click.echo(f"Decoded {packages} packages, {cores} cores, {len(state['browser'].rows) if 'browser' in state else 0} rows")
+        for problem in problems[:20]:
+            click.echo(click.style(f"INCONSISTENT {problem}", fg='red'))
+        failed = failed or bool(problems)
+    if "blob" in state:
+        click.echo(f"Archive blob: {len(state['blob']):,} bytes")
+
+    return not failed
 
 def exit_program():
     click.echo("Exiting ChipInspect. Goodbye!")